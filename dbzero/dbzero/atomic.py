@@ -103,6 +103,10 @@ def atomic() -> AtomicManager:
     increment the global state number. Instead, the changes are staged 
     and applied as part of the surrounding transaction, which is then committed 
     either manually via dbzero.commit() or by the autocommit mechanism.
+
+    Atomic operations are serialized process-wide: an atomic() block started by another 
+    thread waits until the current one is closed or canceled. The autocommit mechanism 
+    skips its cycle while an atomic operation is in progress (for at most 1 second).
     """
     return AtomicManager()
 
@@ -4,8 +4,8 @@ Type stubs for dbzero module.
 
 from typing import Any, Optional, Iterable, Dict, List, Tuple, Union, Callable
 from .interfaces import (
-    Memo, MemoWeakProxy, QueryObject, Tag, TagSet, EnumValue,
-    ListObject, IndexObject, TupleObject, SetObject, DictObject, ByteArrayObject,
+    Memo, MemoWeakProxy, QueryObject, Tag, TagSet, EnumValue, Predicate,
+    ListObject, IndexObject, TupleObject, SetObject, DictObject, ByteArrayObject, ArrayObject,
     ObjectTagManager, Snapshot
 )
 
@@ -32,6 +32,14 @@ def open(prefix_name: str, open_mode: str = "rw", **kwargs: Any) -> None:
         * slab_size (int) for memory slab allocation size in bytes
         * meta_io_step_size (int) for metadata I/O operation chunk size
         * lock_flags (dict) to change locking behavior when opening the prefix for read-write
+        * storage_flags (dict) for per-prefix storage options, e.g. {"positional_io": True} to use
+          positional (pread / pwrite) file I/O which allows concurrent reads of the prefix file
+          or {"pipelined_commit": True} to fsync committed transactions on a background thread
+          (see wait_durable) or {"compression": "lz4"} to store data pages of a newly created prefix
+          compressed ("none", "lz4" or "zstd", subject to codecs available in the build)
+          or {"change_log": True} to record objects created / modified / deleted by each
+          transaction (see get_changes) or {"read_ahead": True} to prefetch pages ahead of
+          sequential scans on a background thread (off by default)
 
     Examples
     --------
@@ -666,6 +674,44 @@ def set_cache_size(size: int, /) -> None:
     """
     ...
 
+# Tracing
+
+def enable_tracing(enabled: bool = True, /) -> None:
+    """Enable or disable collection of internal trace events.
+
+    Trace points cover commit, storage flush, page reads, cache eviction and
+    refresh. Events are recorded with nanosecond timestamps into per-thread
+    ring buffers (most recent events are retained).
+
+    Examples
+    --------
+    >>> dbzero.enable_tracing()
+    >>> run_workload()
+    >>> dbzero.enable_tracing(False)
+    >>> with open("trace.json", "w") as f:
+    ...     f.write(dbzero.export_trace())
+
+    Notes
+    -----
+    * Overhead of disabled trace points is negligible
+    * The resulting file can be opened with chrome://tracing or Perfetto UI
+    """
+    ...
+
+def clear_trace() -> None:
+    """Discard all trace events collected so far."""
+    ...
+
+def export_trace() -> str:
+    """Export collected trace events as Chrome trace / Perfetto JSON string.
+
+    Returns
+    -------
+    str
+        JSON document with the "traceEvents" list of complete ("X") events.
+    """
+    ...
+
 # Collection creation functions
 
 def list(iterable: Optional[Iterable[Any]] = None, /) -> ListObject:
@@ -909,6 +955,36 @@ def bytearray(source: Union[bytes, Iterable[int]] = b'', /) -> ByteArrayObject:
     """
     ...
 
+def array(dtype: str, data: Any = None, /) -> ArrayObject:
+    """Create a persisted array of numbers of a single type.
+
+    Items are stored as raw machine values in page-sized blocks, which makes the array
+    suitable for large numeric vectors (e.g. features or time series).
+
+    Parameters
+    ----------
+    dtype : str
+        Item type, either NumPy-style ('i1', 'i2', 'i4', 'i8', 'u1', 'u2', 'u4', 'u8', 'f4', 'f8'),
+        a full name (e.g. 'float64') or a struct module format character (e.g. 'd', 'i').
+    data : buffer or Iterable, optional
+        Initial contents. Buffers of the matching type (e.g. array.array or numpy.ndarray)
+        are copied in bulk.
+
+    Returns
+    -------
+    ArrayObject
+        A new array exposing the buffer protocol (read-only). Arrays fitting in a single block
+        are exported zero-copy, larger ones as a contiguous copy (use blocks() for zero-copy access).
+
+    Examples
+    --------
+    >>> values = dbzero.array("f8", [1.0, 2.5, 3.0])
+    >>> values.extend(array.array("d", [4.0, 5.0]))
+    >>> numpy.frombuffer(values, dtype="f8").sum()
+    15.5
+    """
+    ...
+
 # Tag and query functions
 
 def tags(*objects: Memo) -> ObjectTagManager:
@@ -948,7 +1024,7 @@ def tags(*objects: Memo) -> ObjectTagManager:
     """
     ...
 
-def find(*query_criteria: Union[Tag, List[Tag], Tuple[Tag], QueryObject, TagSet], prefix: Optional[str] = None) -> QueryObject:
+def find(*query_criteria: Union[Tag, List[Tag], Tuple[Tag], QueryObject, TagSet, Predicate], prefix: Optional[str] = None) -> QueryObject:
     """Query for memo objects based on search criteria such as tags, types, or subqueries.
 
     The primary way to search for objects. All top-level criteria are combined
@@ -966,6 +1042,7 @@ def find(*query_criteria: Union[Tag, List[Tag], Tuple[Tag], QueryObject, TagSet]
         * Tuple of tags (AND): Objects with all of the specified tags
         * QueryObject: Result of another query
         * TagSet: Set logical operation.
+        * Predicate: Member comparisons, see dbzero.where()
     prefix : str, optional
         Optional data prefix to run the query on.
         If omitted, the prefix to run the query is resolved from query criteria.
@@ -1149,7 +1226,34 @@ def split_by(tags: List[Tag], query: QueryObject, exclusive: bool = True) -> Que
     """
     ...
 
-def filter(filter: Callable[[Any], bool], query: QueryObject) -> QueryObject:
+def where(*predicates: Predicate) -> Predicate:
+    """Combine member comparisons into a predicate evaluated natively while iterating a query.
+
+    Predicates are created by comparing class fields (MemoClass.__fields__.<name>) with
+    None, bool, int, float or str constants using <, <=, >, >= or the eq / ne methods
+    (== and != compare the field definitions themselves). Member values are compared directly
+    (without loading objects into Python), numbers by value and strings by content.
+    Objects with a member of an incompatible type (or without such member) never match
+    unless compared with '!='.
+
+    Parameters
+    ----------
+    *predicates : Predicate
+        One or more predicates, all of which must be satisfied (AND logic).
+
+    Returns
+    -------
+    Predicate
+        A combined predicate to be passed to dbzero.find() or dbzero.filter().
+
+    Examples
+    --------
+    >>> fields = Task.__fields__
+    >>> results = dbzero.find(Task, dbzero.where(fields.priority > 2, fields.status.eq("open")))
+    """
+    ...
+
+def filter(filter: Union[Callable[[Any], bool], Predicate], query: QueryObject) -> QueryObject:
     """Apply fine-grained, custom filtering logic to a query.
 
     Useful in situations where complex filtering conditions cannot be expressed
@@ -1158,9 +1262,10 @@ def filter(filter: Callable[[Any], bool], query: QueryObject) -> QueryObject:
 
     Parameters
     ----------
-    filter : Callable[[Any], bool]
+    filter : Union[Callable[[Any], bool], Predicate]
         A function or lambda that takes a single object as argument.
         Must return True to include the object, False to exclude it.
+        Alternatively a predicate (see dbzero.where()) evaluated without loading objects.
     query : QueryObject
         A query to filter.
 
@@ -1247,6 +1352,76 @@ def get_state_num(prefix: Optional[str] = None, finalized: bool = False) -> int:
     """
     ...
 
+def wait_durable(state_num: Optional[int] = None, prefix: Optional[str] = None) -> None:
+    """Block until a committed state is durable (i.e. synced to disk).
+
+    With storage_flags={"pipelined_commit": True} a commit returns once the transaction
+    is written, while fsync completes on a background thread. Use this function
+    when durability of a specific transaction is required.
+
+    Parameters
+    ----------
+    state_num : int, optional
+        The state number to wait for (e.g. get_state_num(finalized=True) after commit).
+        If None, waits for all committed states.
+    prefix : str, optional
+        Name of the prefix. If None, defaults to the current prefix.
+
+    Examples
+    --------
+    >>> dbzero.open("orders", storage_flags={"pipelined_commit": True})
+    >>> order = MemoTestClass(100)
+    >>> dbzero.commit()
+    >>> dbzero.wait_durable(dbzero.get_state_num(finalized=True))
+
+    Raises
+    ------
+    Exception
+        If the state has not been committed yet or if finalization of any committed state failed
+        (the failure is reported by all subsequent calls).
+
+    Notes
+    -----
+    Commits are always durable without the pipelined_commit flag, in which case this function returns immediately.
+    """
+    ...
+
+def get_changes(from_state: int, to_state: Optional[int] = None, prefix: Optional[str] = None) -> List[Tuple[int, str, str]]:
+    """Retrieve objects created, modified or deleted by transactions within a range of states.
+
+    Requires the prefix to be opened (at least once) with storage_flags={"change_log": True},
+    from then on the changes of every committed transaction are recorded.
+
+    Parameters
+    ----------
+    from_state : int
+        The first state number (inclusive).
+    to_state : int, optional
+        The last state number (inclusive). Defaults to the last committed state.
+    prefix : str, optional
+        Name of the prefix. If None, uses the current prefix.
+
+    Returns
+    -------
+    list of tuple
+        (state_num, change, uuid) tuples in commit order where change is one of
+        "created", "modified" or "deleted" and uuid is the object's UUID (see uuid).
+
+    Examples
+    --------
+    >>> state_num = dbzero.get_state_num(finalized=True)
+    >>> order = MemoTestClass(100)
+    >>> dbzero.commit()
+    >>> dbzero.get_changes(state_num + 1)
+    [(2, 'created', '...')]
+
+    Notes
+    -----
+    An object created and deleted within the same transaction is not reported.
+    Changes to the object's references (e.g. tags) are reported as modifications.
+    """
+    ...
+
 # Snapshot functions
 
 def snapshot(state_spec: Optional[Union[int, Dict[str, int]]] = None) -> Snapshot:
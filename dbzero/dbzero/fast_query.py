@@ -6,6 +6,7 @@
 from typing import Union, Callable, Tuple, Dict
 from .interfaces import QueryObject, Tag
 import dbzero as db0
+from .dbzero import _group_by
 import inspect
 import typing
 import types as py_types
@@ -56,6 +57,9 @@ def signature_of(group_defs):
     if hasattr(group_defs, "signature"):
         return group_defs.signature
     
+    if isinstance(group_defs, str):
+        return repr(group_defs)
+    
     if isinstance(group_defs, py_types.LambdaType):
         sig_callable = inspect.signature(group_defs)
         return f"{len(sig_callable.parameters)}:{get_lambda_source(group_defs)}"
@@ -146,7 +150,11 @@ class FastQuery:
 
 
 class GroupDef:
-    def __init__(self, key_func=None, groups=None):
+    def __init__(self, key_func=None, groups=None, field=None):
+        # group by a member's value (can be evaluated natively)
+        self.field = field
+        if field is not None:
+            key_func = lambda row: getattr(row, field)
         self.__key_func = key_func
         # extract decorator as the group identifier
         self.key_func = key_func if key_func else lambda row: row[1]
@@ -163,6 +171,8 @@ class GroupDef:
         if self.__sig is None:
             if self.groups is not None:
                 self.__sig = signature_of(self.groups)
+            elif self.field is not None:
+                self.__sig = f"field:{self.field}"
             else:
                 self.__sig = signature_of(self.__key_func)
         return self.__sig
@@ -203,6 +213,15 @@ class FastQueryCache:
         # return result of the closest query on condition it's sufficiently close        
         return min_result if min_diff < 0.33 else None
     
+    def find_exact_result(self, query: FastQuery):
+        """
+        Retrieves the cached result of an identical query (signature and uuid)
+        """
+        results = self.__cache.get(query.signature, None)
+        if results is None:
+            return None
+        return results.get(query.uuid, None)
+    
     def update(self, state_num, query: FastQuery, result):
         """
         Updates the cache with results computed over a more recent state number
@@ -229,12 +248,21 @@ def count_op(state, removed_rows, added_rows):
         state -= len(removed_rows)
         state += len(added_rows)
     return state
+
+# native op definition: (op name, field name or None)
+count_op.native_op = ("count", None)
     
     
 def make_sum(value_func):
     """
     Generates sum-op with a specific value function
+    or a member name (which allows the native evaluation)
     """
+    native_op = None
+    if isinstance(value_func, str):
+        native_op = ("sum", value_func)
+        value_func = lambda row, name=value_func: getattr(row, name)
+    
     def sum_op(state, removed_rows, added_rows):
         """
         Update (or initialize state) with rows to remove (0) or rows to add (1)
@@ -246,8 +274,39 @@ def make_sum(value_func):
             state += sum(value_func(row) for row in added_rows)
         return state
     
+    if native_op is not None:
+        sum_op.native_op = native_op
     return sum_op
 
+
+def _make_native_op(op_name, field):
+    def native_op(state, removed_rows, added_rows):
+        raise ValueError(f"{op_name} op can only be evaluated natively (numeric values of '{field}' required)")
+    
+    native_op.native_op = (op_name, field)
+    return native_op
+
+
+def make_min(field: str):
+    """
+    Generates min-op over a specific member (native evaluation only)
+    """
+    return _make_native_op("min", field)
+
+
+def make_max(field: str):
+    """
+    Generates max-op over a specific member (native evaluation only)
+    """
+    return _make_native_op("max", field)
+
+
+def make_avg(field: str):
+    """
+    Generates avg-op over a specific member (native evaluation only)
+    """
+    return _make_native_op("avg", field)
+
     
 @db0.memo
 class GroupByBucket:
@@ -328,6 +387,8 @@ def group_by(group_defs: Union[Callable, Tag, Tuple], query: QueryObject, ops: T
           For caching to work, the lambda's source code must be identical between calls.
         * Tag: To group objects by tags they are taged with.
           The group keys will be the string names of the enum members.
+        * A string: The name of a member to group objects by its value.
+          NOTE: a tuple of strings is interpreted as tags.
         * A tuple of the above: For multi-level grouping. The resulting dictionary keys 
           will be tuples.
     query : QueryObject
@@ -386,8 +447,22 @@ def group_by(group_defs: Union[Callable, Tag, Tuple], query: QueryObject, ops: T
     >>> # Example result where each value is a tuple (count, sum_of_values):
     >>> # {'even': (5, 20), 'odd': (5, 25)}
 
+    Grouping by a member with native aggregations:
+    
+    >>> query_ops = (dbzero.count_op, dbzero.make_sum("value"), dbzero.make_avg("value"))
+    >>> groups = dbzero.group_by((Colors.values(), "key"), dbzero.find(MemoTestClass), ops=query_ops)
+
     Notes
     -----
+    Queries grouped by member names (and optionally tags), or using make_sum(member_name),
+    make_min, make_max or make_avg ops are evaluated natively (i.e. without fetching objects).
+    Queries grouped by tags only and counted with count_op are evaluated from the cached deltas.
+    Objects tagged with multiple tags from the same group are assigned to the first matching tag.
+    Aggregated members must be numeric (None values are not supported).
+    
+    Natively evaluated results are cached as a whole (i.e. reused only by an identical query
+    over the same state number) since min / max / avg cannot be updated from deltas.
+    
     This method creates and updates an internal cache to speed up subsequent identical queries.
     For the cache to be persistent across program runs, it must first be initialized using 
     dbzero.init_fast_query(). A query is considered "identical" if its parameters and its
@@ -411,7 +486,9 @@ def group_by(group_defs: Union[Callable, Tag, Tuple], query: QueryObject, ops: T
     # extract groups and key function from a simple group definition
     def prepare_group_defs(group_defs, inner_def = False):
         if is_simple_group_def(group_defs):
-            if hasattr(group_defs, "__iter__"):
+            if isinstance(group_defs, str):
+                yield GroupDef(field = group_defs)
+            elif hasattr(group_defs, "__iter__"):
                 yield GroupDef(groups = group_defs)
             else:
                 yield GroupDef(key_func = group_defs)
@@ -440,13 +517,47 @@ def group_by(group_defs: Union[Callable, Tag, Tuple], query: QueryObject, ops: T
     def format_result(result):
         return {db0.load(key): value.result for key, value in result.items()}
     
+    def try_native_eval(rows):
+        # evaluate with the native engine (no caching), None if not possible
+        criteria = tuple(group_def.field if group_def.field is not None else tuple(group_def.groups)
+            for group_def in group_defs)
+        result = _group_by(rows, criteria, tuple(op.native_op for op in ops))
+        if result is None:
+            return None
+        
+        def format_item(item, criteria):
+            # tag groups are identified by the tag's position
+            return item if isinstance(criteria, str) else str(criteria[item])
+        
+        def format_key(key):
+            if len(key) == 1:
+                return format_item(key[0], criteria[0])
+            return tuple(format_item(item, c) for item, c in zip(key, criteria))
+        
+        return {format_key(key): (values[0] if len(values) == 1 else values) for key, values in result.items()}
+    
+    # tags-only counts are evaluated incrementally (from deltas) by the Python path
+    is_native = all(hasattr(op, "native_op") for op in ops) and \
+        all(group_def.field is not None or group_def.groups is not None for group_def in group_defs) and \
+        (any(group_def.field is not None for group_def in group_defs) or any(op is not count_op for op in ops))
+    
     cache = FastQueryCache(prefix=__px_fast_query)
     # take snapshot of the latest known state and rebase input query
     # otherwise refresh might invalidate query results (InvalidStateError)
     with db0.snapshot() as snapshot:
+        state_num = snapshot.get_state_num(prefix=px_name)
+        if is_native:
+            native_sig = f"native:{query.signature()}{signature_of(group_defs)}{tuple(op.native_op for op in ops)}"
+            native_query = FastQuery(query, (), sig=native_sig).rebase(snapshot)
+            last_result = cache.find_exact_result(native_query)
+            if last_result is not None and last_result[0] == state_num:
+                return db0.load(last_result[2])
+            result = try_native_eval(native_query.rows)
+            if result is not None:
+                cache.update(state_num, native_query, result)
+                return result
         fast_query = FastQuery(query, group_defs).rebase(snapshot)
         last_result = cache.find_result(fast_query)
-        state_num = snapshot.get_state_num(prefix=px_name)
         # return the cached result if from the same state number
         if last_result is None or last_result[0] != state_num:
             result = try_query_eval(fast_query, last_result, ops)
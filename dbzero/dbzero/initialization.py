@@ -27,7 +27,12 @@ def init(dbzero_root: str, **kwargs: Any) -> None:
         * autocommit (bool, default True) to enable automatic commits
         * autocommit_interval (int, default 367) for commit interval in milliseconds
         * cache_size (int, default 2 GiB) for main object cache size in bytes
+        * cache_policy (str, default "lru") cache replacement policy, "lru" or "s3fifo" (scan-resistant)
         * lang_cache_size (int, default 1024) for language model data cache size
+        * shared_cache_size (int, default 0 - disabled) size in bytes of the page cache shared (via /dev/shm)
+          by all processes reading the same prefixes, consulted by read-only prefixes before reading from disk.
+          Pages found there are mapped read-only (without a private copy) and stay pinned while cached by the process.
+          The segment is removed when the last process using it closes
         * lock_flags (dict) to configure locking behavior when opening the prefix in read-write mode
 
         Lock flags (dict):
@@ -38,7 +43,8 @@ def init(dbzero_root: str, **kwargs: Any) -> None:
 
     init_kwargs = {}
     
-    config_keys = ("autocommit", "autocommit_interval", "cache_size", "lang_cache_size")
+    config_keys = ("autocommit", "autocommit_interval", "cache_size", "cache_policy", "lang_cache_size",
+        "shared_cache_size")
     config = {}
     for key in config_keys:
         if key in kwargs:
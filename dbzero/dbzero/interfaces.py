@@ -46,6 +46,13 @@ class TagSet:
     """A tag set operation, e.g. logical complement, being a result of query negation."""
     ...
 
+class Predicate:
+    """A member-vs-constant comparison (or a conjunction of such), e.g. MemoClass.__fields__.value > 0."""
+
+    def __and__(self, other: Predicate) -> Predicate:
+        """Combine with other predicate (logical AND)."""
+        ...
+
 class ListObject(list):
     """Persistent list."""
     ...
@@ -142,6 +149,44 @@ class ByteArrayObject(bytearray):
     """Persisted sequence of bytes."""
     ...
 
+class ArrayObject:
+    """Persisted homogeneous array of numbers, supports the (read-only) buffer protocol."""
+
+    dtype: str
+    itemsize: int
+
+    def __len__(self) -> int: ...
+    def __getitem__(self, key: Union[int, slice]) -> Union[int, float, memoryview]: ...
+    def __setitem__(self, key: Union[int, slice], value: Any) -> None: ...
+
+    def append(self, value: Union[int, float], /) -> None:
+        """Append a single item to the array."""
+        ...
+
+    def extend(self, values: Any, /) -> None:
+        """Append items from a buffer-protocol object or any iterable.
+
+        Buffers of the matching item type (e.g. array.array('d') for an 'f8' array)
+        are copied in bulk, other sources are converted item by item.
+        """
+        ...
+
+    def clear(self) -> None:
+        """Remove all items from the array."""
+        ...
+
+    def tobytes(self) -> bytes:
+        """Return the raw contents of the array."""
+        ...
+
+    def tolist(self) -> List[Union[int, float]]:
+        """Return the contents as a list of Python numbers."""
+        ...
+
+    def blocks(self) -> List[memoryview]:
+        """Return read-only memoryviews of the consecutive data blocks (zero-copy)."""
+        ...
+
 class ObjectTagManager:
     """Manages tags of one or more Memo instances."""
 
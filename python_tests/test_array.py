@@ -0,0 +1,89 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+# Copyright (c) 2025 DBZero Software sp. z o.o.
+
+import array
+import pytest
+import dbzero as db0
+from .conftest import DB0_DIR
+from .memo_test_types import MemoTestSingleton
+
+
+def test_db0_array_can_be_created_from_list(db0_fixture):
+    values = db0.array("f8", [1.0, 2.5, 3.0])
+    assert len(values) == 3
+    assert values.dtype == "f8"
+    assert values.itemsize == 8
+    assert values[1] == 2.5
+    assert values[-1] == 3.0
+    assert list(values) == [1.0, 2.5, 3.0]
+
+
+def test_db0_array_checks_item_range(db0_fixture):
+    values = db0.array("u1")
+    values.append(255)
+    with pytest.raises(OverflowError):
+        values.append(256)
+    with pytest.raises(OverflowError):
+        values.append(-1)
+    values = db0.array("i4")
+    with pytest.raises(TypeError):
+        values.append(1.5)
+
+
+def test_db0_array_extend_from_matching_buffer(db0_fixture):
+    values = db0.array("i4", [1, 2])
+    values.extend(array.array("i", range(10000)))
+    values.extend(b"")
+    # non-matching buffer is converted item by item
+    values.extend(array.array("h", [7]))
+    assert len(values) == 10003
+    assert values[2:5].tolist() == [0, 1, 2]
+    assert values[-1] == 7
+
+
+def test_db0_array_slice_assignment(db0_fixture):
+    values = db0.array("f4", range(10))
+    values[2:5] = array.array("f", [20.0, 30.0, 40.0])
+    values[5:7] = [50, 60]
+    values[::4] = [-1, -2, -3]
+    assert values.tolist() == [-1.0, 1.0, 20.0, 30.0, -2.0, 50.0, 60.0, 7.0, -3.0, 9.0]
+    with pytest.raises(ValueError):
+        values[0:2] = [1.0]
+
+
+def test_db0_array_exposes_read_only_buffer(db0_fixture):
+    values = db0.array("f8", [1.0, 2.0, 3.0])
+    view = memoryview(values)
+    assert view.format == "d"
+    assert view.readonly
+    assert view.tolist() == [1.0, 2.0, 3.0]
+    assert values.tobytes() == array.array("d", [1.0, 2.0, 3.0]).tobytes()
+    with pytest.raises(TypeError):
+        memoryview(values)[0] = 5.0
+
+
+def test_db0_array_blocks_cover_all_items(db0_fixture):
+    values = db0.array("i8", range(100000))
+    blocks = values.blocks()
+    assert len(blocks) > 1
+    assert sum(len(block) for block in blocks) == len(values)
+    assert blocks[0][0] == 0 and blocks[-1][-1] == 99999
+    # the multi-block array is exported as a contiguous copy
+    assert memoryview(values)[50000] == 50000
+
+
+def test_db0_array_persists_as_member(db0_fixture):
+    object_1 = MemoTestSingleton(db0.array("f8", [0.5] * 5000))
+    object_1.value[4999] = 1.5
+    prefix_name = db0.get_prefix_of(object_1).name
+    del object_1
+    db0.commit()
+    db0.close()
+
+    db0.init(DB0_DIR)
+    db0.open(prefix_name)
+    object_1 = MemoTestSingleton()
+    assert len(object_1.value) == 5000
+    assert object_1.value[0] == 0.5
+    assert object_1.value[4999] == 1.5
+    assert object_1.value == db0.array("f8", object_1.value)
@@ -2,6 +2,7 @@
 # Copyright (c) 2025 DBZero Software sp. z o.o.
 
 import time
+import threading
 import pytest
 import dbzero as db0
 from .memo_test_types import MemoTestClass, MemoTestSingleton, MemoScopedSingleton, MemoScopedClass
@@ -490,3 +491,32 @@ def test_atomic_context_does_not_increase_state_num(db0_fixture):
     state_1 = db0.get_state_num()
     with db0.atomic():
         assert db0.get_state_num() == state_1
+
+
+@pytest.mark.parametrize("db0_autocommit_fixture", [20], indirect=True)
+def test_autocommit_deferred_by_atomic_does_not_block_locked_sections(db0_autocommit_fixture):
+    obj = MemoTestClass(0)
+    db0.commit()
+    def locked_section():
+        with db0.locked():
+            pass
+
+    state_num = db0.get_state_num()
+    with db0.atomic():
+        obj.value = 1
+        # let the autocommit thread run into the atomic operation
+        time.sleep(0.1)
+        # the locked section completes while the atomic operation is still in progress
+        thread = threading.Thread(target=locked_section)
+        thread.start()
+        thread.join(timeout=5.0)
+        assert not thread.is_alive()
+        # the commit was deferred
+        assert db0.get_state_num() == state_num
+
+    # deferred updates are committed on one of the next cycles
+    deadline = time.perf_counter() + 5.0
+    while db0.get_state_num() == state_num and time.perf_counter() < deadline:
+        time.sleep(0.01)
+    assert db0.get_state_num() > state_num
+    assert obj.value == 1
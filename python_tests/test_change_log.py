@@ -0,0 +1,82 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+# Copyright (c) 2025 DBZero Software sp. z o.o.
+
+import pytest
+import dbzero as db0
+from .memo_test_types import MemoTestClass
+from .conftest import DB0_DIR
+
+
+def open_with_change_log(prefix_name="my-test-prefix"):
+    db0.open(prefix_name, autocommit=False, storage_flags={"change_log": True})
+
+
+def commit_and_get_state_num():
+    db0.commit()
+    return db0.get_state_num(finalized=True)
+
+
+def test_get_changes_requires_change_log(db0_fixture):
+    db0.commit()
+    with pytest.raises(Exception):
+        db0.get_changes(0)
+
+
+def test_created_objects_reported_with_state_num(db0_no_default_fixture):
+    open_with_change_log()
+    objects = [MemoTestClass(i) for i in range(5)]
+    state_num = commit_and_get_state_num()
+    changes = db0.get_changes(state_num)
+    assert sorted(uuid for _, _, uuid in changes) == sorted(db0.uuid(obj) for obj in objects)
+    assert all(item[0] == state_num and item[1] == "created" for item in changes)
+
+
+def test_modified_and_deleted_objects_reported(db0_no_default_fixture):
+    open_with_change_log()
+    obj_1, obj_2, obj_3 = MemoTestClass(1), MemoTestClass(2), MemoTestClass(3)
+    commit_and_get_state_num()
+    obj_1.value = 100
+    uuid_3 = db0.uuid(obj_3)
+    db0.delete(obj_3)
+    del obj_3
+    state_num = commit_and_get_state_num()
+    changes = {uuid: change for _, change, uuid in db0.get_changes(state_num)}
+    assert changes == {db0.uuid(obj_1): "modified", uuid_3: "deleted"}
+
+
+def test_object_created_and_deleted_in_same_transaction_not_reported(db0_no_default_fixture):
+    open_with_change_log()
+    obj_1 = MemoTestClass(1)
+    obj_2 = MemoTestClass(2)
+    db0.delete(obj_2)
+    del obj_2
+    state_num = commit_and_get_state_num()
+    assert db0.get_changes(state_num) == [(state_num, "created", db0.uuid(obj_1))]
+
+
+def test_get_changes_within_state_range(db0_no_default_fixture):
+    open_with_change_log()
+    objects = []
+    state_nums = []
+    for i in range(4):
+        objects.append(MemoTestClass(i))
+        state_nums.append(commit_and_get_state_num())
+    changes = db0.get_changes(state_nums[1], state_nums[2])
+    assert [(item[0], item[2]) for item in changes] == \
+        [(state_nums[1], db0.uuid(objects[1])), (state_nums[2], db0.uuid(objects[2]))]
+    # changes are reported in commit order
+    assert [item[2] for item in db0.get_changes(0)] == [db0.uuid(obj) for obj in objects]
+
+
+def test_change_log_persisted_and_readable_from_read_only_prefix(db0_no_default_fixture):
+    open_with_change_log()
+    obj = MemoTestClass(1)
+    uuid = db0.uuid(obj)
+    state_num = commit_and_get_state_num()
+    del obj
+    db0.close()
+    db0.init(DB0_DIR)
+    db0.open("my-test-prefix", "r")
+    assert db0.get_changes(state_num, state_num) == [(state_num, "created", uuid)]
+    # unreferenced object was dropped with the last Python reference (committed on close)
+    assert db0.get_changes(state_num + 1) == [(state_num + 1, "deleted", uuid)]
@@ -0,0 +1,131 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+# Copyright (c) 2025 DBZero Software sp. z o.o.
+
+import time
+import threading
+import pytest
+import dbzero as db0
+from .memo_test_types import MemoTestClass
+
+
+def read_all(objects, repeat, results, index):
+    total = 0
+    for _ in range(repeat):
+        for obj in objects:
+            total += obj.value
+    results[index] = total
+
+
+@pytest.mark.stress_test
+def test_multithreaded_read_throughput(db0_fixture):
+    object_count = 20000
+    repeat = 5
+    objects = [MemoTestClass(i) for i in range(object_count)]
+    db0.commit()
+    expected = repeat * sum(range(object_count))
+    for thread_count in (1, 2, 4, 8):
+        results = [None] * thread_count
+        threads = [threading.Thread(target=read_all, args=(objects, repeat, results, i)) for i in range(thread_count)]
+        start = time.perf_counter()
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+        elapsed = time.perf_counter() - start
+        assert results == [expected] * thread_count
+        reads = thread_count * repeat * object_count
+        print(f"threads: {thread_count}, reads/s: {reads / elapsed:.0f}")
+
+
+def read_values(objects, repeat, offsets, errors):
+    for _ in range(repeat):
+        for i, obj in enumerate(objects):
+            if obj.value - i not in offsets:
+                errors.append((i, obj.value))
+                return
+
+
+@pytest.mark.parametrize("db0_autocommit_fixture", [20], indirect=True)
+def test_concurrent_reads_during_updates_and_autocommit(db0_autocommit_fixture):
+    object_count = 1000
+    objects = [MemoTestClass(i) for i in range(object_count)]
+    db0.commit()
+    errors = []
+    threads = [threading.Thread(target=read_values, args=(objects, 20, (0, object_count), errors)) for _ in range(4)]
+    for thread in threads:
+        thread.start()
+    for i, obj in enumerate(objects):
+        obj.value = i + object_count
+    for thread in threads:
+        thread.join(timeout=30.0)
+    assert not any(thread.is_alive() for thread in threads)
+    assert errors == []
+    assert sum(obj.value for obj in objects) == sum(range(object_count)) + object_count ** 2
+
+
+@pytest.mark.parametrize("db0_autocommit_fixture", [20], indirect=True)
+def test_autocommit_skips_idle_fixture(db0_autocommit_fixture):
+    obj = MemoTestClass(1)
+    db0.commit()
+    state_num = db0.get_state_num()
+    # several autocommit intervals without modifications
+    time.sleep(0.2)
+    assert db0.get_state_num() == state_num
+    assert obj.value == 1
+
+
+# set when a reader enters / may leave BlockingReadClass.blocking_value
+read_entered = threading.Event()
+read_release = threading.Event()
+
+
+@db0.memo
+class BlockingReadClass:
+    def __init__(self, value):
+        self.value = value
+    
+    # the getter blocks while the dbzero API (read) lock is held by the reading thread
+    @property
+    def blocking_value(self):
+        read_entered.set()
+        read_release.wait(10.0)
+        return self.value
+
+
+@pytest.mark.parametrize("db0_fixture", [{"autocommit": False}], indirect=True)
+def test_concurrent_readers_do_not_serialize(db0_fixture):
+    read_entered.clear()
+    read_release.clear()
+    obj = BlockingReadClass(1)
+    other = MemoTestClass(2)
+    db0.commit()
+    results = {}
+    def blocking_read():
+        results["blocking"] = obj.blocking_value
+    def read():
+        results["read"] = other.value
+    def write():
+        other.value = 3
+    
+    blocking_reader = threading.Thread(target=blocking_read)
+    blocking_reader.start()
+    assert read_entered.wait(5.0)
+    try:
+        # another reader completes while the 1st one holds the read lock
+        reader = threading.Thread(target=read)
+        reader.start()
+        reader.join(timeout=5.0)
+        assert not reader.is_alive()
+        assert results["read"] == 2
+        # writers wait for the readers to complete
+        writer = threading.Thread(target=write)
+        writer.start()
+        writer.join(timeout=0.2)
+        assert writer.is_alive()
+    finally:
+        read_release.set()
+    blocking_reader.join(timeout=5.0)
+    writer.join(timeout=5.0)
+    assert not writer.is_alive()
+    assert results["blocking"] == 1
+    assert other.value == 3
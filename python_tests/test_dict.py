@@ -600,3 +600,18 @@ def test_db0_dict_iterator_type_valid(db0_fixture):
     d = db0.dict()
     it = iter(d)
     assert type(type(it)) is type
+
+def test_db0_dict_key_lookup_follows_python_equality(db0_fixture):
+    d = db0.dict({1: "int", "abc": "str", b"abc": "bytes", None: "none", 42: "other"})
+    assert d[True] == "int"
+    assert d[1.0] == "int"
+    assert d["abc"] == "str"
+    assert d[b"abc"] == "bytes"
+    assert d[None] == "none"
+    assert d[42] == "other"
+    assert "ab" not in d
+    assert b"abcd" not in d
+    assert 0 not in d
+    d[True] = "bool"
+    assert len(d) == 5
+    assert d[1] == "bool"
@@ -273,4 +273,98 @@ def test_get_lambda_source(db0_fixture):
         return db0.get_lambda_source(func)
     
     assert __call(lambda x: x.value) == "x.value"
-    assert __call((lambda x:   x.value % 3), first = "first", second = "second") == "x.value % 3"
\ No newline at end of file
+    assert __call((lambda x:   x.value % 3), first = "first", second = "second") == "x.value % 3"
+
+
+def test_group_by_member_name(db0_fixture):
+    keys = ["one", "two", "three"]
+    objects = []
+    for i in range(10):
+        objects.append(KVTestClass(keys[i % 3], i))
+    
+    db0.tags(*objects).add("tag1")
+    db0.commit()
+    groups = db0.group_by("key", db0.find("tag1"))
+    assert groups == {"one": 4, "two": 3, "three": 3}
+
+
+def test_group_by_member_with_native_ops(db0_fixture):
+    keys = ["one", "two", "three"]
+    objects = []
+    for i in range(10):
+        objects.append(KVTestClass(keys[i % 3], i))
+    
+    db0.tags(*objects).add("tag1")
+    db0.commit()
+    query_ops = (db0.count_op, db0.make_sum("value"), db0.make_min("value"), db0.make_max("value"), db0.make_avg("value"))
+    groups = db0.group_by("key", db0.find("tag1"), ops = query_ops)
+    assert groups["one"] == (4, 18, 0, 9, 4.5)
+    assert groups["two"] == (3, 12, 1, 7, 4.0)
+    assert groups["three"] == (3, 15, 2, 8, 5.0)
+
+
+def test_group_by_tags_and_member(db0_fixture, memo_enum_tags):
+    Colors = memo_enum_tags["Colors"]
+    db0.commit()
+    groups = db0.group_by((Colors.values(), "value"), db0.find(MemoTestClass), ops = (db0.make_sum("value"),))
+    assert len(groups) == 10
+    assert groups[("RED", 0)] == 0
+    assert groups[("GREEN", 4)] == 4
+    assert sum(groups.values()) == 45
+
+
+def test_group_by_native_and_python_results_match(db0_fixture, memo_enum_tags):
+    Colors = memo_enum_tags["Colors"]
+    db0.commit()
+    native = db0.group_by((Colors.values(), "value"), db0.find(MemoTestClass), ops = (db0.count_op, db0.make_sum("value")))
+    python = db0.group_by((Colors.values(), lambda x: x.value), db0.find(MemoTestClass), 
+        ops = (db0.count_op, db0.make_sum(lambda x: x.value)))
+    assert native == python
+
+
+def test_group_by_native_result_is_cached_per_state(db0_fixture):
+    db0.init_fast_query("__fq_native")
+    objects = [KVTestClass(["one", "two"][i % 2], i) for i in range(10)]
+    db0.tags(*objects).add("tag1")
+    db0.commit()
+    query_ops = (db0.count_op, db0.make_max("value"))
+    assert db0.group_by("key", db0.find("tag1"), ops = query_ops) == {"one": (5, 8), "two": (5, 9)}
+    assert db0.group_by("key", db0.find("tag1"), ops = query_ops) == {"one": (5, 8), "two": (5, 9)}
+    cache_keys = db0.fast_query.FastQueryCache(prefix="__fq_native").get_cache_keys()
+    assert len([key for key in cache_keys if key.startswith("native:")]) == 1
+    # the cached result must not be reused over a different state
+    objects[0].value = 100
+    db0.tags(objects[0]).remove("tag1")
+    db0.commit()
+    assert db0.group_by("key", db0.find("tag1"), ops = query_ops) == {"one": (4, 8), "two": (5, 9)}
+
+
+def test_group_by_tags_counts_multi_tagged_objects_once(db0_fixture):
+    db0.init_fast_query("__fq_multi_tag")
+    objects = [KVTestClass(["one", "two"][i % 2], i) for i in range(6)]
+    db0.tags(*objects).add("tag1")
+    db0.tags(*objects[:3]).add("tag2")
+    db0.commit()
+    groups = db0.group_by(["tag1", "tag2"], db0.find(KVTestClass))
+    assert sum(groups.values()) == 6
+    # tags-only counts are not evaluated natively
+    cache_keys = db0.fast_query.FastQueryCache(prefix="__fq_multi_tag").get_cache_keys()
+    assert not any(key.startswith("native:") for key in cache_keys)
+    # native evaluation assigns each object to the first matching tag
+    native = db0.group_by((["tag1", "tag2"], "key"), db0.find(KVTestClass), ops = (db0.count_op, db0.make_sum("value")))
+    assert native == {("tag1", "one"): (3, 6), ("tag1", "two"): (3, 9)}
+    native = db0.group_by((["tag2", "tag1"], "key"), db0.find(KVTestClass), ops = (db0.count_op, db0.make_sum("value")))
+    assert native == {("tag2", "one"): (2, 2), ("tag2", "two"): (1, 1), ("tag1", "one"): (1, 4), ("tag1", "two"): (2, 8)}
+
+
+def test_group_by_native_and_python_paths_reject_none_values(db0_fixture):
+    objects = [KVTestClass(["one", "two"][i % 2], i) for i in range(4)]
+    objects[1].value = None
+    db0.tags(*objects).add("tag1")
+    db0.commit()
+    with pytest.raises(TypeError):
+        db0.group_by("key", db0.find("tag1"), ops = (db0.make_sum("value"),))
+    with pytest.raises(TypeError):
+        db0.group_by(lambda x: x.key, db0.find("tag1"), ops = (db0.make_sum(lambda x: x.value),))
+    with pytest.raises(ValueError):
+        db0.group_by("key", db0.find("tag1"), ops = (db0.make_avg("value"),))
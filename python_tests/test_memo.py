@@ -3,7 +3,7 @@
 
 import pytest
 import dbzero as db0
-from .memo_test_types import MemoTestClass, TriColor, MemoAnyAttrs
+from .memo_test_types import MemoTestClass, TriColor, MemoAnyAttrs, DynamicDataClass
 from dataclasses import dataclass
 
 
@@ -243,4 +243,19 @@ def test_unsupported_types_cannot_be_stored_as_regular_members(db0_fixture):
 def test_memo_class_names_are_not_mangled(db0_fixture):
     obj_1 = MemoTestClass(1)
     assert type(obj_1).__name__ == "MemoTestClass" 
-    
\ No newline at end of file
+    
+
+
+def test_memo_cached_attribute_lookup_follows_new_fields(db0_fixture):
+    import sys
+    name = sys.intern("field_3")
+    obj_1 = DynamicDataClass(3)
+    with pytest.raises(AttributeError):
+        getattr(obj_1, name)
+    # the field is added to the class by another instance
+    obj_2 = DynamicDataClass(5)
+    assert getattr(obj_2, name) == 3
+    setattr(obj_1, name, 7)
+    assert getattr(obj_1, name) == 7
+    assert getattr(obj_1, "".join(name)) == 7
+    assert getattr(obj_2, name) == 3
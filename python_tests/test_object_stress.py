@@ -141,3 +141,34 @@ def test_create_random_objects_with_short_members(db0_fixture):
     buf = []
     for _ in range(append_count):
         buf.append(MemoTestClass(rand_string(32)))
+
+
+@pytest.mark.stress_test
+@pytest.mark.parametrize("field_count", [5, 50, 500])
+def test_memo_getattr_setattr_throughput(db0_no_autocommit, field_count):
+    import sys
+    import time
+    # NOTE: interned names (as in the source code) take the cached field lookup path
+    names = [sys.intern(f'field_{i}') for i in range(field_count)]
+    objects = [DynamicDataClass(field_count) for _ in range(10)]
+    repeat = max(1, 200_000 // (field_count * len(objects)))
+    
+    start = time.perf_counter()
+    for _ in range(repeat):
+        for obj in objects:
+            for name in names:
+                getattr(obj, name)
+    getattr_time = time.perf_counter() - start
+    
+    start = time.perf_counter()
+    for i in range(repeat):
+        for obj in objects:
+            for name in names:
+                setattr(obj, name, i)
+    setattr_time = time.perf_counter() - start
+    
+    ops = repeat * len(objects) * field_count
+    # values written through interned names are visible through non-interned ones
+    for obj in objects:
+        assert all(getattr(obj, "".join(name)) == repeat - 1 for name in names)
+    print(f"{field_count} fields: getattr {ops / getattr_time:,.0f} ops/s, setattr {ops / setattr_time:,.0f} ops/s")
@@ -0,0 +1,55 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+# Copyright (c) 2025 DBZero Software sp. z o.o.
+
+import os
+import glob
+import multiprocessing
+import dbzero as db0
+from .memo_test_types import MemoTestClass, MemoTestSingleton
+from .conftest import DB0_DIR
+
+
+SHARED_CACHE_SIZE = 4 << 20
+
+
+def read_all(prefix_name):
+    db0.open(prefix_name, "r")
+    root = db0.fetch(MemoTestSingleton)
+    assert sum(obj.value for obj in root.value) == sum(range(500))
+    return db0.get_prefix_stats()["cache"]
+
+
+def reader_process(prefix_name, queue):
+    db0.init(DB0_DIR, shared_cache_size=SHARED_CACHE_SIZE)
+    queue.put(read_all(prefix_name))
+    db0.close()
+
+
+def get_shared_segments():
+    return glob.glob(f"/dev/shm/db0-page-cache-{os.getuid()}-*")
+
+
+def test_read_only_pages_served_from_shared_cache(db0_fixture):
+    prefix_name = db0.get_current_prefix().name
+    MemoTestSingleton([MemoTestClass(i) for i in range(500)])
+    db0.commit()
+    db0.close()
+    # 1st reader populates the shared segment, 2nd reader (another process) is served from it
+    db0.init(DB0_DIR, shared_cache_size=SHARED_CACHE_SIZE)
+    stats = read_all(prefix_name)
+    assert stats["shared_cache_misses"] > 0
+    assert len(get_shared_segments()) == 1
+    ctx = multiprocessing.get_context("spawn")
+    queue = ctx.Queue()
+    p = ctx.Process(target=reader_process, args=(prefix_name, queue))
+    p.start()
+    stats = queue.get(timeout=60)
+    p.join()
+    assert p.exitcode == 0
+    assert stats["shared_cache_hits"] > 0
+    assert stats["shared_cache_misses"] == 0
+    # the shared pages are mapped without private copies
+    assert stats["shared_cache_pinned"] > 0
+    # the segment is removed once the last process detaches
+    db0.close()
+    assert get_shared_segments() == []
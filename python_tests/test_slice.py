@@ -57,4 +57,31 @@ def test_slicing_sorted_results(db0_no_autocommit, memo_tags):
         index.add(value, MemoTestClass(value))
     
     sliced = list(x.value for x in index.sort(index.select(), desc = True)[:5])
-    assert sliced == [4192, 313, 99, 99, 33]
\ No newline at end of file
+    assert sliced == [4192, 313, 99, 99, 33]
+
+def test_slicing_sorted_results_by_multiple_criteria(db0_no_autocommit):
+    index_1 = db0.index()
+    index_2 = db0.index()
+    for i in range(50):
+        obj = MemoTestClass(i)
+        db0.tags(obj).add("tag1")
+        index_1.add(i % 4 if i % 7 else None, obj)
+        index_2.add(-i, obj)
+    
+    query = index_1.sort(index_2.sort(db0.find("tag1")))
+    all_items = [x.value for x in query]
+    assert len(all_items) == 50
+    for slice_def in [slice(None, 5), slice(3, 17), slice(10, 40, 3), slice(45, 60)]:
+        assert [x.value for x in query[slice_def]] == all_items[slice_def]
+
+
+def test_deep_slicing_of_large_tag_query(db0_no_autocommit):
+    for i in range(5000):
+        db0.tags(MemoTestClass(i)).add("tag1")
+    
+    query = db0.find("tag1")
+    all_items = [x.value for x in query]
+    assert len(query) == 5000
+    for slice_def in [slice(4000, 4010), slice(1234, None, 7), slice(4990, 6000), slice(6000, 7000)]:
+        assert len(query[slice_def]) == len(all_items[slice_def])
+        assert [x.value for x in query[slice_def]] == all_items[slice_def]
@@ -0,0 +1,35 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+# Copyright (c) 2025 DBZero Software sp. z o.o.
+
+import json
+import dbzero as db0
+from .memo_test_types import MemoTestClass
+
+
+def test_tracing_is_disabled_by_default(db0_fixture):
+    db0.clear_trace()
+    for i in range(10):
+        MemoTestClass(i)
+    db0.commit()
+    assert json.loads(db0.export_trace())["traceEvents"] == []
+
+
+def test_commit_traced_when_enabled(db0_fixture):
+    db0.clear_trace()
+    db0.enable_tracing()
+    try:
+        for i in range(10):
+            MemoTestClass(i)
+        db0.commit()
+    finally:
+        db0.enable_tracing(False)
+    events = json.loads(db0.export_trace())["traceEvents"]
+    names = set(event["name"] for event in events)
+    assert "Fixture::commit" in names
+    assert "PrefixCache::commit" in names
+    assert "BDevStorage::flush" in names
+    for event in events:
+        assert event["ph"] == "X"
+        assert event["dur"] >= 0
+    db0.clear_trace()
+    assert json.loads(db0.export_trace())["traceEvents"] == []
@@ -0,0 +1,78 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+# Copyright (c) 2025 DBZero Software sp. z o.o.
+
+import pytest
+import dbzero as db0
+from .memo_test_types import MemoTestClass, KVTestClass
+
+
+def test_where_filters_find_results(db0_fixture, memo_tags):
+    fields = MemoTestClass.__fields__
+    query = db0.find(MemoTestClass, "tag1", db0.where(fields.value > 5))
+    assert sorted(x.value for x in query) == [6, 7, 8, 9]
+    query = db0.find(MemoTestClass, db0.where(fields.value >= 2, fields.value.ne(4)), "tag2")
+    assert sorted(x.value for x in query) == [2, 6, 8]
+    assert len(db0.find(MemoTestClass, db0.where(fields.value < 0))) == 0
+
+
+def test_where_compares_strings_and_mixed_types(db0_fixture):
+    for key, value in [(1, "open"), (2, "closed"), (3, None), (4, 2.5), (5, True), (6, "open")]:
+        db0.tags(KVTestClass(key, value)).add("kv")
+    fields = KVTestClass.__fields__
+    assert sorted(x.key for x in db0.find(KVTestClass, db0.where(fields.value.eq("open")))) == [1, 6]
+    assert sorted(x.key for x in db0.find(KVTestClass, db0.where(fields.value > "m"))) == [1, 6]
+    assert sorted(x.key for x in db0.find(KVTestClass, db0.where(fields.value.eq(None)))) == [3]
+    assert sorted(x.key for x in db0.find(KVTestClass, db0.where(fields.value.ne(None)))) == [1, 2, 4, 5, 6]
+    # bools & numbers are compared by value, incompatible types never match
+    assert sorted(x.key for x in db0.find(KVTestClass, db0.where(fields.value >= 1))) == [4, 5]
+    assert sorted(x.key for x in db0.find(KVTestClass, db0.where(fields.value.eq(1), fields.key > 0))) == [5]
+
+
+def test_predicates_combined_with_and(db0_fixture, memo_tags):
+    fields = MemoTestClass.__fields__
+    query = db0.find(MemoTestClass, (fields.value > 2) & (fields.value < 5))
+    assert sorted(x.value for x in query) == [3, 4]
+
+
+def test_filter_with_predicate(db0_fixture, memo_tags):
+    fields = MemoTestClass.__fields__
+    assert len(db0.filter(fields.value > 6, db0.find("tag1"))) == 3
+    ix_value = db0.index()
+    for obj in db0.find(MemoTestClass, "tag1"):
+        ix_value.add(obj.value, obj)
+    # sorted queries are filtered as the results are fetched
+    query = db0.filter(fields.value.ne(3), ix_value.sort(db0.find(MemoTestClass)))
+    assert [x.value for x in query] == [0, 1, 2, 4, 5, 6, 7, 8, 9]
+
+
+def test_where_query_serialization(db0_fixture, memo_tags):
+    fields = MemoTestClass.__fields__
+    bytes = db0.serialize(db0.find(MemoTestClass, db0.where(fields.value < 3)))
+    query = db0.deserialize(bytes)
+    assert sorted(x.value for x in query) == [0, 1, 2]
+
+
+def test_field_defs_remain_hashable(db0_fixture, memo_tags):
+    fields = MemoTestClass.__fields__
+    # field defs are used as scopes of the long tags
+    assert hash(fields.value) == hash(fields.value)
+    assert hash((fields.value, "tag1")) == hash((fields.value, "tag1"))
+
+
+def test_field_def_equality_is_not_a_predicate(db0_fixture):
+    fields = MemoTestClass.__fields__
+    # == / != keep the regular object semantics, predicates are built with eq / ne
+    assert (fields.value == 5) is False
+    assert (fields.value != 5) is True
+    assert fields.value == fields.value
+    assert fields.value != KVTestClass.__fields__.value
+    assert fields.value in [fields.value]
+    assert {fields.value: 1}[fields.value] == 1
+
+
+def test_predicate_has_no_truth_value(db0_fixture):
+    fields = MemoTestClass.__fields__
+    with pytest.raises(TypeError):
+        bool(fields.value > 5)
+    with pytest.raises(Exception):
+        fields.value.eq(object())
@@ -355,6 +355,12 @@ namespace db0::python
         // non-persistent attribute names start with _X__ prefix
         return !(attr_name[0] == '_' && attr_name[1] == 'X' && attr_name[2] == '_' && attr_name[3] == '_');
     }
+    
+    // Interned attribute names (e.g. from the source code) are immutable and
+    // can be used as keys of the Class's field lookup cache
+    PyObject *tryGetFieldKey(PyObject *attr) {
+        return (PyUnicode_CheckExact(attr) && PyUnicode_CHECK_INTERNED(attr)) ? attr : nullptr;
+    }
 
     template <typename MemoImplT>
     PyObject *tryMemoObject_getattro(MemoImplT *memo_obj, PyObject *attr)
@@ -374,8 +380,8 @@ namespace db0::python
         bool is_auto_generated = false;
         ObjectSharedPtr member;
         if (isPersistentAttrName(attr_name)) {
-            memo_obj->ext().getFixture()->refreshIfUpdated();
-            member = memo_obj->ext().tryGet(PyUnicode_AsUTF8(attr), &is_auto_generated);
+            PyToolkit::refreshIfUpdated(*memo_obj->ext().getFixture());
+            member = memo_obj->ext().tryGet(attr_name, &is_auto_generated, tryGetFieldKey(attr));
             
             if (member.get() && !is_auto_generated) {
                 return member.steal();
@@ -394,7 +400,7 @@ namespace db0::python
     template <typename MemoImplT>
     PyObject *PyAPI_MemoObject_getattro(MemoImplT *self, PyObject *attr)
     {
-        PY_API_FUNC
+        PY_API_READ_FUNC
         return runSafe(tryMemoObject_getattro<MemoImplT>, self, attr);
     }
     
@@ -425,7 +431,7 @@ namespace db0::python
                 if (maybe_type_id) {
                     if (self->ext().hasInstance()) {
                         db0::FixtureLock lock(self->ext().getFixture());
-                        self->modifyExt().set(lock, attr_name, *maybe_type_id, value);
+                        self->modifyExt().set(lock, attr_name, *maybe_type_id, value, tryGetFieldKey(attr));
                     } else {
                         // considered as a non-mutating operation
                         self->ext().setPreInit(attr_name, *maybe_type_id, value);
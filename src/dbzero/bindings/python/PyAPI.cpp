@@ -25,13 +25,17 @@
 #include <dbzero/bindings/python/types/PyEnum.hpp>
 #include <dbzero/bindings/python/types/PyObjectId.hpp>
 #include <dbzero/bindings/python/types/PyClass.hpp>
+#include <dbzero/bindings/python/types/PyPredicate.hpp>
 #include <dbzero/object_model/object/Object.hpp>
 #include <dbzero/object_model/tags/TagIndex.hpp>
 #include <dbzero/object_model/tags/QueryObserver.hpp>
+#include <dbzero/object_model/tags/PredicateIterator.hpp>
+#include <dbzero/object_model/object/FieldReader.hpp>
 #include <dbzero/workspace/Workspace.hpp>
 #include <dbzero/workspace/Snapshot.hpp>
 #include <dbzero/workspace/PrefixName.hpp>
 #include <dbzero/workspace/Config.hpp>
+#include <dbzero/workspace/ObjectChangeLog.hpp>
 #include <dbzero/core/memory/CacheRecycler.hpp>
 #include <dbzero/core/memory/AccessOptions.hpp>
 #include <dbzero/core/memory/MetaAllocator.hpp>
@@ -39,6 +43,7 @@
 #include <dbzero/core/vspace/v_object.hpp>
 #include <dbzero/core/serialization/Types.hpp>
 #include <dbzero/core/threading/SafeRMutex.hpp>
+#include <dbzero/core/utils/Tracer.hpp>
 
 namespace db0::python
 
@@ -167,7 +172,7 @@ namespace db0::python
         // prefix_name, open_mode, autocommit (bool)
         static const char *kwlist[] = {
             "prefix_name", "open_mode", "autocommit", "slab_size", "lock_flags", "meta_io_step_size", 
-            "page_io_step_size", NULL
+            "page_io_step_size", "storage_flags", NULL
         };
         const char *prefix_name = nullptr;
         const char *open_mode = nullptr;
@@ -176,8 +181,10 @@ namespace db0::python
         PyObject *py_lock_flags = nullptr;
         PyObject *py_meta_io_step_size = nullptr;
         PyObject *py_page_io_step_size = nullptr;
-        if (!PyArg_ParseTupleAndKeywords(args, kwargs, "s|sOOOOO:open", const_cast<char**>(kwlist),
-            &prefix_name, &open_mode, &py_autocommit, &py_slab_size, &py_lock_flags, &py_meta_io_step_size, &py_page_io_step_size))
+        PyObject *py_storage_flags = nullptr;
+        if (!PyArg_ParseTupleAndKeywords(args, kwargs, "s|sOOOOOO:open", const_cast<char**>(kwlist),
+            &prefix_name, &open_mode, &py_autocommit, &py_slab_size, &py_lock_flags, &py_meta_io_step_size, &py_page_io_step_size,
+            &py_storage_flags))
         {
             return NULL;
         }
@@ -208,6 +215,11 @@ namespace db0::python
             PyErr_SetString(PyExc_TypeError, "Invalid argument type: lock_flags");
             return NULL;
         }
+        
+        if (py_storage_flags && !PyDict_Check(py_storage_flags)) {
+            PyErr_SetString(PyExc_TypeError, "Invalid argument type: storage_flags");
+            return NULL;
+        }
 
         std::optional<std::size_t> meta_io_step_size;
         std::optional<std::size_t> page_io_step_size;
@@ -230,7 +242,8 @@ namespace db0::python
 
         auto access_type = open_mode ? parseAccessType(open_mode) : db0::AccessType::READ_WRITE;
         PyToolkit::getPyWorkspace().open(
-            prefix_name, access_type, autocommit, slab_size, py_lock_flags, meta_io_step_size, page_io_step_size
+            prefix_name, access_type, autocommit, slab_size, py_lock_flags, meta_io_step_size, page_io_step_size,
+            py_storage_flags
         );
         Py_RETURN_NONE;
     }
@@ -284,6 +297,8 @@ namespace db0::python
             {"lang_cache_size", []{ return PyLong_FromUnsignedLongLong(LangCache::DEFAULT_CAPACITY); }},
             {"autocommit", []{ Py_RETURN_TRUE; }},
             {"autocommit_interval", []{ return PyLong_FromUnsignedLongLong(Workspace::DEFAULT_AUTOCOMMIT_INTERVAL_MS); }},
+            {"cache_policy", []{ return PyUnicode_FromString("lru"); }},
+            {"shared_cache_size", []{ return PyLong_FromUnsignedLongLong(0); }},
         };
         for (const auto &[key_str, default_fn] : defaults) {
             // Populate default values so then can be easily accessed with get_config
@@ -551,6 +566,118 @@ namespace db0::python
         return runSafe(tryGetStateNum, args, kwargs);
     }
     
+    PyObject *tryWaitDurable(PyObject *args, PyObject *kwargs)
+    {
+        PyObject *py_state_num = nullptr;
+        const char *prefix_name = nullptr;
+        const char * const kwlist[] = {"state_num", "prefix", NULL};
+        if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|Os:wait_durable", const_cast<char**>(kwlist), &py_state_num, &prefix_name)) {
+            return nullptr;
+        }
+        
+        std::optional<StateNumType> state_num;
+        if (py_state_num && py_state_num != Py_None) {
+            if (!PyLong_Check(py_state_num)) {
+                PyErr_SetString(PyExc_TypeError, "wait_durable: state_num must be an integer");
+                return nullptr;
+            }
+            state_num = PyLong_AsUnsignedLong(py_state_num);
+            if (PyErr_Occurred()) {
+                return nullptr;
+            }
+        }
+        
+        auto fixture = getOptionalPrefixFromArg(PyToolkit::getPyWorkspace().getWorkspace(), prefix_name);
+        {
+            // NOTE: the flusher thread does not require the GIL
+            WithGIL_Unlocked no_gil;
+            fixture->getPrefix().getStorage().waitDurable(state_num);
+        }
+        Py_RETURN_NONE;
+    }
+    
+    PyObject *PyAPI_waitDurable(PyObject *, PyObject *args, PyObject *kwargs)
+    {
+        PY_API_FUNC
+        return runSafe(tryWaitDurable, args, kwargs);
+    }
+    
+    const char *getChangeTypeName(db0::ObjectChangeType type)
+    {
+        switch (type) {
+            case db0::ObjectChangeType::CREATED: return "created";
+            case db0::ObjectChangeType::MODIFIED: return "modified";
+            case db0::ObjectChangeType::DELETED: return "deleted";
+        }
+        THROWF(db0::InternalException) << "Invalid object change type: " << static_cast<int>(type) << THROWF_END;
+    }
+    
+    PyObject *tryGetChanges(PyObject *args, PyObject *kwargs)
+    {
+        unsigned long long from_state = 0;
+        PyObject *py_to_state = nullptr;
+        const char *prefix_name = nullptr;
+        const char * const kwlist[] = {"from_state", "to_state", "prefix", NULL};
+        if (!PyArg_ParseTupleAndKeywords(args, kwargs, "K|Os:get_changes", const_cast<char**>(kwlist),
+            &from_state, &py_to_state, &prefix_name))
+        {
+            return nullptr;
+        }
+        
+        auto fixture = getOptionalPrefixFromArg(PyToolkit::getPyWorkspace().getWorkspace(), prefix_name);
+        fixture->refreshIfUpdated();
+        // only committed (finalized) changes are reported
+        StateNumType to_state = fixture->getPrefix().getStateNum(true);
+        if (py_to_state && py_to_state != Py_None) {
+            if (!PyLong_Check(py_to_state)) {
+                PyErr_SetString(PyExc_TypeError, "get_changes: to_state must be an integer");
+                return nullptr;
+            }
+            auto state_num = PyLong_AsUnsignedLongLong(py_to_state);
+            if (PyErr_Occurred()) {
+                return nullptr;
+            }
+            to_state = std::min<StateNumType>(to_state, state_num);
+        }
+        
+        // NOTE: read-only fixtures open a transient view of the persisted log
+        std::unique_ptr<db0::ObjectChangeLog> change_log;
+        auto change_log_ptr = fixture->tryGetChangeLog();
+        if (!change_log_ptr) {
+            auto address = fixture->getObjectCatalogue().tryFindUnique<db0::ObjectChangeLog>();
+            if (!address) {
+                THROWF(db0::InputException) << "Change log is not enabled for prefix: " 
+                    << fixture->getPrefix().getName() << THROWF_END;
+            }
+            change_log = std::make_unique<db0::ObjectChangeLog>(fixture, *address);
+            change_log_ptr = change_log.get();
+        }
+        
+        // return as a list of (state number, change type, UUID) tuples
+        auto py_list = Py_OWN(PyList_New(0));
+        ObjectId object_id;
+        object_id.m_fixture_uuid = fixture->getUUID();
+        char buffer[ObjectId::maxEncodedSize() + 1];
+        change_log_ptr->forEach(from_state, to_state, [&](const db0::ObjectChange &change) {
+            object_id.m_address = change.m_address;
+            object_id.m_storage_class = change.m_storage_class;
+            object_id.toBase32(buffer);
+            auto py_tuple = Py_OWN(PySafeTuple_Pack(Py_OWN(PyLong_FromUnsignedLongLong(change.m_state_num)),
+                Py_OWN(PyUnicode_FromString(getChangeTypeName(change.m_type))),
+                Py_OWN(PyUnicode_FromString(buffer)))
+            );
+            PySafeList_Append(*py_list, py_tuple);
+            return true;
+        });
+        return py_list.steal();
+    }
+    
+    PyObject *PyAPI_getChanges(PyObject *, PyObject *args, PyObject *kwargs)
+    {
+        PY_API_FUNC
+        return runSafe(tryGetChanges, args, kwargs);
+    }
+    
     PyObject *getPrefixStats(PyObject *self, PyObject *args, PyObject *kwargs)
     {
         PY_API_FUNC
@@ -677,6 +804,41 @@ namespace db0::python
 #endif  
         return PyUnicode_FromString(str_flags.str().c_str());
     }
+    
+    // NOTE: tracing functions don't access the workspace, therefore the API lock is not acquired
+    PyObject *PyAPI_enableTracing(PyObject *, PyObject *const *args, Py_ssize_t nargs)
+    {
+        if (nargs > 1) {
+            PyErr_SetString(PyExc_TypeError, "enable_tracing takes at most 1 argument");
+            return NULL;
+        }
+        bool enabled = true;
+        if (nargs == 1) {
+            auto result = PyObject_IsTrue(args[0]);
+            if (result < 0) {
+                return NULL;
+            }
+            enabled = result;
+        }
+        db0::Tracer::enable(enabled);
+        Py_RETURN_NONE;
+    }
+    
+    PyObject *PyAPI_clearTrace(PyObject *, PyObject *)
+    {
+        db0::Tracer::clear();
+        Py_RETURN_NONE;
+    }
+    
+    PyObject *tryExportTrace()
+    {
+        auto json = db0::Tracer::exportChromeTrace();
+        return PyUnicode_FromStringAndSize(json.data(), json.size());
+    }
+    
+    PyObject *PyAPI_exportTrace(PyObject *, PyObject *) {
+        return runSafe(tryExportTrace);
+    }
         
     template <> db0::object_model::StorageClass getStorageClass<MemoObject>() {
         return db0::object_model::StorageClass::OBJECT_REF;
@@ -778,6 +940,46 @@ namespace db0::python
         return PyBool_fromBool(PyEnumValue_Check(args[0]) || PyEnumValueRepr_Check(args[0]));
     }
     
+    PyObject *tryFilterByPredicate(const db0::object_model::Predicate &predicate, PyObject *py_query)
+    {
+        using ObjectIterator = db0::object_model::ObjectIterator;
+        using FieldReader = db0::object_model::FieldReader;
+        using QueryObserver = db0::object_model::QueryObserver;
+        
+        if (!PyObjectIterable_Check(py_query)) {
+            THROWF(db0::InputException) << "Invalid query object";
+        }
+        
+        auto &iter = reinterpret_cast<PyObjectIterable*>(py_query)->modifyExt();
+        auto py_iter = PyObjectIterableDefault_new();
+        if (!iter.isNull() && !iter.isSorted() && !iter.isSliced()) {
+            // evaluate natively as a part of the full-text query
+            std::vector<std::unique_ptr<QueryObserver> > query_observers;
+            auto query = iter.beginFTQuery(query_observers, -1);
+            auto fixture = iter.getFixture();
+            py_iter->makeNew(iter, std::make_unique<db0::object_model::PredicateIterator>(
+                fixture, std::move(query), predicate), std::move(query_observers), iter.getFilters()
+            );
+            return py_iter.steal();
+        }
+        
+        // evaluate with the already fetched objects (e.g. to preserve the sort order)
+        std::vector<ObjectIterator::FilterFunc> filters;
+        auto reader = std::make_shared<FieldReader>(predicate.getFieldNames());
+        filters.push_back([reader, predicate](PyObject *py_item) {
+            if (!PyMemo_Check<MemoObject>(py_item)) {
+                return false;
+            }
+            auto &memo_obj = reinterpret_cast<MemoObject*>(py_item)->ext();
+            auto fixture = memo_obj.getFixture();
+            std::vector<std::pair<db0::object_model::StorageClass, db0::object_model::Value> > values(
+                predicate.getComparisons().size());
+            return reader->read(fixture, memo_obj.getAddress(), values) && predicate.evaluate(*fixture, values);
+        });
+        py_iter->makeNew(iter, filters);
+        return py_iter.steal();
+    }
+    
     PyObject *tryFilterBy(PyObject *args, PyObject *kwargs)
     {
         using ObjectIterator = db0::object_model::ObjectIterator;
@@ -792,6 +994,10 @@ namespace db0::python
             return nullptr;
         }
 
+        if (PyPredicate_Check(py_filter)) {
+            return tryFilterByPredicate(reinterpret_cast<PyPredicate*>(py_filter)->ext(), py_query);
+        }
+
         // py_filter must be a python callable
         if (!PyCallable_Check(py_filter)) {
             THROWF(db0::InputException) << "Invalid filter object";
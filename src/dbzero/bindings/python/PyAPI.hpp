@@ -89,6 +89,14 @@ namespace db0::python
     */
     PyObject *PyAPI_getStateNum(PyObject *self, PyObject *args, PyObject *kwargs);
     
+    /**
+     * Block until a specific state (or all committed states) of a prefix is durable
+     * only relevant for prefixes opened with storage_flags={"pipelined_commit": True}
+    */
+    PyObject *PyAPI_waitDurable(PyObject *self, PyObject *args, PyObject *kwargs);
+    // Retrieve objects created / modified / deleted within the range of states (requires change_log storage flag)
+    PyObject *PyAPI_getChanges(PyObject *self, PyObject *args, PyObject *kwargs);
+    
     /**
      * Retrieve metrics of all active dbzero prefixes
     */
@@ -115,6 +123,12 @@ namespace db0::python
 
     PyObject *PyAPI_getBuildFlags(PyObject *self, PyObject *args);
     
+    // Runtime switch of the trace points (see db0::Tracer)
+    PyObject *PyAPI_enableTracing(PyObject *, PyObject *const *args, Py_ssize_t nargs);
+    PyObject *PyAPI_clearTrace(PyObject *self, PyObject *args);
+    // Export recorded trace events as Chrome trace / Perfetto JSON string
+    PyObject *PyAPI_exportTrace(PyObject *self, PyObject *args);
+    
     PyObject *PyAPI_makeEnum(PyObject *, PyObject *args, PyObject *kwargs);
     
     // implements db0.filter functionality
@@ -986,7 +986,8 @@ namespace db0::python
         }
         
         try {
-            BDevStorage::create(output_file_name, src_storage.getPageSize(), src_storage.getDRAMPageSize(), page_io_step_size);
+            BDevStorage::create(output_file_name, src_storage.getPageSize(), src_storage.getDRAMPageSize(), page_io_step_size,
+                src_storage.getPageCodecType());
             BDevStorage out(output_file_name, db0::AccessType::READ_WRITE);
             // copy entire prefix
             src_storage.copyTo(out);
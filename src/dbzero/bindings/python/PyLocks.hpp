@@ -6,6 +6,8 @@
 #include <Python.h>
 
 #define PY_API_FUNC auto __api_lock = db0::python::PyToolkit::lockPyApi();
+// read-only API functions (the API lock is taken in shared mode)
+#define PY_API_READ_FUNC auto __api_lock = db0::python::PyToolkit::lockPyApiShared();
 
 namespace db0::python
 
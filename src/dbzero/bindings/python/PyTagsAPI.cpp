@@ -6,11 +6,15 @@
 #include "PySnapshot.hpp"
 #include <dbzero/object_model/tags/SplitIterator.hpp>
 #include <dbzero/object_model/tags/TagIndex.hpp>
+#include <dbzero/object_model/tags/GroupBy.hpp>
+#include <dbzero/object_model/tags/PredicateIterator.hpp>
+#include <dbzero/object_model/value/Member.hpp>
 #include <dbzero/bindings/python/iter/PyObjectIterable.hpp>
 #include <dbzero/bindings/python/iter/PyObjectIterator.hpp>
 #include <dbzero/bindings/python/iter/PyJoinIterable.hpp>
 #include <dbzero/bindings/python/iter/PyJoinIterator.hpp>
 #include <dbzero/bindings/python/types/PyEnum.hpp>
+#include <dbzero/bindings/python/types/PyPredicate.hpp>
 #include <dbzero/object_model/tags/SelectModified.hpp>
 #include <dbzero/workspace/Snapshot.hpp>
 #include <dbzero/workspace/Workspace.hpp>
@@ -26,17 +30,36 @@ namespace db0::python
         using TagIndex = db0::object_model::TagIndex;
         using Class = db0::object_model::Class;
         
+        // predicates (see db0.where) are evaluated natively while iterating the query
+        std::vector<PyObject*> tag_args;
+        std::optional<db0::object_model::Predicate> predicate;
+        for (Py_ssize_t i = 0; i < nargs; ++i) {
+            if (PyPredicate_Check(args[i])) {
+                if (!predicate) {
+                    predicate.emplace();
+                }
+                predicate->append(reinterpret_cast<PyPredicate*>(args[i])->ext());
+            } else {
+                tag_args.push_back(args[i]);
+            }
+        }
+
         std::vector<PyObject*> find_args;
         bool no_result = false;
         std::shared_ptr<Class> type;
         PyTypeObject *lang_type = nullptr;
         auto fixture = db0::object_model::getFindParams(
-            snapshot, args, nargs, find_args, type, lang_type, no_result, prefix_name
+            snapshot, tag_args.data(), tag_args.size(), find_args, type, lang_type, no_result, prefix_name
         );
         fixture->refreshIfUpdated();
         auto &tag_index = fixture->get<TagIndex>();
         std::vector<std::unique_ptr<db0::object_model::QueryObserver> > query_observers;
         auto query_iterator = tag_index.find(find_args.data(), find_args.size(), type, query_observers, no_result);
+        if (query_iterator && predicate) {
+            query_iterator = std::make_unique<db0::object_model::PredicateIterator>(
+                fixture, std::move(query_iterator), *predicate
+            );
+        }
         auto iter_obj = PyObjectIterableDefault_new();
         iter_obj->makeNew(fixture, std::move(query_iterator), type, lang_type, std::move(query_observers));
         if (context) {
@@ -90,6 +113,147 @@ namespace db0::python
         return runSafe(trySplitBy, py_tags, py_query, exclusive);
     } 
     
+    using GroupBy = db0::object_model::GroupBy;
+    using GroupState = db0::object_model::GroupState;
+    using AggregateOp = db0::object_model::AggregateOp;
+    
+    AggregateOp parseAggregateOp(const char *op_name)
+    {
+        static const std::unordered_map<std::string, AggregateOp> ops {
+            { "count", AggregateOp::COUNT }, { "sum", AggregateOp::SUM }, { "min", AggregateOp::MIN },
+            { "max", AggregateOp::MAX }, { "avg", AggregateOp::AVG }
+        };
+        auto it = ops.find(op_name);
+        if (it == ops.end()) {
+            THROWF(db0::InputException) << "Unsupported aggregate op: " << op_name << THROWF_END;
+        }
+        return it->second;
+    }
+    
+    shared_py_object<PyObject*> getAggregateResult(AggregateOp op, const GroupState &group, unsigned int index)
+    {
+        auto &state = group.m_states[index];
+        switch (op) {
+            case AggregateOp::COUNT:
+                return Py_OWN(PyLong_FromUnsignedLongLong(group.m_count));
+            case AggregateOp::SUM:
+                return state.m_is_real ? Py_OWN(PyFloat_FromDouble(state.getReal())) : Py_OWN(PyLong_FromLongLong(state.m_int));
+            case AggregateOp::MIN:
+            case AggregateOp::MAX: {
+                if (!state.m_count) {
+                    return Py_BORROW(Py_None);
+                }
+                return state.m_is_real ? Py_OWN(PyFloat_FromDouble(state.m_real)) : Py_OWN(PyLong_FromLongLong(state.m_int));
+            }
+            case AggregateOp::AVG: {
+                if (!state.m_count) {
+                    return Py_BORROW(Py_None);
+                }
+                return Py_OWN(PyFloat_FromDouble(state.getReal() / state.m_count));
+            }
+        }
+        return Py_BORROW(Py_None);
+    }
+    
+    PyObject *tryGroupBy(PyObject *py_query, PyObject *py_criteria, PyObject *py_ops)
+    {
+        if (!PyObjectIterable_Check(py_query) || !PyTuple_Check(py_criteria) || !PyTuple_Check(py_ops)) {
+            THROWF(db0::InputException) << "Invalid argument type";
+        }
+        
+        auto &iter = reinterpret_cast<PyObjectIterable*>(py_query)->modifyExt();
+        // sorted, sliced, filtered or decorated (e.g. split) queries must be evaluated by the caller
+        if (iter.isSorted() || iter.isSliced() || !iter.getFilters().empty()) {
+            Py_RETURN_NONE;
+        }
+        std::vector<std::unique_ptr<QueryObserver> > query_observers;
+        auto query = iter.beginFTQuery(query_observers, -1);
+        if (!query_observers.empty()) {
+            Py_RETURN_NONE;
+        }
+        
+        auto fixture = iter.getFixture();
+        auto &tag_index = fixture->get<db0::object_model::TagIndex>();
+        GroupBy group_by(fixture, std::move(query));
+        // criteria are either field names or lists of tags
+        for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(py_criteria); ++i) {
+            auto py_item = PyTuple_GET_ITEM(py_criteria, i);
+            if (PyUnicode_Check(py_item)) {
+                group_by.addFieldGroup(PyUnicode_AsUTF8(py_item));
+            } else {
+                group_by.addTagGroups(tag_index.makeIterators(py_item));
+            }
+        }
+        // ops as (op name, field name or None)
+        for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(py_ops); ++i) {
+            auto py_item = PyTuple_GET_ITEM(py_ops, i);
+            if (!PyTuple_Check(py_item) || PyTuple_GET_SIZE(py_item) != 2 || !PyUnicode_Check(PyTuple_GET_ITEM(py_item, 0))) {
+                THROWF(db0::InputException) << "Invalid aggregate op definition";
+            }
+            auto py_field = PyTuple_GET_ITEM(py_item, 1);
+            group_by.addOp(parseAggregateOp(PyUnicode_AsUTF8(PyTuple_GET_ITEM(py_item, 0))), 
+                PyUnicode_Check(py_field) ? PyUnicode_AsUTF8(py_field) : ""
+            );
+        }
+        
+        if (!group_by.evaluate()) {
+            // unable to evaluate natively (e.g. non-scalar values)
+            Py_RETURN_NONE;
+        }
+        
+        // convert group keys, equal keys of different storage classes (e.g. 1 and 1.0) are merged
+        auto &ops = group_by.getOps();
+        auto py_index = Py_OWN(PyDict_New());
+        std::vector<std::pair<shared_py_object<PyObject*>, GroupState*> > groups;
+        for (auto &[key, group]: group_by.getGroups()) {
+            auto py_key = Py_OWN(PyTuple_New(key.size()));
+            for (unsigned int i = 0; i < key.size(); ++i) {
+                if (group_by.isTagGroup(i)) {
+                    PySafeTuple_SetItem(*py_key, i, Py_OWN(PyLong_FromUnsignedLongLong(key[i].m_value.m_store)));
+                } else {
+                    PySafeTuple_SetItem(*py_key, i, db0::object_model::unloadMember<PyToolkit>(
+                        fixture, key[i].m_storage_class, key[i].m_value)
+                    );
+                }
+            }
+            auto py_pos = PyDict_GetItemWithError(*py_index, *py_key);
+            if (py_pos) {
+                auto &target = *groups[PyLong_AsSize_t(py_pos)].second;
+                target.m_count += group.m_count;
+                for (unsigned int i = 0; i < ops.size(); ++i) {
+                    target.m_states[i].merge(ops[i], group.m_states[i]);
+                }
+                continue;
+            }
+            if (PyErr_Occurred() || PyDict_SetItem(*py_index, *py_key, *Py_OWN(PyLong_FromSize_t(groups.size()))) < 0) {
+                return nullptr;
+            }
+            groups.emplace_back(py_key, &group);
+        }
+        
+        auto py_result = Py_OWN(PyDict_New());
+        for (auto &[py_key, group]: groups) {
+            auto py_values = Py_OWN(PyTuple_New(ops.size()));
+            for (unsigned int i = 0; i < ops.size(); ++i) {
+                PySafeTuple_SetItem(*py_values, i, getAggregateResult(ops[i], *group, i));
+            }
+            if (PyDict_SetItem(*py_result, *py_key, *py_values) < 0) {
+                return nullptr;
+            }
+        }
+        return py_result.steal();
+    }
+    
+    PyObject *PyAPI_groupBy(PyObject *, PyObject *const *args, Py_ssize_t nargs)
+    {
+        PY_API_FUNC
+        if (nargs != 3) {
+            PyErr_SetString(PyExc_TypeError, "_group_by requires exactly 3 arguments");
+            return NULL;
+        }
+        return runSafe(tryGroupBy, args[0], args[1], args[2]);
+    }
+    
     PyObject *trySelectModCandidates(const ObjectIterable &iterable, StateNumType from_state,
         std::optional<StateNumType> to_state)
     {
@@ -51,6 +51,9 @@ namespace db0::python
 
     PyObject *PyAPI_splitBySnapshots(PyObject *, PyObject *const *args, Py_ssize_t nargs);
     
+    // Native group-by / aggregation (query, criteria, ops) or None if the query must be evaluated by the caller
+    PyObject *PyAPI_groupBy(PyObject *, PyObject *const *args, Py_ssize_t nargs);
+    
     // convert a db0::serial::Serializable to bytes
     PyObject *PyAPI_serialize(PyObject *, PyObject *const *args, Py_ssize_t nargs);
     
@@ -10,6 +10,7 @@
 #include <dbzero/bindings/python/collections/PyTuple.hpp>
 #include <dbzero/bindings/python/collections/PyIndex.hpp>
 #include <dbzero/bindings/python/collections/PyByteArray.hpp>
+#include <dbzero/bindings/python/collections/PyArray.hpp>
 #include <dbzero/bindings/python/collections/PySet.hpp>
 #include <dbzero/bindings/python/collections/PyWeakSet.hpp>
 #include <dbzero/bindings/python/collections/PyDict.hpp>
@@ -430,6 +431,23 @@ namespace db0::python
         }
         return shared_py_cast<PyObject*>(std::move(byte_array_object));
     }
+
+    PyToolkit::ObjectSharedPtr PyToolkit::unloadArray(db0::swine_ptr<Fixture> fixture,
+        Address address, AccessFlags access_mode)
+    {
+        auto &lang_cache = fixture->getLangCache();
+        auto object_ptr = lang_cache.get(address);
+        if (object_ptr.get()) {
+            return object_ptr;
+        }
+
+        auto array_object = ArrayDefaultObject_new();
+        array_object->unload(fixture, address, access_mode);
+        if (!array_object->ext().isNoCache()) {
+            lang_cache.add(address, array_object.get());
+        }
+        return shared_py_cast<PyObject*>(std::move(array_object));
+    }
     
     PyToolkit::ObjectSharedPtr PyToolkit::unloadIndex(db0::swine_ptr<Fixture> fixture,
         Address address, std::uint16_t, AccessFlags access_mode)
@@ -912,6 +930,13 @@ namespace db0::python
             return SafeRLock(m_api_mutex);
         }
 
+        // fast path: the uncontended mutex is taken without handing over the GIL,
+        // which would otherwise force a GIL switch on every API call made from a multi-threaded program
+        SafeRLock fast_lock(SafeRLock::tag_try_lock(), m_api_mutex);
+        if (fast_lock.owns_lock()) {
+            return fast_lock;
+        }
+
         // unlock GIL while waiting for the API mutex
         PyThreadState *__save = PyEval_SaveThread();
         auto result = SafeRLock(m_api_mutex);
@@ -920,6 +945,38 @@ namespace db0::python
         return result;
     }
 
+    SafeRSharedLock PyToolkit::lockPyApiShared()
+    {
+        if (m_api_mutex.isOwnedByThisThread() || m_api_mutex.isSharedByThisThread()) {
+            // already locked by this thread
+            return {};
+        }
+        
+        if (!Py_IsInitialized()) {
+            return SafeRSharedLock(m_api_mutex);
+        }
+        
+        SafeRSharedLock fast_lock(SafeRSharedLock::tag_try_lock(), m_api_mutex);
+        if (fast_lock.owns_lock()) {
+            return fast_lock;
+        }
+        
+        // unlock GIL while waiting for the API mutex
+        PyThreadState *__save = PyEval_SaveThread();
+        auto result = SafeRSharedLock(m_api_mutex);
+        PyEval_RestoreThread(__save);
+        return result;
+    }
+    
+    bool PyToolkit::refreshIfUpdated(Fixture &fixture)
+    {
+        if (!fixture.isRefreshPending()) {
+            return false;
+        }
+        auto lock = lockPyApi();
+        return fixture.refreshIfUpdated();
+    }
+    
     PyToolkit::TypeObjectPtr PyToolkit::getBaseType(TypeObjectPtr py_object) {
         return py_object->tp_base;
     }
@@ -144,6 +144,7 @@ namespace db0::python
             std::vector<std::byte>::const_iterator end);
         
         static ObjectSharedPtr unloadByteArray(db0::swine_ptr<Fixture>, Address, AccessFlags = {});
+        static ObjectSharedPtr unloadArray(db0::swine_ptr<Fixture>, Address, AccessFlags = {});
         
         // Creates a new Python instance of EnumValue
         static ObjectSharedPtr makeEnumValue(const EnumValue &);
@@ -253,6 +254,11 @@ namespace db0::python
         static SafeRLock lockApi();
         // locks API from a Python context (releases GIL while waiting for the lock)
         static SafeRLock lockPyApi();
+        // locks API in shared mode for read-only operations (concurrent readers do not block each other)
+        static SafeRSharedLock lockPyApiShared();
+        // Refresh the read-only fixture if updated by other processes
+        // NOTE: the refresh is a structural change, a shared API lock is upgraded to exclusive for its duration
+        static bool refreshIfUpdated(Fixture &);
 
         // return base type of TypeObject
         static TypeObjectPtr getBaseType(TypeObjectPtr py_object);
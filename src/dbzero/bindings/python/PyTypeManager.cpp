@@ -14,6 +14,7 @@
 #include <dbzero/bindings/python/collections/PyDict.hpp>
 #include <dbzero/bindings/python/collections/PyIndex.hpp>
 #include <dbzero/bindings/python/collections/PyByteArray.hpp>
+#include <dbzero/bindings/python/collections/PyArray.hpp>
 #include <dbzero/bindings/python/iter/PyObjectIterable.hpp>
 #include <dbzero/bindings/python/iter/PyObjectIterator.hpp>
 #include <dbzero/bindings/python/PyTagSet.hpp>
@@ -95,6 +96,7 @@ namespace db0::python
         addStaticdbzeroType(&PyObjectIterableType, TypeId::OBJECT_ITERABLE);
         addStaticdbzeroType(&PyObjectIteratorType, TypeId::OBJECT_ITERATOR);
         addStaticdbzeroType(&ByteArrayObjectType, TypeId::DB0_BYTES_ARRAY);
+        addStaticdbzeroType(&ArrayObjectType, TypeId::DB0_ARRAY);
         addStaticdbzeroType(&PyEnumType, TypeId::DB0_ENUM);
         addStaticdbzeroType(&PyEnumValueType, TypeId::DB0_ENUM_VALUE);
         addStaticdbzeroType(&PyEnumValueReprType, TypeId::DB0_ENUM_VALUE_REPR);
@@ -310,6 +312,14 @@ namespace db0::python
         return reinterpret_cast<db0::python::ByteArrayObject*>(py_obj)->modifyExt();
     }
 
+    db0::object_model::Array &PyTypeManager::extractMutableArray(ObjectPtr py_obj) const
+    {
+        if (!ArrayObject_Check(py_obj)) {
+            THROWF(db0::InputException) << "Expected a db0.Array object" << THROWF_END;
+        }
+        return reinterpret_cast<db0::python::ArrayObject*>(py_obj)->modifyExt();
+    }
+
     const db0::object_model::Tuple &PyTypeManager::extractTuple(ObjectPtr memo_ptr) const
     {
         if (!TupleObject_Check(memo_ptr)) {
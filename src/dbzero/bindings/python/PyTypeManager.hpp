@@ -42,6 +42,7 @@ namespace db0::object_model {
     struct FieldDef;
     class TagDef;
     class ByteArray;
+    class Array;
     class PyWeakProxy;
     
 }
@@ -87,6 +88,7 @@ namespace db0::python
         using Class = db0::object_model::Class;
         using TagDef = db0::object_model::TagDef;
         using ByteArray = db0::object_model::ByteArray;
+        using Array = db0::object_model::Array;
 
         PyTypeManager();
         ~PyTypeManager();
@@ -152,6 +154,7 @@ namespace db0::python
         std::shared_ptr<const Class> extractConstClass(ObjectPtr py_class) const;
         const TagDef &extractTag(ObjectPtr py_tag) const;
         ByteArray &extractMutableByteArray(ObjectPtr) const;
+        Array &extractMutableArray(ObjectPtr) const;
         
         ObjectPtr getBadPrefixError() const;
         ObjectPtr getClassNotFoundError() const;
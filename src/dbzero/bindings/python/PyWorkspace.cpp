@@ -5,6 +5,7 @@
 #include <dbzero/workspace/Workspace.hpp>
 #include <dbzero/workspace/PrefixName.hpp>
 #include <dbzero/workspace/Config.hpp>
+#include <dbzero/workspace/StorageConfig.hpp>
 #include <dbzero/object_model/ObjectModel.hpp>
 #include <dbzero/object_model/object.hpp>
 #include <dbzero/core/exception/Exceptions.hpp>
@@ -33,21 +34,26 @@ namespace db0::python
     
     void PyWorkspace::open(const std::string &prefix_name, AccessType access_type, std::optional<bool> autocommit,
         std::optional<std::size_t> slab_size, ObjectPtr py_lock_flags, std::optional<std::size_t> meta_io_step_size,
-        std::optional<std::size_t> page_io_step_size)
+        std::optional<std::size_t> page_io_step_size, ObjectPtr py_storage_flags)
     {
         if (!m_workspace) {
             // initialize dbzero with current working directory
             initWorkspace("");
         }
         
+        db0::StorageFlags storage_flags;
+        if (py_storage_flags) {
+            storage_flags = db0::getStorageFlags(db0::Config(py_storage_flags));
+        }
+        
         if (py_lock_flags) {
             db0::Config lock_flags_config(py_lock_flags);
             m_workspace->open(prefix_name, access_type, autocommit, slab_size, 
-                lock_flags_config, meta_io_step_size, page_io_step_size
+                lock_flags_config, meta_io_step_size, page_io_step_size, storage_flags
             );
         } else {
             m_workspace->open(prefix_name, access_type, autocommit, slab_size, 
-                {}, meta_io_step_size, page_io_step_size
+                {}, meta_io_step_size, page_io_step_size, storage_flags
             );
         }
     }
@@ -64,10 +64,12 @@ namespace db0::python
          * a newly opened read/write prefix becomes the default one
          * @param slab_size will only have effect for a newly created prefixes
          * @param page_io_step_size parameter only respected for newly created prefixes
+         * @param storage_flags optional dict with per-prefix storage options
         */
         void open(const std::string &prefix_name, AccessType, std::optional<bool> autocommit = {},
             std::optional<std::size_t> slab_size = {}, ObjectPtr lock_flags = nullptr, 
-            std::optional<std::size_t> meta_io_step_size = {}, std::optional<std::size_t> page_io_step_size = {}
+            std::optional<std::size_t> meta_io_step_size = {}, std::optional<std::size_t> page_io_step_size = {},
+            ObjectPtr storage_flags = nullptr
         );
         
         db0::Workspace &getWorkspace() const;
@@ -104,28 +104,28 @@ namespace db0::python
     template <typename ObjectT>
     PyObject *tryObjectT_GetItem(ObjectT *py_obj, Py_ssize_t i)
     {        
-        py_obj->ext().getFixture()->refreshIfUpdated();
+        PyToolkit::refreshIfUpdated(*py_obj->ext().getFixture());
         return py_obj->ext().getItem(i).steal();
     }
 
     template <typename ObjectT>
     PyObject *PyAPI_ObjectT_GetItem(ObjectT *py_obj, Py_ssize_t i)
     {
-        PY_API_FUNC
+        PY_API_READ_FUNC
         return runSafe(tryObjectT_GetItem<ObjectT>, py_obj, i);
     }
 
     template<typename ObjectT>
     Py_ssize_t tryObjectT_len(ObjectT *py_obj)
     {        
-        py_obj->ext().getFixture()->refreshIfUpdated();
+        PyToolkit::refreshIfUpdated(*py_obj->ext().getFixture());
         return py_obj->ext().size();
     }
 
     template<typename ObjectT>
     Py_ssize_t PyAPI_ObjectT_len(ObjectT *py_obj)
     {
-        PY_API_FUNC
+        PY_API_READ_FUNC
         return runSafe(tryObjectT_len<ObjectT>, py_obj);
     }
 
@@ -0,0 +1,704 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#include "PyArray.hpp"
+#include <cstring>
+#include <limits>
+#include <dbzero/object_model/array/Array.hpp>
+#include <dbzero/workspace/Fixture.hpp>
+#include <dbzero/workspace/Workspace.hpp>
+#include <dbzero/bindings/python/Utils.hpp>
+#include <dbzero/bindings/python/PyInternalAPI.hpp>
+#include <dbzero/bindings/python/PySafeAPI.hpp>
+
+namespace db0::python
+
+{
+
+    using Array = db0::object_model::Array;
+    using ArrayType = db0::object_model::ArrayType;
+    using ObjectSharedPtr = PyTypes::ObjectSharedPtr;
+
+    // Convert a Python number into the raw item representation
+    template <typename T> bool toIntItem(PyObject *py_value, std::byte *item)
+    {
+        T result;
+        if constexpr (std::numeric_limits<T>::is_signed) {
+            auto value = PyLong_AsLongLong(py_value);
+            if (value == -1 && PyErr_Occurred()) {
+                return false;
+            }
+            if (value < std::numeric_limits<T>::min() || value > std::numeric_limits<T>::max()) {
+                PyErr_SetString(PyExc_OverflowError, "value out of range for the array type");
+                return false;
+            }
+            result = static_cast<T>(value);
+        } else {
+            // NOTE: PyLong_AsUnsignedLongLong does not accept objects implementing __index__ only
+            auto py_int = Py_OWN(PyNumber_Index(py_value));
+            if (!py_int) {
+                return false;
+            }
+            auto value = PyLong_AsUnsignedLongLong(*py_int);
+            if (value == (unsigned long long)-1 && PyErr_Occurred()) {
+                return false;
+            }
+            if (value > std::numeric_limits<T>::max()) {
+                PyErr_SetString(PyExc_OverflowError, "value out of range for the array type");
+                return false;
+            }
+            result = static_cast<T>(value);
+        }
+        std::memcpy(item, &result, sizeof(T));
+        return true;
+    }
+
+    bool toItem(ArrayType type, PyObject *py_value, std::byte *item)
+    {
+        switch (type) {
+            case ArrayType::INT8: return toIntItem<std::int8_t>(py_value, item);
+            case ArrayType::INT16: return toIntItem<std::int16_t>(py_value, item);
+            case ArrayType::INT32: return toIntItem<std::int32_t>(py_value, item);
+            case ArrayType::INT64: return toIntItem<std::int64_t>(py_value, item);
+            case ArrayType::UINT8: return toIntItem<std::uint8_t>(py_value, item);
+            case ArrayType::UINT16: return toIntItem<std::uint16_t>(py_value, item);
+            case ArrayType::UINT32: return toIntItem<std::uint32_t>(py_value, item);
+            case ArrayType::UINT64: return toIntItem<std::uint64_t>(py_value, item);
+            case ArrayType::FLOAT32:
+            case ArrayType::FLOAT64: {
+                auto value = PyFloat_AsDouble(py_value);
+                if (value == -1.0 && PyErr_Occurred()) {
+                    return false;
+                }
+                if (type == ArrayType::FLOAT32) {
+                    auto fvalue = static_cast<float>(value);
+                    std::memcpy(item, &fvalue, sizeof(float));
+                } else {
+                    std::memcpy(item, &value, sizeof(double));
+                }
+                return true;
+            }
+            default:
+                THROWF(db0::InputException) << "Invalid array type: " << (int)type << THROWF_END;
+        }
+    }
+
+    template <typename T> T readItem(const std::byte *item)
+    {
+        T result;
+        std::memcpy(&result, item, sizeof(T));
+        return result;
+    }
+
+    PyObject *fromItem(ArrayType type, const std::byte *item)
+    {
+        switch (type) {
+            case ArrayType::INT8: return PyLong_FromLong(readItem<std::int8_t>(item));
+            case ArrayType::INT16: return PyLong_FromLong(readItem<std::int16_t>(item));
+            case ArrayType::INT32: return PyLong_FromLong(readItem<std::int32_t>(item));
+            case ArrayType::INT64: return PyLong_FromLongLong(readItem<std::int64_t>(item));
+            case ArrayType::UINT8: return PyLong_FromUnsignedLong(readItem<std::uint8_t>(item));
+            case ArrayType::UINT16: return PyLong_FromUnsignedLong(readItem<std::uint16_t>(item));
+            case ArrayType::UINT32: return PyLong_FromUnsignedLong(readItem<std::uint32_t>(item));
+            case ArrayType::UINT64: return PyLong_FromUnsignedLongLong(readItem<std::uint64_t>(item));
+            case ArrayType::FLOAT32: return PyFloat_FromDouble(readItem<float>(item));
+            case ArrayType::FLOAT64: return PyFloat_FromDouble(readItem<double>(item));
+            default:
+                THROWF(db0::InputException) << "Invalid array type: " << (int)type << THROWF_END;
+        }
+    }
+
+    // Convert items of any iterable into the raw representation
+    bool toItems(ArrayType type, PyObject *py_iterable, std::vector<std::byte> &items)
+    {
+        auto item_size = db0::object_model::getItemSize(type);
+        auto iterator = Py_OWN(PyObject_GetIter(py_iterable));
+        if (!iterator) {
+            return false;
+        }
+        ObjectSharedPtr py_item;
+        Py_FOR(py_item, iterator) {
+            items.resize(items.size() + item_size);
+            if (!toItem(type, *py_item, items.data() + items.size() - item_size)) {
+                return false;
+            }
+        }
+        return !PyErr_Occurred();
+    }
+
+    /**
+     * Try retrieving raw items of a buffer-protocol object (e.g. array.array, numpy.ndarray, another db0.array)
+     * with matching item type
+     * @return false if the buffer could not be used directly (no exception set in such case)
+     */
+    bool tryGetBuffer(ArrayType type, PyObject *py_value, Py_buffer &view)
+    {
+        if (!PyObject_CheckBuffer(py_value)) {
+            return false;
+        }
+        if (PyObject_GetBuffer(py_value, &view, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) < 0) {
+            PyErr_Clear();
+            return false;
+        }
+        bool type_match = false;
+        try {
+            type_match = db0::object_model::parseArrayType(view.format ? view.format : "B") == type
+                && (std::size_t)view.itemsize == db0::object_model::getItemSize(type);
+        } catch (const db0::InputException &) {
+        }
+        if (!type_match) {
+            PyBuffer_Release(&view);
+        }
+        return type_match;
+    }
+
+    // Write items from a buffer-protocol object or an iterable at the given position
+    bool setItemsFrom(ArrayObject *self, std::size_t index, PyObject *py_value, Py_ssize_t expected_count = -1)
+    {
+        auto type = self->ext().getType();
+        auto item_size = self->ext().getItemSize();
+        Py_buffer view;
+        if (tryGetBuffer(type, py_value, view)) {
+            auto count = view.len / item_size;
+            if (expected_count >= 0 && (Py_ssize_t)count != expected_count) {
+                PyBuffer_Release(&view);
+                PyErr_SetString(PyExc_ValueError, "array slice assignment does not support resizing");
+                return false;
+            }
+            // NOTE: copy first to support the source being a view of the same array
+            std::vector<std::byte> items(static_cast<const std::byte*>(view.buf),
+                static_cast<const std::byte*>(view.buf) + count * item_size);
+            PyBuffer_Release(&view);
+            db0::FixtureLock lock(self->ext().getFixture());
+            self->modifyExt().setItems(index, count, items.data());
+            return true;
+        }
+
+        std::vector<std::byte> items;
+        if (!toItems(type, py_value, items)) {
+            return false;
+        }
+        auto count = items.size() / item_size;
+        if (expected_count >= 0 && (Py_ssize_t)count != expected_count) {
+            PyErr_SetString(PyExc_ValueError, "array slice assignment does not support resizing");
+            return false;
+        }
+        db0::FixtureLock lock(self->ext().getFixture());
+        self->modifyExt().setItems(index, count, items.data());
+        return true;
+    }
+
+    shared_py_object<ArrayBlockObject*> makeArrayBlock(ArrayObject *owner)
+    {
+        auto py_block = Py_OWN(reinterpret_cast<ArrayBlockObject*>(
+            ArrayBlockObjectType.tp_alloc(&ArrayBlockObjectType, 0)));
+        if (!py_block) {
+            return {};
+        }
+        auto &block = py_block->makeNew();
+        block.m_owner = Py_BORROW(reinterpret_cast<PyObject*>(owner));
+        block.m_type = owner->ext().getType();
+        block.m_stride = owner->ext().getItemSize();
+        return py_block;
+    }
+
+    // Create a zero-copy view of a single data block (starting from the i-th item)
+    shared_py_object<ArrayBlockObject*> makeArrayBlock(ArrayObject *owner, std::size_t i)
+    {
+        auto py_block = makeArrayBlock(owner);
+        if (py_block.get()) {
+            auto &block = py_block->modifyExt();
+            block.m_block = owner->ext().getBlock(i);
+            block.m_shape = block.m_block.m_size;
+        }
+        return py_block;
+    }
+
+    // Create a view over a copy of the items range
+    shared_py_object<ArrayBlockObject*> makeArrayBlockCopy(ArrayObject *owner, std::size_t index, std::size_t count)
+    {
+        auto py_block = makeArrayBlock(owner);
+        if (py_block.get()) {
+            auto &block = py_block->modifyExt();
+            block.m_copy.resize(count * owner->ext().getItemSize());
+            owner->ext().getItems(index, count, block.m_copy.data());
+            block.m_shape = count;
+        }
+        return py_block;
+    }
+
+    int PyAPI_ArrayBlockObject_getbuffer(ArrayBlockObject *self, Py_buffer *view, int flags)
+    {
+        if (flags & PyBUF_WRITABLE) {
+            PyErr_SetString(PyExc_BufferError, "db0.array buffers are read-only");
+            view->obj = nullptr;
+            return -1;
+        }
+        static char empty_buf[8] = {0};
+        auto &block = self->ext();
+        auto data = block.m_copy.empty() ? reinterpret_cast<const char*>(block.m_block.m_data)
+            : reinterpret_cast<const char*>(block.m_copy.data());
+        view->buf = const_cast<char*>(data ? data : empty_buf);
+        view->obj = Py_NewRef(reinterpret_cast<PyObject*>(self));
+        view->len = block.m_shape * block.m_stride;
+        view->readonly = 1;
+        view->itemsize = block.m_stride;
+        view->format = (flags & PyBUF_FORMAT) ? const_cast<char*>(db0::object_model::getFormat(block.m_type)) : nullptr;
+        view->ndim = 1;
+        view->shape = (flags & PyBUF_ND) ? &self->modifyExt().m_shape : nullptr;
+        view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? &self->modifyExt().m_stride : nullptr;
+        view->suboffsets = nullptr;
+        view->internal = nullptr;
+        return 0;
+    }
+
+    void PyAPI_ArrayBlockObject_del(ArrayBlockObject *self)
+    {
+        PY_API_FUNC
+        self->destroy();
+        Py_TYPE(self)->tp_free((PyObject*)self);
+    }
+
+    static PyBufferProcs ArrayBlockObject_as_buffer = {
+        .bf_getbuffer = (getbufferproc)PyAPI_ArrayBlockObject_getbuffer,
+        .bf_releasebuffer = nullptr
+    };
+
+    PyTypeObject ArrayBlockObjectType = {
+        PYVAROBJECT_HEAD_INIT_DESIGNATED,
+        .tp_name = "ArrayBlock",
+        .tp_basicsize = ArrayBlockObject::sizeOf(),
+        .tp_itemsize = 0,
+        .tp_dealloc = (destructor)PyAPI_ArrayBlockObject_del,
+        .tp_as_buffer = &ArrayBlockObject_as_buffer,
+        .tp_flags = Py_TPFLAGS_DEFAULT,
+        .tp_doc = "Read-only range of db0.array items",
+        .tp_alloc = PyType_GenericAlloc,
+        .tp_free = PyObject_Free,
+    };
+
+    int tryArrayObject_getbuffer(ArrayObject *self, Py_buffer *view, int flags)
+    {
+        if (flags & PyBUF_WRITABLE) {
+            PyErr_SetString(PyExc_BufferError, "db0.array buffers are read-only");
+            view->obj = nullptr;
+            return -1;
+        }
+        auto size = self->ext().size();
+        shared_py_object<ArrayBlockObject*> py_block;
+        if (size > 0 && self->ext().getBlock(0).m_size == size) {
+            // the entire array fits in a single data block, expose without copying
+            py_block = makeArrayBlock(self, 0);
+        } else {
+            py_block = makeArrayBlockCopy(self, 0, size);
+        }
+        if (!py_block) {
+            return -1;
+        }
+        // NOTE: the block object becomes the exporter (released with PyBuffer_Release)
+        return PyAPI_ArrayBlockObject_getbuffer(*py_block, view, flags);
+    }
+
+    int PyAPI_ArrayObject_getbuffer(ArrayObject *self, Py_buffer *view, int flags)
+    {
+        PY_API_FUNC
+        return runSafe<-1>(tryArrayObject_getbuffer, self, view, flags);
+    }
+
+    static PyBufferProcs ArrayObject_as_buffer = {
+        .bf_getbuffer = (getbufferproc)PyAPI_ArrayObject_getbuffer,
+        .bf_releasebuffer = nullptr
+    };
+
+    Py_ssize_t tryArrayObject_len(ArrayObject *self)
+    {
+        self->ext().getFixture()->refreshIfUpdated();
+        return self->ext().size();
+    }
+
+    Py_ssize_t PyAPI_ArrayObject_len(ArrayObject *self)
+    {
+        PY_API_FUNC
+        return runSafe<-1>(tryArrayObject_len, self);
+    }
+
+    PyObject *tryArrayObject_GetItem(ArrayObject *self, PyObject *key)
+    {
+        auto size = self->ext().size();
+        if (PySlice_Check(key)) {
+            Py_ssize_t start, stop, step, slice_length;
+            if (PySlice_GetIndicesEx(key, size, &start, &stop, &step, &slice_length) < 0) {
+                return nullptr;
+            }
+            shared_py_object<ArrayBlockObject*> py_block;
+            if (step == 1) {
+                py_block = makeArrayBlockCopy(self, start, slice_length);
+            } else {
+                py_block = makeArrayBlock(self);
+                if (py_block.get()) {
+                    auto &block = py_block->modifyExt();
+                    auto item_size = self->ext().getItemSize();
+                    block.m_copy.resize(slice_length * item_size);
+                    for (Py_ssize_t i = 0; i < slice_length; ++i) {
+                        self->ext().getItems(start + i * step, 1, block.m_copy.data() + i * item_size);
+                    }
+                    block.m_shape = slice_length;
+                }
+            }
+            if (!py_block) {
+                return nullptr;
+            }
+            return PyMemoryView_FromObject(reinterpret_cast<PyObject*>(*py_block));
+        }
+
+        auto index = PyNumber_AsSsize_t(key, PyExc_IndexError);
+        if (index == -1 && PyErr_Occurred()) {
+            return nullptr;
+        }
+        if (index < 0) {
+            index += size;
+        }
+        if (index < 0 || (std::size_t)index >= size) {
+            PyErr_SetString(PyExc_IndexError, "array index out of range");
+            return nullptr;
+        }
+        std::byte item[8];
+        self->ext().getItems(index, 1, item);
+        return fromItem(self->ext().getType(), item);
+    }
+
+    PyObject *PyAPI_ArrayObject_GetItem(ArrayObject *self, PyObject *key)
+    {
+        PY_API_FUNC
+        return runSafe(tryArrayObject_GetItem, self, key);
+    }
+
+    PyObject *PyAPI_ArrayObject_sq_item(ArrayObject *self, Py_ssize_t index)
+    {
+        PY_API_FUNC
+        auto py_index = Py_OWN(PyLong_FromSsize_t(index));
+        if (!py_index) {
+            return nullptr;
+        }
+        return runSafe(tryArrayObject_GetItem, self, *py_index);
+    }
+
+    int tryArrayObject_SetItem(ArrayObject *self, PyObject *key, PyObject *value)
+    {
+        if (!value) {
+            PyErr_SetString(PyExc_TypeError, "db0.array does not support item deletion");
+            return -1;
+        }
+        auto size = self->ext().size();
+        if (PySlice_Check(key)) {
+            Py_ssize_t start, stop, step, slice_length;
+            if (PySlice_GetIndicesEx(key, size, &start, &stop, &step, &slice_length) < 0) {
+                return -1;
+            }
+            if (step == 1) {
+                // bulk assignment
+                return setItemsFrom(self, start, value, slice_length) ? 0 : -1;
+            }
+            std::vector<std::byte> items;
+            if (!toItems(self->ext().getType(), value, items)) {
+                return -1;
+            }
+            auto item_size = self->ext().getItemSize();
+            if ((Py_ssize_t)(items.size() / item_size) != slice_length) {
+                PyErr_SetString(PyExc_ValueError, "array slice assignment does not support resizing");
+                return -1;
+            }
+            db0::FixtureLock lock(self->ext().getFixture());
+            for (Py_ssize_t i = 0; i < slice_length; ++i) {
+                self->modifyExt().setItems(start + i * step, 1, items.data() + i * item_size);
+            }
+            return 0;
+        }
+
+        auto index = PyNumber_AsSsize_t(key, PyExc_IndexError);
+        if (index == -1 && PyErr_Occurred()) {
+            return -1;
+        }
+        if (index < 0) {
+            index += size;
+        }
+        if (index < 0 || (std::size_t)index >= size) {
+            PyErr_SetString(PyExc_IndexError, "array assignment index out of range");
+            return -1;
+        }
+        std::byte item[8];
+        if (!toItem(self->ext().getType(), value, item)) {
+            return -1;
+        }
+        db0::FixtureLock lock(self->ext().getFixture());
+        self->modifyExt().setItems(index, 1, item);
+        return 0;
+    }
+
+    int PyAPI_ArrayObject_SetItem(ArrayObject *self, PyObject *key, PyObject *value)
+    {
+        PY_API_FUNC
+        return runSafe<-1>(tryArrayObject_SetItem, self, key, value);
+    }
+
+    PyObject *tryArrayObject_append(ArrayObject *self, PyObject *value)
+    {
+        std::byte item[8];
+        if (!toItem(self->ext().getType(), value, item)) {
+            return nullptr;
+        }
+        db0::FixtureLock lock(self->ext().getFixture());
+        self->modifyExt().append(item, 1);
+        Py_RETURN_NONE;
+    }
+
+    PyObject *PyAPI_ArrayObject_append(ArrayObject *self, PyObject *value)
+    {
+        PY_API_FUNC
+        return runSafe(tryArrayObject_append, self, value);
+    }
+
+    PyObject *tryArrayObject_extend(ArrayObject *self, PyObject *value)
+    {
+        if (!setItemsFrom(self, self->ext().size(), value)) {
+            return nullptr;
+        }
+        Py_RETURN_NONE;
+    }
+
+    PyObject *PyAPI_ArrayObject_extend(ArrayObject *self, PyObject *value)
+    {
+        PY_API_FUNC
+        return runSafe(tryArrayObject_extend, self, value);
+    }
+
+    PyObject *tryArrayObject_clear(ArrayObject *self)
+    {
+        db0::FixtureLock lock(self->ext().getFixture());
+        self->modifyExt().clear();
+        Py_RETURN_NONE;
+    }
+
+    PyObject *PyAPI_ArrayObject_clear(ArrayObject *self, PyObject *)
+    {
+        PY_API_FUNC
+        return runSafe(tryArrayObject_clear, self);
+    }
+
+    PyObject *tryArrayObject_tobytes(ArrayObject *self)
+    {
+        auto size = self->ext().size();
+        auto py_bytes = Py_OWN(PyBytes_FromStringAndSize(nullptr, size * self->ext().getItemSize()));
+        if (!py_bytes) {
+            return nullptr;
+        }
+        self->ext().getItems(0, size, PyBytes_AS_STRING(*py_bytes));
+        return py_bytes.steal();
+    }
+
+    PyObject *PyAPI_ArrayObject_tobytes(ArrayObject *self, PyObject *)
+    {
+        PY_API_FUNC
+        return runSafe(tryArrayObject_tobytes, self);
+    }
+
+    PyObject *tryArrayObject_tolist(ArrayObject *self)
+    {
+        auto size = self->ext().size();
+        auto item_size = self->ext().getItemSize();
+        auto type = self->ext().getType();
+        auto py_list = Py_OWN(PyList_New(size));
+        if (!py_list) {
+            return nullptr;
+        }
+        for (std::size_t index = 0; index < size; ) {
+            auto block = self->ext().getBlock(index);
+            for (std::size_t i = 0; i < block.m_size; ++i) {
+                auto py_item = fromItem(type, block.m_data + i * item_size);
+                if (!py_item) {
+                    return nullptr;
+                }
+                PyList_SET_ITEM(*py_list, index + i, py_item);
+            }
+            index += block.m_size;
+        }
+        return py_list.steal();
+    }
+
+    PyObject *PyAPI_ArrayObject_tolist(ArrayObject *self, PyObject *)
+    {
+        PY_API_FUNC
+        return runSafe(tryArrayObject_tolist, self);
+    }
+
+    PyObject *tryArrayObject_blocks(ArrayObject *self)
+    {
+        auto py_list = Py_OWN(PyList_New(0));
+        if (!py_list) {
+            return nullptr;
+        }
+        auto size = self->ext().size();
+        for (std::size_t index = 0; index < size; ) {
+            auto py_block = makeArrayBlock(self, index);
+            if (!py_block) {
+                return nullptr;
+            }
+            index += py_block->ext().m_block.m_size;
+            auto py_view = Py_OWN(PyMemoryView_FromObject(reinterpret_cast<PyObject*>(*py_block)));
+            if (!py_view || PyList_Append(*py_list, *py_view) < 0) {
+                return nullptr;
+            }
+        }
+        return py_list.steal();
+    }
+
+    PyObject *PyAPI_ArrayObject_blocks(ArrayObject *self, PyObject *)
+    {
+        PY_API_FUNC
+        return runSafe(tryArrayObject_blocks, self);
+    }
+
+    PyObject *tryArrayObject_rq(ArrayObject *self, PyObject *other, int op)
+    {
+        if (!ArrayObject_Check(other) || (op != Py_EQ && op != Py_NE)) {
+            Py_RETURN_NOTIMPLEMENTED;
+        }
+        bool eq = self->ext() == reinterpret_cast<ArrayObject*>(other)->ext();
+        return PyBool_FromLong(op == Py_EQ ? eq : !eq);
+    }
+
+    PyObject *PyAPI_ArrayObject_rq(ArrayObject *self, PyObject *other, int op)
+    {
+        PY_API_FUNC
+        return runSafe(tryArrayObject_rq, self, other, op);
+    }
+
+    PyObject *tryArrayObject_repr(ArrayObject *self)
+    {
+        auto py_list = Py_OWN(tryArrayObject_tolist(self));
+        if (!py_list) {
+            return nullptr;
+        }
+        return PyUnicode_FromFormat("array('%s', %R)", db0::object_model::getTypeName(self->ext().getType()), *py_list);
+    }
+
+    PyObject *PyAPI_ArrayObject_repr(ArrayObject *self)
+    {
+        PY_API_FUNC
+        return runSafe(tryArrayObject_repr, self);
+    }
+
+    PyObject *PyAPI_ArrayObject_get_dtype(ArrayObject *self, void *)
+    {
+        PY_API_FUNC
+        return PyUnicode_FromString(db0::object_model::getTypeName(self->ext().getType()));
+    }
+
+    PyObject *PyAPI_ArrayObject_get_itemsize(ArrayObject *self, void *)
+    {
+        PY_API_FUNC
+        return PyLong_FromSize_t(self->ext().getItemSize());
+    }
+
+    static PySequenceMethods ArrayObject_sq = {
+        .sq_length = (lenfunc)PyAPI_ArrayObject_len,
+        .sq_item = (ssizeargfunc)PyAPI_ArrayObject_sq_item
+    };
+
+    static PyMappingMethods ArrayObject_mp = {
+        .mp_length = (lenfunc)PyAPI_ArrayObject_len,
+        .mp_subscript = (binaryfunc)PyAPI_ArrayObject_GetItem,
+        .mp_ass_subscript = (objobjargproc)PyAPI_ArrayObject_SetItem
+    };
+
+    static PyMethodDef ArrayObject_methods[] =
+    {
+        {"append", (PyCFunction)PyAPI_ArrayObject_append, METH_O, "Append a single item to the array"},
+        {"extend", (PyCFunction)PyAPI_ArrayObject_extend, METH_O, "Append items from a buffer (copied in bulk when the item type matches) or any iterable"},
+        {"clear", (PyCFunction)PyAPI_ArrayObject_clear, METH_NOARGS, "Remove all items from the array"},
+        {"tobytes", (PyCFunction)PyAPI_ArrayObject_tobytes, METH_NOARGS, "Return the raw contents as bytes"},
+        {"tolist", (PyCFunction)PyAPI_ArrayObject_tolist, METH_NOARGS, "Return the contents as a list of Python numbers"},
+        {"blocks", (PyCFunction)PyAPI_ArrayObject_blocks, METH_NOARGS, "Return zero-copy read-only memoryviews of the consecutive data blocks"},
+        {NULL}
+    };
+
+    static PyGetSetDef ArrayObject_getset[] =
+    {
+        {"dtype", (getter)PyAPI_ArrayObject_get_dtype, NULL, "Item type name (e.g. 'f8')", NULL},
+        {"itemsize", (getter)PyAPI_ArrayObject_get_itemsize, NULL, "Item size in bytes", NULL},
+        {NULL}
+    };
+
+    PyTypeObject ArrayObjectType = {
+        PYVAROBJECT_HEAD_INIT_DESIGNATED,
+        .tp_name = "Array",
+        .tp_basicsize = ArrayObject::sizeOf(),
+        .tp_itemsize = 0,
+        .tp_dealloc = (destructor)PyAPI_ArrayObject_del,
+        .tp_repr = (reprfunc)PyAPI_ArrayObject_repr,
+        .tp_as_sequence = &ArrayObject_sq,
+        .tp_as_mapping = &ArrayObject_mp,
+        .tp_as_buffer = &ArrayObject_as_buffer,
+        .tp_flags = Py_TPFLAGS_DEFAULT,
+        .tp_doc = "dbzero typed numeric array",
+        .tp_richcompare = (richcmpfunc)PyAPI_ArrayObject_rq,
+        .tp_methods = ArrayObject_methods,
+        .tp_getset = ArrayObject_getset,
+        .tp_alloc = PyType_GenericAlloc,
+        .tp_new = (newfunc)ArrayObject_new,
+        .tp_free = PyObject_Free,
+    };
+
+    ArrayObject *ArrayObject_new(PyTypeObject *type, PyObject *, PyObject *) {
+        // not API method, lock not needed (otherwise may cause deadlock)
+        return reinterpret_cast<ArrayObject*>(type->tp_alloc(type, 0));
+    }
+
+    shared_py_object<ArrayObject*> ArrayDefaultObject_new() {
+        return { ArrayObject_new(&ArrayObjectType, NULL, NULL), false };
+    }
+
+    void PyAPI_ArrayObject_del(ArrayObject *self)
+    {
+        PY_API_FUNC
+        // destroy associated DB0 Array instance
+        self->destroy();
+        Py_TYPE(self)->tp_free((PyObject*)self);
+    }
+
+    ArrayObject *tryPyAPI_makeArray(PyObject *, PyObject *const *args, Py_ssize_t nargs)
+    {
+        if (nargs < 1 || nargs > 2) {
+            PyErr_SetString(PyExc_TypeError, "array() takes 1 or 2 arguments (dtype, data)");
+            return NULL;
+        }
+        if (!PyUnicode_Check(args[0])) {
+            PyErr_SetString(PyExc_TypeError, "array() dtype must be a string (e.g. 'f8' or 'i4')");
+            return NULL;
+        }
+        auto type = db0::object_model::parseArrayType(PyUnicode_AsUTF8(args[0]));
+        auto py_array = ArrayDefaultObject_new();
+        auto fixture = PyToolkit::getPyWorkspace().getWorkspace().getCurrentFixture();
+        {
+            db0::FixtureLock lock(fixture);
+            py_array->makeNew(*lock, type);
+        }
+        if (nargs == 2 && !setItemsFrom(*py_array, 0, args[1])) {
+            return NULL;
+        }
+        // register newly created array with py-object cache
+        fixture->getLangCache().add(py_array->ext().getAddress(), *py_array);
+        return py_array.steal();
+    }
+
+    ArrayObject *PyAPI_makeArray(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+    {
+        PY_API_FUNC
+        return runSafe(tryPyAPI_makeArray, self, args, nargs);
+    }
+
+    bool ArrayObject_Check(PyObject *object) {
+        return Py_TYPE(object) == &ArrayObjectType;
+    }
+
+}
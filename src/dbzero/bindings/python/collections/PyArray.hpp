@@ -0,0 +1,43 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#pragma once
+
+#include <vector>
+#include <Python.h>
+#include <dbzero/bindings/python/PyWrapper.hpp>
+#include <dbzero/object_model/array/Array.hpp>
+#include <dbzero/bindings/python/shared_py_object.hpp>
+
+namespace db0::python
+
+{
+
+    using ArrayObject = PyWrapper<db0::object_model::Array>;
+
+    // A read-only contiguous range of array items exported via the buffer protocol
+    struct ArrayBlock
+    {
+        // the source array (kept alive for as long as the block is referenced)
+        shared_py_object<PyObject*> m_owner;
+        // pinned data block (zero-copy) or empty if m_copy is used
+        db0::object_model::Array::Block m_block;
+        std::vector<std::byte> m_copy;
+        db0::object_model::ArrayType m_type = db0::object_model::ArrayType::INVALID;
+        Py_ssize_t m_shape = 0;
+        Py_ssize_t m_stride = 0;
+    };
+
+    using ArrayBlockObject = PyWrapper<ArrayBlock, false>;
+
+    ArrayObject *ArrayObject_new(PyTypeObject *type, PyObject *, PyObject *);
+    shared_py_object<ArrayObject*> ArrayDefaultObject_new();
+    void PyAPI_ArrayObject_del(ArrayObject *);
+
+    extern PyTypeObject ArrayObjectType;
+    extern PyTypeObject ArrayBlockObjectType;
+
+    ArrayObject *PyAPI_makeArray(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+    bool ArrayObject_Check(PyObject *);
+
+}
@@ -38,7 +38,7 @@ namespace db0::python
     {
         const auto &dict_obj = py_dict->ext();
         auto fixture = dict_obj.getFixture();
-        fixture->refreshIfUpdated();
+        PyToolkit::refreshIfUpdated(*fixture);
         auto key = migratedKey(dict_obj, py_key);
         auto maybe_hash = getPyHashIfExists(fixture, *key);        
         if (maybe_hash) {
@@ -65,7 +65,7 @@ namespace db0::python
     
     PyObject *PyAPI_DictObject_GetItem(DictObject *dict_obj, PyObject *key)
     {
-        PY_API_FUNC
+        PY_API_READ_FUNC
         return runSafe(tryDictObject_GetItem, dict_obj, key);
     }
     
@@ -95,13 +95,13 @@ namespace db0::python
 
     Py_ssize_t tryDictObject_len(DictObject *dict_obj)
     {        
-        dict_obj->ext().getFixture()->refreshIfUpdated();
+        PyToolkit::refreshIfUpdated(*dict_obj->ext().getFixture());
         return dict_obj->ext().size();
     }
 
     Py_ssize_t PyAPI_DictObject_len(DictObject *dict_obj)
     {
-        PY_API_FUNC
+        PY_API_READ_FUNC
         return runSafe(tryDictObject_len, dict_obj);
     }
     
@@ -109,7 +109,7 @@ namespace db0::python
     {
         auto key = migratedKey(py_dict->ext(), py_key);
         auto fixture = py_dict->ext().getFixture();
-        fixture->refreshIfUpdated();
+        PyToolkit::refreshIfUpdated(*fixture);
         auto maybe_hash_pair = getPyHashIfExists(fixture, *key);
         if (!maybe_hash_pair) {
             // NOTE: element does not exist because a key does NOT exist either
@@ -120,7 +120,7 @@ namespace db0::python
     
     int PyAPI_DictObject_HasItem(DictObject *dict_obj, PyObject *key)
     {
-        PY_API_FUNC
+        PY_API_READ_FUNC
         return runSafe<-1>(tryDictObject_HasItem, dict_obj, key);
     }
     
@@ -478,7 +478,7 @@ namespace db0::python
     
     PyObject *PyAPI_DictObject_get(DictObject *dict_object, PyObject *const *args, Py_ssize_t nargs)
     {
-        PY_API_FUNC        
+        PY_API_READ_FUNC
         if (nargs < 1) {
             PyErr_SetString(PyExc_TypeError, " get expected at least 1 argument");
             return NULL;
@@ -58,13 +58,13 @@ namespace db0::python
     
     Py_ssize_t tryIndexObject_len(IndexObject *index_obj)
     {
-        index_obj->ext().getFixture()->refreshIfUpdated();
+        PyToolkit::refreshIfUpdated(*index_obj->ext().getFixture());
         return index_obj->ext().size();
     }
 
     Py_ssize_t PyAPI_IndexObject_len(IndexObject *index_obj)
     {
-        PY_API_FUNC
+        PY_API_READ_FUNC
         return runSafe(tryIndexObject_len, index_obj);
     }
     
@@ -37,7 +37,7 @@ namespace db0::python
     
     int trySetObject_HasItem(SetObject *set_obj, PyObject *key)
     {
-        PY_API_FUNC
+        PY_API_READ_FUNC
         auto fixture = set_obj->ext().getFixture();
         auto maybe_hash_pair = getPyHashIfExists(fixture, key);
         if (!maybe_hash_pair) {
@@ -49,7 +49,7 @@ namespace db0::python
     
     int PyAPI_SetObject_HasItem(SetObject *set_obj, PyObject *key)
     {
-        PY_API_FUNC
+        PY_API_READ_FUNC
         return runSafe<-1>(trySetObject_HasItem, set_obj, key);
     }
 
@@ -91,13 +91,13 @@ namespace db0::python
 
     Py_ssize_t trySetObject_len(SetObject *set_obj)
     {
-        set_obj->ext().getFixture()->refreshIfUpdated();
+        PyToolkit::refreshIfUpdated(*set_obj->ext().getFixture());
         return set_obj->ext().size();
     }
     
     Py_ssize_t PyAPI_SetObject_len(SetObject *set_obj)
     {
-        PY_API_FUNC
+        PY_API_READ_FUNC
         return runSafe(trySetObject_len, set_obj);
     }
 
@@ -35,7 +35,7 @@ namespace db0::python
 
     PyObject *tryTupleObject_GetItem(TupleObject *tuple_obj, Py_ssize_t i)
     {   
-        tuple_obj->ext().getFixture()->refreshIfUpdated();     
+        PyToolkit::refreshIfUpdated(*tuple_obj->ext().getFixture());
         if (static_cast<std::size_t>(i) >= tuple_obj->ext().getData()->size()) {
             PyErr_SetString(PyExc_IndexError, "tuple index out of range");
             return NULL;
@@ -45,7 +45,7 @@ namespace db0::python
 
     PyObject *PyAPI_TupleObject_GetItem(TupleObject *tuple_obj, Py_ssize_t i)
     {
-        PY_API_FUNC        
+        PY_API_READ_FUNC
         return runSafe(tryTupleObject_GetItem, tuple_obj, i);
     }
 
@@ -217,13 +217,13 @@ namespace db0::python
 
     Py_ssize_t tryTupleObject_len(TupleObject *tuple_obj)
     {        
-        tuple_obj->ext().getFixture()->refreshIfUpdated();
+        PyToolkit::refreshIfUpdated(*tuple_obj->ext().getFixture());
         return tuple_obj->ext().getData()->size();
     }
 
     Py_ssize_t PyAPI_TupleObject_len(TupleObject *tuple_obj)
     {
-        PY_API_FUNC
+        PY_API_READ_FUNC
         return runSafe(tryTupleObject_len, tuple_obj);
     }
     
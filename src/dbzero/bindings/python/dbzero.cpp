@@ -15,6 +15,7 @@
 #include <dbzero/bindings/python/types/PyObjectId.hpp>
 #include <dbzero/bindings/python/collections/PyList.hpp>
 #include <dbzero/bindings/python/collections/PyByteArray.hpp>
+#include <dbzero/bindings/python/collections/PyArray.hpp>
 #include <dbzero/bindings/python/collections/PyIndex.hpp>
 #include <dbzero/bindings/python/collections/PySet.hpp>
 #include <dbzero/bindings/python/collections/PyWeakSet.hpp>
@@ -29,6 +30,7 @@
 #include <dbzero/bindings/python/types/PyClass.hpp>
 #include <dbzero/bindings/python/types/PyEnum.hpp>
 #include <dbzero/bindings/python/types/PyTag.hpp>
+#include <dbzero/bindings/python/types/PyPredicate.hpp>
 #include <dbzero/bindings/python/PyTagSet.hpp>
 
 namespace py = db0::python;
@@ -53,11 +55,14 @@ static PyMethodDef dbzero_methods[] =
     {"weak_set", (PyCFunction)&py::PyAPI_makeWeakSet, METH_FASTCALL, "Create a new dbzero weak set instance"},
     {"dict", (PyCFunction)&py::PyAPI_makeDict, METH_VARARGS | METH_KEYWORDS, "Create a new dbzero dict instance"},
     {"bytearray", (PyCFunction)&py::PyAPI_makeByteArray, METH_FASTCALL, "Create a new dbzero bytearray instance"},        
+    {"array", (PyCFunction)&py::PyAPI_makeArray, METH_FASTCALL, "Create a new dbzero typed numeric array instance (e.g. array('f8', data))"},
     {"tags", (PyCFunction)&py::makeObjectTagManager, METH_FASTCALL, ""},
     {"find", (PyCFunction)&py::PyAPI_find, METH_VARARGS | METH_KEYWORDS, "Find memo instances by tags with optional filtering"},
     {"join", (PyCFunction)&py::PyAPI_join, METH_VARARGS | METH_KEYWORDS, "Join memo collections by common tags with optional filtering"},
     {"refresh", (PyCFunction)&py::refresh, METH_VARARGS, ""},
     {"get_state_num", (PyCFunction)&py::PyAPI_getStateNum, METH_VARARGS | METH_KEYWORDS, ""},
+    {"wait_durable", (PyCFunction)&py::PyAPI_waitDurable, METH_VARARGS | METH_KEYWORDS, "Wait until committed state is durable"},
+    {"get_changes", (PyCFunction)&py::PyAPI_getChanges, METH_VARARGS | METH_KEYWORDS, "Retrieve objects created / modified / deleted within the range of states"},
     {"get_prefix_stats", (PyCFunction)&py::getPrefixStats, METH_VARARGS | METH_KEYWORDS, "Retrieve prefix specific statistics"},
     {"snapshot", (PyCFunction)&py::PyAPI_getSnapshot, METH_VARARGS | METH_KEYWORDS, "Get snapshot of dbzero state"},
     {"get_snapshot_of", (PyCFunction)&py::PyAPI_getSnapshotOf, METH_FASTCALL, "Get snapshot associated with a specific object"},
@@ -73,13 +78,17 @@ static PyMethodDef dbzero_methods[] =
     {"deserialize", (PyCFunction)&py::PyAPI_deserialize, METH_FASTCALL, "Serialize dbzero serializable instance"},    
     {"is_enum_value", (PyCFunction)&py::PyAPI_isEnumValue, METH_FASTCALL, "Check if parameter represents a dbzero enum value"},
     {"split_by", (PyCFunction)&py::PyAPI_splitBy, METH_VARARGS | METH_KEYWORDS, "Split query iterator by a given criteria"},    
-    {"filter", (PyCFunction)&py::filter, METH_VARARGS | METH_KEYWORDS, "Filter with a Python callable"},
+    {"filter", (PyCFunction)&py::filter, METH_VARARGS | METH_KEYWORDS, "Filter with a Python callable or a predicate"},
+    {"where", (PyCFunction)&py::PyAPI_where, METH_FASTCALL, "Combine field predicates to be evaluated natively by queries"},
     {"set_prefix", (PyCFunction)&py::PyAPI_setPrefix, METH_VARARGS | METH_KEYWORDS, "Allows dynamically specifying object's prefix during initialization"},
     {"get_slab_metrics", (PyCFunction)&py::getSlabMetrics, METH_NOARGS, "Retrieve slab metrics of the current prefix"},
     {"set_cache_size", (PyCFunction)&py::setCacheSize, METH_VARARGS, "Update dbzero cache size with immediate effect"},
     {"get_cache_stats", &py::getCacheStats, METH_NOARGS, "Retrieve dbzero cache statistics"},
     {"get_lang_cache_stats", &py::getLangCacheStats, METH_NOARGS, "Retrieve dbzero language cache statistics"},
     {"get_storage_stats", (PyCFunction)&py::getStorageStats, METH_VARARGS | METH_KEYWORDS, "Retrieve dbzero storage utilization statistics for a specific prefix"},
+    {"enable_tracing", (PyCFunction)&py::PyAPI_enableTracing, METH_FASTCALL, "Enable or disable collection of dbzero trace events"},
+    {"clear_trace", &py::PyAPI_clearTrace, METH_NOARGS, "Discard all collected trace events"},
+    {"export_trace", &py::PyAPI_exportTrace, METH_NOARGS, "Export collected trace events as Chrome trace / Perfetto JSON"},
     // the Reflection API functions
     {"get_attributes", (PyCFunction)&py::PyAPI_getAttributes, METH_VARARGS, "Get attributes of a memo type"},
     {"getattr_as", (PyCFunction)&py::PyAPI_getAttrAs, METH_FASTCALL, "Get memo member cast to a user defined type - e.g. MemoBase"},
@@ -113,6 +122,7 @@ static PyMethodDef dbzero_methods[] =
     {"_async_wait", (PyCFunction)&py::PyAPI_async_wait, METH_VARARGS | METH_KEYWORDS, "Get notified about state number being reached"},    
     {"_select_mod_candidates", (PyCFunction)&py::PyAPI_selectModCandidates, METH_VARARGS | METH_KEYWORDS, "Filter to return only objects which could potentially be modified within a specific scope"},
     {"_split_by_snapshots", (PyCFunction)&py::PyAPI_splitBySnapshots, METH_FASTCALL, "Splits a given query to produce results from the 2 given snapshots (as a tuple)"},
+    {"_group_by", (PyCFunction)&py::PyAPI_groupBy, METH_FASTCALL, "Group and aggregate query results natively (returns None if not supported)"},
 #ifndef NDEBUG
     {"dbg_write_bytes", &py::writeBytes, METH_VARARGS, "Debug function"},
     {"dbg_free_bytes", &py::freeBytes, METH_VARARGS, "Debug function"},
@@ -203,11 +213,14 @@ PyMODINIT_FUNC PyInit_dbzero(void)
         &py::PyJoinIterableType,
         &py::PyJoinIteratorType,
         &py::ByteArrayObjectType,
+        &py::ArrayObjectType,
+        &py::ArrayBlockObjectType,
         &py::PyEnumType, 
         &py::PyEnumValueType,
         &py::PyEnumValueReprType,
         &py::PyClassFieldsType,
         &py::PyFieldDefType,
+        &py::PyPredicateType,
         &py::ClassObjectType,
         &py::TagSetType,
         &py::PyAtomicType,        
@@ -2,7 +2,9 @@
 // Copyright (c) 2025 DBZero Software sp. z o.o.
 
 #include "PyClassFields.hpp"
+#include "PyPredicate.hpp"
 #include <dbzero/bindings/python/PyInternalAPI.hpp>
+#include <dbzero/core/utils/hash_combine.hpp>
 
 namespace db0::python
 
@@ -63,10 +65,60 @@ namespace db0::python
         return runSafe(tryPyClassFields_getattro, self, attr);
     }
     
+    static PyObject *tryPyFieldDef_richcompare(PyObject *self, PyObject *other, int op)
+    {
+        // NOTE: == / != compare field definitions, equality predicates are built with eq / ne
+        if (op == Py_EQ || op == Py_NE) {
+            if (!PyFieldDef_Check(other)) {
+                Py_RETURN_NOTIMPLEMENTED;
+            }
+            auto &lhs = reinterpret_cast<PyFieldDef*>(self)->ext();
+            auto &rhs = reinterpret_cast<PyFieldDef*>(other)->ext();
+            bool is_equal = lhs.m_class_uid == rhs.m_class_uid && lhs.m_member.m_name == rhs.m_member.m_name;
+            return PyBool_fromBool(is_equal == (op == Py_EQ));
+        }
+        // ordering with a constant yields a predicate (e.g. MemoClass.__fields__.value > 0)
+        return tryMakePredicate(self, other, op);
+    }
+
+    static PyObject *PyAPI_PyFieldDef_richcompare(PyObject *self, PyObject *other, int op)
+    {
+        PY_API_FUNC
+        return runSafe(tryPyFieldDef_richcompare, self, other, op);
+    }
+
+    static PyObject *PyAPI_PyFieldDef_eq(PyObject *self, PyObject *other)
+    {
+        PY_API_FUNC
+        return runSafe(tryMakeEqualityPredicate, self, other, Py_EQ);
+    }
+
+    static PyObject *PyAPI_PyFieldDef_ne(PyObject *self, PyObject *other)
+    {
+        PY_API_FUNC
+        return runSafe(tryMakeEqualityPredicate, self, other, Py_NE);
+    }
+
+    static Py_hash_t PyAPI_PyFieldDef_hash(PyFieldDef *self)
+    {
+        auto &field_def = self->ext();
+        std::size_t result = field_def.m_class_uid;
+        db0::hash_combine(result, field_def.m_member.m_name);
+        // NOTE: -1 is reserved for errors
+        return (result == (std::size_t)-1) ? -2 : (Py_hash_t)result;
+    }
+
     static PyMethodDef PyClassFields_methods[] = 
     {
         {NULL}
     };
+
+    static PyMethodDef PyFieldDef_methods[] = 
+    {
+        {"eq", (PyCFunction)PyAPI_PyFieldDef_eq, METH_O, "Predicate: member equal to a constant"},
+        {"ne", (PyCFunction)PyAPI_PyFieldDef_ne, METH_O, "Predicate: member not equal to a constant"},
+        {NULL}
+    };
     
     PyTypeObject PyClassFieldsType = {
         PYVAROBJECT_HEAD_INIT_DESIGNATED,
@@ -88,9 +140,12 @@ namespace db0::python
         .tp_name = "dbzero.FieldDef",
         .tp_basicsize = PyFieldDef::sizeOf(),
         .tp_itemsize = 0,
-        .tp_dealloc = (destructor)PyFieldDef_del,        
+        .tp_dealloc = (destructor)PyFieldDef_del,
+        .tp_hash = (hashfunc)PyAPI_PyFieldDef_hash,
         .tp_flags = Py_TPFLAGS_DEFAULT,
-        .tp_doc = "FieldDef object",        
+        .tp_doc = "FieldDef object",
+        .tp_richcompare = (richcmpfunc)PyAPI_PyFieldDef_richcompare,
+        .tp_methods = PyFieldDef_methods,
         .tp_alloc = PyType_GenericAlloc,
         .tp_new = (newfunc)PyFieldDef_new,
         .tp_free = PyObject_Free
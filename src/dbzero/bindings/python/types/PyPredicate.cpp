@@ -0,0 +1,185 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#include "PyPredicate.hpp"
+#include "PyClassFields.hpp"
+#include <sstream>
+#include <dbzero/bindings/python/PyInternalAPI.hpp>
+#include <dbzero/bindings/python/shared_py_object.hpp>
+
+namespace db0::python
+
+{
+
+    using CompareOp = db0::object_model::CompareOp;
+    using PredicateValue = db0::object_model::PredicateValue;
+
+    PyPredicate *PyPredicate_new(PyTypeObject *type, PyObject *, PyObject *) {
+        return reinterpret_cast<PyPredicate*>(type->tp_alloc(type, 0));
+    }
+
+    PyPredicate *PyPredicateDefault_new() {
+        return PyPredicate_new(&PyPredicateType, NULL, NULL);
+    }
+
+    void PyPredicate_del(PyPredicate* self)
+    {
+        // destroy associated instance
+        self->destroy();
+        Py_TYPE(self)->tp_free((PyObject*)self);
+    }
+
+    static PyObject *tryPyPredicate_repr(PyPredicate *self)
+    {
+        std::stringstream str;
+        str << "<dbzero.Predicate ";
+        self->ext().dump(str) << ">";
+        return PyUnicode_FromString(str.str().c_str());
+    }
+
+    static PyObject *PyAPI_PyPredicate_repr(PyPredicate *self)
+    {
+        PY_API_FUNC
+        return runSafe(tryPyPredicate_repr, self);
+    }
+
+    static PyObject *tryPyPredicate_and(PyObject *lhs, PyObject *rhs)
+    {
+        if (!PyPredicate_Check(lhs) || !PyPredicate_Check(rhs)) {
+            Py_RETURN_NOTIMPLEMENTED;
+        }
+        auto py_result = Py_OWN(PyPredicateDefault_new());
+        auto &result = py_result->makeNew(reinterpret_cast<PyPredicate*>(lhs)->ext());
+        result.append(reinterpret_cast<PyPredicate*>(rhs)->ext());
+        return py_result.steal();
+    }
+
+    static PyObject *PyAPI_PyPredicate_and(PyObject *lhs, PyObject *rhs)
+    {
+        PY_API_FUNC
+        return runSafe(tryPyPredicate_and, lhs, rhs);
+    }
+
+    // NOTE: predicates are not truth-tested (e.g. "if fields.value > 0:" is a mistake)
+    static int PyAPI_PyPredicate_bool(PyObject *)
+    {
+        PyErr_SetString(PyExc_TypeError, "Predicate has no truth value, pass it to dbzero.find or dbzero.filter");
+        return -1;
+    }
+
+    static PyNumberMethods PyPredicate_as_number = {
+        .nb_bool = (inquiry)PyAPI_PyPredicate_bool,
+        .nb_and = (binaryfunc)PyAPI_PyPredicate_and
+    };
+
+    PyTypeObject PyPredicateType = {
+        PYVAROBJECT_HEAD_INIT_DESIGNATED,
+        .tp_name = "dbzero.Predicate",
+        .tp_basicsize = PyPredicate::sizeOf(),
+        .tp_itemsize = 0,
+        .tp_dealloc = (destructor)PyPredicate_del,
+        .tp_repr = (reprfunc)PyAPI_PyPredicate_repr,
+        .tp_as_number = &PyPredicate_as_number,
+        .tp_flags = Py_TPFLAGS_DEFAULT,
+        .tp_doc = "Declarative predicate evaluated natively by queries",
+        .tp_alloc = PyType_GenericAlloc,
+        .tp_new = (newfunc)PyPredicate_new,
+        .tp_free = PyObject_Free,
+    };
+
+    bool PyPredicate_Check(PyObject *py_object) {
+        return Py_TYPE(py_object) == &PyPredicateType;
+    }
+
+    // @return false if the object is not supported as a predicate constant
+    static bool tryGetPredicateValue(PyObject *py_value, PredicateValue &value)
+    {
+        if (py_value == Py_None) {
+            value = PredicateValue::makeNone();
+        } else if (PyBool_Check(py_value)) {
+            value = PredicateValue::makeBool(py_value == Py_True);
+        } else if (PyLong_Check(py_value)) {
+            auto int_value = PyLong_AsLongLong(py_value);
+            if (int_value == -1 && PyErr_Occurred()) {
+                // out of the int64 range
+                PyErr_Clear();
+                return false;
+            }
+            value = PredicateValue::makeInt(int_value);
+        } else if (PyFloat_Check(py_value)) {
+            value = PredicateValue::makeReal(PyFloat_AsDouble(py_value));
+        } else if (PyUnicode_Check(py_value)) {
+            Py_ssize_t size = 0;
+            auto str = PyUnicode_AsUTF8AndSize(py_value, &size);
+            if (!str) {
+                PyErr_Clear();
+                return false;
+            }
+            value = PredicateValue::makeString(std::string(str, size));
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    PyObject *tryMakePredicate(PyObject *py_field_def, PyObject *other, int op)
+    {
+        assert(PyFieldDef_Check(py_field_def));
+        CompareOp compare_op;
+        switch (op) {
+            case Py_EQ: compare_op = CompareOp::EQ; break;
+            case Py_NE: compare_op = CompareOp::NE; break;
+            case Py_LT: compare_op = CompareOp::LT; break;
+            case Py_LE: compare_op = CompareOp::LE; break;
+            case Py_GT: compare_op = CompareOp::GT; break;
+            case Py_GE: compare_op = CompareOp::GE; break;
+            default:
+                Py_RETURN_NOTIMPLEMENTED;
+        }
+        PredicateValue value;
+        if (!tryGetPredicateValue(other, value)) {
+            Py_RETURN_NOTIMPLEMENTED;
+        }
+        auto &field_def = reinterpret_cast<PyFieldDef*>(py_field_def)->ext();
+        auto py_predicate = Py_OWN(PyPredicateDefault_new());
+        py_predicate->makeNew(field_def.m_member.m_name, compare_op, value);
+        return py_predicate.steal();
+    }
+
+    PyObject *tryMakeEqualityPredicate(PyObject *py_field_def, PyObject *other, int op)
+    {
+        assert(op == Py_EQ || op == Py_NE);
+        auto result = tryMakePredicate(py_field_def, other, op);
+        if (result == Py_NotImplemented) {
+            Py_DECREF(result);
+            THROWF(db0::InputException) << "Unsupported predicate constant of type: " << Py_TYPE(other)->tp_name
+                << " (expected None, bool, int, float or str)" << THROWF_END;
+        }
+        return result;
+    }
+
+    PyObject *tryWhere(PyObject *const *args, Py_ssize_t nargs)
+    {
+        auto py_result = Py_OWN(PyPredicateDefault_new());
+        auto &result = py_result->makeNew();
+        for (Py_ssize_t i = 0; i < nargs; ++i) {
+            if (!PyPredicate_Check(args[i])) {
+                THROWF(db0::InputException) << "where: expected a predicate (e.g. MemoClass.__fields__.value > 0)"
+                    << THROWF_END;
+            }
+            result.append(reinterpret_cast<PyPredicate*>(args[i])->ext());
+        }
+        return py_result.steal();
+    }
+
+    PyObject *PyAPI_where(PyObject *, PyObject *const *args, Py_ssize_t nargs)
+    {
+        PY_API_FUNC
+        if (nargs < 1) {
+            PyErr_SetString(PyExc_TypeError, "where: expected at least 1 predicate");
+            return NULL;
+        }
+        return runSafe(tryWhere, args, nargs);
+    }
+
+}
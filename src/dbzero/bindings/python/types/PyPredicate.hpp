@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#pragma once
+
+#include <Python.h>
+#include <dbzero/bindings/python/PyWrapper.hpp>
+#include <dbzero/object_model/tags/Predicate.hpp>
+
+namespace db0::python
+
+{
+
+    using Predicate = db0::object_model::Predicate;
+    using PyPredicate = PyWrapper<Predicate, false>;
+
+    PyPredicate *PyPredicate_new(PyTypeObject *type, PyObject *, PyObject *);
+    PyPredicate *PyPredicateDefault_new();
+
+    void PyPredicate_del(PyPredicate *);
+    extern PyTypeObject PyPredicateType;
+
+    bool PyPredicate_Check(PyObject *);
+
+    // Compare member (FieldDef) with a constant, returns NotImplemented for unsupported constants
+    PyObject *tryMakePredicate(PyObject *py_field_def, PyObject *other, int op);
+    // Same as tryMakePredicate (Py_EQ / Py_NE) but throws on unsupported constants
+    PyObject *tryMakeEqualityPredicate(PyObject *py_field_def, PyObject *other, int op);
+
+    // Combine predicates (logical AND)
+    PyObject *PyAPI_where(PyObject *, PyObject *const *args, Py_ssize_t nargs);
+
+}
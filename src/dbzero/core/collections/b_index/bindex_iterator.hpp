@@ -55,6 +55,8 @@ namespace db0::bindex::iterator
     template <typename item_t> using getLimitPtr = const item_t& (*)(const void *this_ptr);
     template <typename item_t> using clonePtr = std::shared_ptr<void> (*)(const void *this_ptr);
     template <typename item_t> using isNextKeyDuplicatedPtr = bool (*)(const void *this_ptr);
+    template <typename item_t> using getRunPtr = bool (*)(const void *this_ptr, const item_t *&, const item_t *&);
+    template <typename item_t> using skipPtr = std::size_t (*)(void *this_ptr, std::size_t count);
 
     template <typename item_t, typename T> struct IncrementFunctor {
     };
@@ -95,6 +97,12 @@ namespace db0::bindex::iterator
     template <typename item_t, typename T> struct IsNextKeyDuplicatedFunctor {
     };
 
+    template <typename item_t, typename T> struct GetRunFunctor {
+    };
+
+    template <typename item_t, typename T> struct SkipFunctor {
+    };
+
     /**
      * empty_index::const_iterator specializations
      */
@@ -179,6 +187,18 @@ namespace db0::bindex::iterator
         }
     };
 
+    template <typename item_t, typename... T> struct GetRunFunctor<item_t, empty_joinable_const<T...> > {
+        static bool execute(const void *, const item_t *&, const item_t *&) {
+            return false;
+        }
+    };
+
+    template <typename item_t, typename... T> struct SkipFunctor<item_t, empty_joinable_const<T...> > {
+        static std::size_t execute(void *, std::size_t) {
+            return 0;
+        }
+    };
+
     /**
      * itty_index::const_iterator specializations
      */
@@ -269,6 +289,22 @@ namespace db0::bindex::iterator
         }
     };
 
+    template <typename item_t, typename... T>
+    struct GetRunFunctor<item_t, itty_joinable_const<item_t, T...> > {
+        static bool execute(const void *this_ptr, const item_t *&begin, const item_t *&end) {
+            using self_t = itty_joinable_const<item_t, T...>;
+            return static_cast<const self_t*>(this_ptr)->getRun(begin, end);
+        }
+    };
+
+    template <typename item_t, typename... T>
+    struct SkipFunctor<item_t, itty_joinable_const<item_t, T...> > {
+        static std::size_t execute(void *this_ptr, std::size_t count) {
+            using self_t = itty_joinable_const<item_t, T...>;
+            return static_cast<self_t*>(this_ptr)->skip(count);
+        }
+    };
+
     /**
      * array_index::joinable_const_iterator specializations
      */
@@ -364,6 +400,22 @@ namespace db0::bindex::iterator
             return it.isNextKeyDuplicated();
         }
     };
+
+    template <typename item_t, int N, typename... T>
+    struct GetRunFunctor<item_t, array_joinable_const<item_t, N, T...> > {
+        static bool execute(const void *this_ptr, const item_t *&begin, const item_t *&end) {
+            using self_t = array_joinable_const<item_t, N, T...>;
+            return static_cast<const self_t*>(this_ptr)->getRun(begin, end);
+        }
+    };
+
+    template <typename item_t, int N, typename... T>
+    struct SkipFunctor<item_t, array_joinable_const<item_t, N, T...> > {
+        static std::size_t execute(void *this_ptr, std::size_t count) {
+            using self_t = array_joinable_const<item_t, N, T...>;
+            return static_cast<self_t*>(this_ptr)->skip(count);
+        }
+    };
     
     /**
      * v_sorted_vector::joinable_const_iterator specializations
@@ -461,6 +513,22 @@ namespace db0::bindex::iterator
         }
     };
 
+    template <typename item_t, typename... T>
+    struct GetRunFunctor<item_t, sorted_vector_joinable_const<item_t, T...> > {
+        static bool execute(const void *this_ptr, const item_t *&begin, const item_t *&end) {
+            using self_t = sorted_vector_joinable_const<item_t, T...>;
+            return static_cast<const self_t*>(this_ptr)->getRun(begin, end);
+        }
+    };
+
+    template <typename item_t, typename... T>
+    struct SkipFunctor<item_t, sorted_vector_joinable_const<item_t, T...> > {
+        static std::size_t execute(void *this_ptr, std::size_t count) {
+            using self_t = sorted_vector_joinable_const<item_t, T...>;
+            return static_cast<self_t*>(this_ptr)->skip(count);
+        }
+    };
+
     /**
      * bindex::joinable_const_iterator specializations
      */
@@ -557,6 +625,22 @@ namespace db0::bindex::iterator
         }
     };
 
+    template <typename item_t, typename... T>
+    struct GetRunFunctor<item_t, bindex_joinable_const<item_t, T...> > {
+        static bool execute(const void *this_ptr, const item_t *&begin, const item_t *&end) {
+            using self_t = bindex_joinable_const<item_t, T...>;
+            return static_cast<const self_t*>(this_ptr)->getRun(begin, end);
+        }
+    };
+
+    template <typename item_t, typename... T>
+    struct SkipFunctor<item_t, bindex_joinable_const<item_t, T...> > {
+        static std::size_t execute(void *this_ptr, std::size_t count) {
+            using self_t = bindex_joinable_const<item_t, T...>;
+            return static_cast<self_t*>(this_ptr)->skip(count);
+        }
+    };
+
     template <typename item_t> struct ImplFunctions {
         incrementPtr<item_t> m_increment_ptr;
         decrementPtr<item_t> m_decrement_ptr;
@@ -571,6 +655,8 @@ namespace db0::bindex::iterator
         getLimitPtr<item_t> m_get_limit_ptr;
         clonePtr<item_t> m_clone_ptr;
         isNextKeyDuplicatedPtr<item_t> m_is_next_key_duplicated_ptr;
+        getRunPtr<item_t> m_get_run_ptr;
+        skipPtr<item_t> m_skip_ptr;
     };
 
     /**
@@ -605,7 +691,9 @@ namespace db0::bindex::iterator
                 HasLimitFunctor<item_t, T>::execute,
                 GetLimitFunctor<item_t, T>::execute,
                 CloneFunctor<item_t, T>::execute,
-                IsNextKeyDuplicatedFunctor<item_t, T>::execute
+                IsNextKeyDuplicatedFunctor<item_t, T>::execute,
+                GetRunFunctor<item_t, T>::execute,
+                SkipFunctor<item_t, T>::execute
             }
         {
         }
@@ -718,6 +806,16 @@ namespace db0::bindex::iterator
             return m_functions.m_is_next_key_duplicated_ptr(m_ptr);
         }
 
+        // Get the contiguous run of items remaining to be visited within the current block (if available)
+        bool getRun(const item_t *&begin, const item_t *&end) const {
+            return m_functions.m_get_run_ptr(m_ptr, begin, end);
+        }
+
+        // Advance by up to count items in the direction of iteration
+        std::size_t skip(std::size_t count) {
+            return m_functions.m_skip_ptr(m_ptr, count);
+        }
+
     private:
         std::shared_ptr<void> m_ref;
         void *m_ptr = nullptr;
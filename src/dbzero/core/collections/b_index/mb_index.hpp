@@ -556,6 +556,23 @@ namespace db0
 				return m_iterator.isNextKeyDuplicated();
 			}
 
+			/**
+			 * Get the contiguous run of items remaining to be visited within the current block of the
+			 * underlying morphology, allows block-at-a-time processing
+			 * @return false if not available
+			 */
+			bool getRun(const item_t *&begin, const item_t *&end) const {
+				return m_iterator.getRun(begin, end);
+			}
+
+			/**
+			 * Advance by up to count items in the direction of iteration (without visiting individual items where possible)
+			 * @return the number of items actually skipped
+			 */
+			std::size_t skip(std::size_t count) {
+				return m_iterator.skip(count);
+			}
+
         private:
             // morphology specific iterator interface
             iterator_t m_iterator;
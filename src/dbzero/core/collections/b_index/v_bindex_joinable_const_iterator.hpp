@@ -477,6 +477,64 @@ namespace db0
 
             return !m_comp(*m_it_data, *it_data_next) && !m_comp(*it_data_next, *m_it_data);
         }
+
+        /**
+         * Get the contiguous range of items remaining to be visited within the current data block
+         * @return false if not available (end or bounded iterator)
+         */
+        bool getRun(const item_t *&begin, const item_t *&end) const
+        {
+            if (is_end() || m_bound_check.hasBound()) {
+                return false;
+            }
+            return m_it_data.getRun(m_direction, begin, end);
+        }
+
+        /**
+         * Advance by up to count items in the direction of iteration
+         * whole data blocks are passed by their sizes, without visiting individual items
+         * @return the number of items actually skipped
+         */
+        std::size_t skip(std::size_t count)
+        {
+            std::size_t result = 0;
+            while (result < count && !is_end()) {
+                if (m_bound_check.hasBound()) {
+                    // bounds need to be validated item by item
+                    if (m_direction > 0) {
+                        ++(*this);
+                    } else {
+                        --(*this);
+                    }
+                    ++result;
+                    continue;
+                }
+                // number of items remaining in the current block (including the current one)
+                auto range = m_it_data.getIndexRange();
+                std::size_t remaining = (m_direction > 0) ? (range.second - range.first) : (range.first - range.second);
+                if (count - result < remaining) {
+                    return result + m_it_data.skip(count - result);
+                }
+                result += remaining;
+                if (m_direction > 0) {
+                    ++m_node;
+                    if (m_node == m_index_ptr->end()) {
+                        set_end();
+                        break;
+                    }
+                } else {
+                    if (m_node == m_index_ptr->begin()) {
+                        set_end();
+                        break;
+                    }
+                    --m_node;
+                }
+                // open bucket / bucket iterator
+                m_data_buf = data_vector(m_index_ptr->myPtr(m_node->m_data.ptr_b_data));
+                m_it_data = m_data_buf->beginJoin(m_direction);
+            }
+            return result;
+        }
         
     protected:
         friend class vso_b_index;
@@ -2,6 +2,7 @@
 // Copyright (c) 2025 DBZero Software sp. z o.o.
 
 #include <cassert>
+#include <type_traits>
 #include "FT_ANDIterator.hpp"
 #include "FT_Serialization.hpp"
 #include <dbzero/core/serialization/hash.hpp>
@@ -9,6 +10,33 @@
 namespace db0
 
 {
+    
+    namespace
+    {
+        
+        // key types which can be processed as runs of 64-bit integers
+        template <typename KeyT> constexpr bool is_run_key_v = 
+            std::is_same_v<KeyT, std::uint64_t> || std::is_same_v<KeyT, UniqueAddress>;
+        
+        template <typename KeyT> std::uint64_t toRunKey(const KeyT &key)
+        {
+            if constexpr (std::is_same_v<KeyT, UniqueAddress>) {
+                return key.getValue();
+            } else {
+                return key;
+            }
+        }
+        
+        template <typename KeyT> KeyT fromRunKey(std::uint64_t key)
+        {
+            if constexpr (std::is_same_v<KeyT, UniqueAddress>) {
+                return UniqueAddress::fromValue(key);
+            } else {
+                return key;
+            }
+        }
+        
+    }
 
     template <typename key_t, bool UniqueKeys, typename key_storage_t>
     FT_JoinANDIterator<key_t, UniqueKeys, key_storage_t>::FT_JoinANDIterator(
@@ -33,6 +61,7 @@ namespace db0
                     return;
                 }
             }
+            m_block_join = canBlockJoin();
             (*m_joinable.front()).getKey(m_join_key);
             joinAll();
         }
@@ -55,6 +84,7 @@ namespace db0
                     return;
                 }
             }
+            m_block_join = canBlockJoin();
             (*m_joinable.front()).getKey(m_join_key);
             joinAll();
         }
@@ -262,6 +292,9 @@ namespace db0
 	template <typename key_t, bool UniqueKeys, typename key_storage_t>
     void FT_JoinANDIterator<key_t, UniqueKeys, key_storage_t>::joinAll()
     {
+        if (m_block_join && joinBlocks()) {
+            return;
+        }
         auto it = m_joinable.begin(), end = m_joinable.end();
         assert(it != end);
         assert(!(**it).isEnd());
@@ -283,6 +316,63 @@ namespace db0
         }
     }
     
+    template <typename key_t, bool UniqueKeys, typename key_storage_t>
+    bool FT_JoinANDIterator<key_t, UniqueKeys, key_storage_t>::canBlockJoin() const
+    {
+        if constexpr (is_run_key_v<key_t>) {
+            KeyRun run;
+            for (auto &joinable: m_joinable) {
+                if (!(*joinable).getRun(run)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        return false;
+    }
+    
+    template <typename key_t, bool UniqueKeys, typename key_storage_t>
+    bool FT_JoinANDIterator<key_t, UniqueKeys, key_storage_t>::joinBlocks()
+    {
+        if constexpr (is_run_key_v<key_t>) {
+            assert(!(*m_joinable.front()).isEnd());
+            for (;;) {
+                m_runs.resize(m_joinable.size());
+                auto run = m_runs.begin();
+                for (auto &joinable: m_joinable) {
+                    if (!(*joinable).getRun(*run)) {
+                        return false;
+                    }
+                    ++run;
+                }
+                auto key = toRunKey(m_join_key);
+                std::size_t exhausted = 0;
+                if (findCommonKey(m_runs.data(), m_runs.size(), m_direction, key, exhausted)) {
+                    m_join_key = fromRunKey<key_t>(key);
+                    // position all iterators at the common key (within their current blocks)
+                    for (auto &joinable: m_joinable) {
+                        if (!(*joinable).join(m_join_key, m_direction)) {
+                            setEnd();
+                            return true;
+                        }
+                    }
+                    return true;
+                }
+                // move the exhausted iterator past its current block and continue with it as the head
+                auto it = m_joinable.begin() + exhausted;
+                if (!(**it).join(fromRunKey<key_t>(key), m_direction)) {
+                    setEnd();
+                    return true;
+                }
+                (**it).getKey(m_join_key);
+                if (it != m_joinable.begin()) {
+                    m_joinable.swapFront(it);
+                }
+            }
+        }
+        return false;
+    }
+    
 	template <typename key_t, bool UniqueKeys, typename key_storage_t>
 	void db0::FT_JoinANDIterator<key_t, UniqueKeys, key_storage_t>
         ::scanQueryTree(std::function<void(const FT_Iterator<key_t, key_storage_t> *it_ptr, int depth)> scan_function,
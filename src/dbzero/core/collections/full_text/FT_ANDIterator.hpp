@@ -120,6 +120,9 @@ namespace db0
 		mutable IteratorGroup<key_t, key_storage_t> m_joinable;
 		bool m_end;
 		key_storage_t m_join_key;
+        // flag indicating that all inner iterators expose runs of keys (see FT_Iterator::getRun)
+        bool m_block_join = false;
+        std::vector<KeyRun> m_runs;
         
 		void setEnd();
 
@@ -127,6 +130,11 @@ namespace db0
         void _next(void*);
         void _nextUnique();
 		void joinAll();
+        
+        bool canBlockJoin() const;
+        // Join block-at-a-time using the posting kernels
+        // @return false if not possible (e.g. runs not available), the regular join should be used then
+        bool joinBlocks();
 
 		FT_JoinANDIterator(std::uint64_t uid, std::list<std::unique_ptr<FT_IteratorT> > &&inner_iterators,
             int direction, bool lazy_init = false);
@@ -9,11 +9,34 @@
 #include <dbzero/core/collections/b_index/mb_index.hpp>
 #include <dbzero/core/serialization/Serializable.hpp>
 #include <optional>
+#include <type_traits>
 
 namespace db0
 
 {
     
+	// Detects native iterators capable of exposing contiguous runs of items
+	template <typename IteratorT, typename ItemT, typename = void>
+	struct has_get_run: std::false_type {};
+
+	template <typename IteratorT, typename ItemT>
+	struct has_get_run<IteratorT, ItemT, std::void_t<decltype(std::declval<const IteratorT &>().getRun(
+		std::declval<const ItemT *&>(), std::declval<const ItemT *&>()))> >: std::true_type {};
+
+	// Detects native iterators capable of skipping multiple items at once
+	template <typename IteratorT, typename = void>
+	struct has_skip: std::false_type {};
+
+	template <typename IteratorT>
+	struct has_skip<IteratorT, std::void_t<decltype(std::declval<IteratorT &>().skip(std::size_t()))> >: std::true_type {};
+
+	// Detects collections with the size available
+	template <typename T, typename = void>
+	struct has_size: std::false_type {};
+
+	template <typename T>
+	struct has_size<T, std::void_t<decltype(std::declval<const T &>().size())> >: std::true_type {};
+
 	/**
 	 * bindex_t - some bindex derived type with key_t (e.g. std::uint64_t) derived keys (v_bindex)
 	 * implements FT_Iterator interface over b-index data structure
@@ -56,6 +79,13 @@ namespace db0
 
 		bool isNextKeyDuplicated() const override;
 
+		bool getRun(KeyRun &) const override;
+
+		bool tryGetSize(std::size_t &) const override;
+
+		// Skip over whole blocks of the underlying collection (where supported)
+		bool skip(std::size_t count) override;
+
         std::unique_ptr<FT_Iterator<key_t> > beginTyped(int direction = -1) const override;
 
 		bool limitBy(key_t key) override;
@@ -322,5 +352,47 @@ namespace db0
 	bool FT_IndexIterator<bindex_t, key_t, IndexKeyT>::isNextKeyDuplicated() const {
 		return getIterator().isNextKeyDuplicated();
 	}
+
+	template <typename bindex_t, typename key_t, typename IndexKeyT>
+	bool FT_IndexIterator<bindex_t, key_t, IndexKeyT>::getRun(KeyRun &run) const
+	{
+		using item_t = std::decay_t<decltype(*std::declval<const iterator &>())>;
+		// only runs of plain 64-bit keys can be exposed
+		if constexpr (std::is_same_v<item_t, key_t> && sizeof(key_t) == sizeof(std::uint64_t)
+			&& (std::is_same_v<key_t, std::uint64_t> || std::is_same_v<key_t, UniqueAddress>)
+			&& has_get_run<iterator, item_t>::value)
+		{
+			const item_t *begin, *end;
+			if (!getIterator().getRun(begin, end)) {
+				return false;
+			}
+			run.m_begin = reinterpret_cast<const std::uint64_t*>(begin);
+			run.m_end = reinterpret_cast<const std::uint64_t*>(end);
+			return true;
+		} else {
+			return false;
+		}
+	}
+
+	template <typename bindex_t, typename key_t, typename IndexKeyT>
+	bool FT_IndexIterator<bindex_t, key_t, IndexKeyT>::tryGetSize(std::size_t &size) const
+	{
+		if constexpr (has_size<bindex_t>::value) {
+			size = m_data.size();
+			return true;
+		} else {
+			return false;
+		}
+	}
+
+	template <typename bindex_t, typename key_t, typename IndexKeyT>
+	bool FT_IndexIterator<bindex_t, key_t, IndexKeyT>::skip(std::size_t count)
+	{
+		if constexpr (has_skip<iterator>::value) {
+			return getIterator().skip(count) == count;
+		} else {
+			return super_t::skip(count);
+		}
+	}
 	
-} 
+}
@@ -78,6 +78,16 @@ namespace db0
     std::size_t FT_Iterator<key_t, key_storage_t>::getDepth() const {
         return 1u;
     }
+
+    template <typename key_t, typename key_storage_t> 
+    bool FT_Iterator<key_t, key_storage_t>::getRun(KeyRun &) const {
+        return false;
+    }
+
+    template <typename key_t, typename key_storage_t> 
+    bool FT_Iterator<key_t, key_storage_t>::tryGetSize(std::size_t &) const {
+        return false;
+    }
     
     template <typename key_t, typename key_storage_t>
     bool FT_Iterator<key_t, key_storage_t>::swapKey(key_storage_t &key) const
@@ -9,6 +9,7 @@
 
 #include "FT_IteratorBase.hpp"
 #include "CP_Vector.hpp"
+#include "posting_kernels.hpp"
 #include <dbzero/core/serialization/Serializable.hpp>
 #include <dbzero/core/memory/Address.hpp>
 
@@ -26,6 +27,7 @@ namespace db0
         JoinOr = 4,
         JoinAndNot = 5,
         FixedKey = 6,
+        Predicate = 7,
     };
     
     using Serializable = db0::serial::Serializable;
@@ -98,6 +100,21 @@ namespace db0
         // Look-up the next element without advancing the iterator
         // @return true if the next key exists & is identical as the current one
         virtual bool isNextKeyDuplicated() const = 0;
+
+        /**
+         * Get the contiguous run of 64-bit keys remaining to be visited within the current block
+         * of the underlying collection (including the current key), allows block-at-a-time joins
+         * The default implementation reports the run as not available
+         * @return false if not available
+         */
+        virtual bool getRun(KeyRun &) const;
+
+        /**
+         * Get the exact number of items yielded by a new iteration (e.g. started with beginTyped)
+         * without iterating over them, the default implementation reports the size as not available
+         * @return false if not available
+         */
+        virtual bool tryGetSize(std::size_t &) const;
         
 		/**
 		 * Begin iteration as a typed FT_Iterator in a given direction,
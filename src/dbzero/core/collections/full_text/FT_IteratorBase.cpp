@@ -60,5 +60,8 @@ namespace db0
         }
         return true;
     }
+
+    void FT_IteratorBase::setLimit(std::size_t) {
+    }
     
 }
\ No newline at end of file
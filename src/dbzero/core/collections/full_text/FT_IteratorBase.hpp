@@ -95,6 +95,10 @@ namespace db0
         // @param count number of elements to skip, allowed to exceed the underlying collection size
         // @return false if the end position is reached
         virtual bool skip(std::size_t count);
+
+        // Hint the maximum number of items which will be retrieved (e.g. known from a slice)
+        // the iterator is allowed to end after yielding max_count items, the default implementation ignores the hint
+        virtual void setLimit(std::size_t max_count);
         
     protected:
         // auto-generated instace UID (preserved in copies - e.g. created during begin / clone etc.)
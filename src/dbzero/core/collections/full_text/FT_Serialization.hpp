@@ -18,6 +18,7 @@
 #include <dbzero/core/collections/b_index/mb_index.hpp>
 #include <dbzero/core/collections/range_tree/RangeIteratorFactory.hpp>
 #include <dbzero/object_model/tags/TagIndex.hpp>
+#include <dbzero/object_model/tags/PredicateIterator.hpp>
 
 namespace db0
 
@@ -109,6 +110,15 @@ namespace db0
                 }                
             }
             THROWF(db0::InternalException) << "Unsupported key type ID: " << key_type_id << THROWF_END;            
+        } else if (type_id == FTIteratorType::Predicate) {
+            auto _iter = iter;
+            auto key_type_id = db0::serial::read<TypeIdType>(_iter, end);
+            if (key_type_id == db0::serial::typeId<UniqueAddress>()) {
+                if constexpr (std::is_same_v<KeyT, UniqueAddress>) {
+                    return db0::object_model::PredicateIterator::deserialize(workspace, iter, end);
+                }
+            }
+            THROWF(db0::InternalException) << "Unsupported key type ID: " << key_type_id << THROWF_END;
         } else {
             THROWF(db0::InternalException) << "Unsupported FT_Iterator type: " << static_cast<std::uint16_t>(type_id) 
                 << THROWF_END;
@@ -0,0 +1,264 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#include "posting_kernels.hpp"
+#include <atomic>
+#include <algorithm>
+#include <cassert>
+#include <dbzero/core/exception/Exceptions.hpp>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #include <immintrin.h>
+    // the AVX2 variant is compiled with function-level target attributes and selected at runtime
+    #define DB0_POSTING_X86_DISPATCH
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+    #include <arm_neon.h>
+    #define DB0_POSTING_NEON
+#endif
+
+namespace db0
+
+{
+
+    namespace
+    {
+
+        // window size below which the items are counted linearly (branch-free)
+        static constexpr std::size_t WINDOW_SIZE = 16;
+
+        std::size_t scalarCountLessSmall(const std::uint64_t *data, std::size_t size, std::uint64_t key)
+        {
+            std::size_t result = 0;
+            for (std::size_t i = 0; i < size; ++i) {
+                result += data[i] < key;
+            }
+            return result;
+        }
+
+        std::size_t scalarCountGreaterSmall(const std::uint64_t *data, std::size_t size, std::uint64_t key)
+        {
+            std::size_t result = 0;
+            for (std::size_t i = 0; i < size; ++i) {
+                result += data[i] > key;
+            }
+            return result;
+        }
+
+        // Gallop from the front to narrow down the window, then count linearly
+        template <std::size_t (*CountSmall)(const std::uint64_t *, std::size_t, std::uint64_t)>
+        std::size_t countLess(const std::uint64_t *data, std::size_t size, std::uint64_t key)
+        {
+            if (size <= WINDOW_SIZE || data[WINDOW_SIZE - 1] >= key) {
+                return CountSmall(data, std::min(size, WINDOW_SIZE), key);
+            }
+            // the result is within [lo, hi]
+            std::size_t lo = WINDOW_SIZE, hi = size;
+            for (std::size_t probe = 2 * WINDOW_SIZE; probe < size; probe *= 2) {
+                if (data[probe - 1] >= key) {
+                    hi = probe;
+                    break;
+                }
+                lo = probe;
+            }
+            while (hi - lo > WINDOW_SIZE) {
+                auto mid = lo + (hi - lo) / 2;
+                if (data[mid] < key) {
+                    lo = mid + 1;
+                } else {
+                    hi = mid;
+                }
+            }
+            return lo + CountSmall(data + lo, hi - lo, key);
+        }
+
+        // Mirrored version of countLess (gallop from the back)
+        template <std::size_t (*CountSmall)(const std::uint64_t *, std::size_t, std::uint64_t)>
+        std::size_t countGreater(const std::uint64_t *data, std::size_t size, std::uint64_t key)
+        {
+            if (size <= WINDOW_SIZE || data[size - WINDOW_SIZE] <= key) {
+                auto window = std::min(size, WINDOW_SIZE);
+                return CountSmall(data + size - window, window, key);
+            }
+            std::size_t lo = WINDOW_SIZE, hi = size;
+            for (std::size_t probe = 2 * WINDOW_SIZE; probe < size; probe *= 2) {
+                if (data[size - probe] <= key) {
+                    hi = probe;
+                    break;
+                }
+                lo = probe;
+            }
+            while (hi - lo > WINDOW_SIZE) {
+                auto mid = lo + (hi - lo) / 2;
+                if (data[size - 1 - mid] > key) {
+                    lo = mid + 1;
+                } else {
+                    hi = mid;
+                }
+            }
+            return lo + CountSmall(data + size - hi, hi - lo, key);
+        }
+
+        const PostingKernels scalar_kernels = {
+            SIMD_Level::SCALAR, countLess<scalarCountLessSmall>, countGreater<scalarCountGreaterSmall>
+        };
+
+#if defined(DB0_POSTING_X86_DISPATCH)
+        // NOTE: AVX2 only provides signed 64-bit compares, the sign bit is flipped to compare unsigned values
+        template <bool Less>
+        __attribute__((target("avx2,popcnt")))
+        std::size_t avx2CountSmall(const std::uint64_t *data, std::size_t size, std::uint64_t key)
+        {
+            const __m256i sign = _mm256_set1_epi64x(static_cast<long long>(0x8000000000000000ull));
+            const __m256i k = _mm256_xor_si256(_mm256_set1_epi64x(static_cast<long long>(key)), sign);
+            std::size_t result = 0;
+            std::size_t i = 0;
+            for (; i + 4 <= size; i += 4) {
+                auto x = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)), sign);
+                auto mask = Less ? _mm256_cmpgt_epi64(k, x) : _mm256_cmpgt_epi64(x, k);
+                result += _mm_popcnt_u32(_mm256_movemask_pd(_mm256_castsi256_pd(mask)));
+            }
+            if (Less) {
+                return result + scalarCountLessSmall(data + i, size - i, key);
+            }
+            return result + scalarCountGreaterSmall(data + i, size - i, key);
+        }
+
+        __attribute__((target("avx2,popcnt")))
+        std::size_t avx2CountLessSmall(const std::uint64_t *data, std::size_t size, std::uint64_t key) {
+            return avx2CountSmall<true>(data, size, key);
+        }
+
+        __attribute__((target("avx2,popcnt")))
+        std::size_t avx2CountGreaterSmall(const std::uint64_t *data, std::size_t size, std::uint64_t key) {
+            return avx2CountSmall<false>(data, size, key);
+        }
+
+        const PostingKernels avx2_kernels = {
+            SIMD_Level::AVX2, countLess<avx2CountLessSmall>, countGreater<avx2CountGreaterSmall>
+        };
+#endif
+
+#if defined(DB0_POSTING_NEON)
+        template <bool Less>
+        std::size_t neonCountSmall(const std::uint64_t *data, std::size_t size, std::uint64_t key)
+        {
+            const uint64x2_t k = vdupq_n_u64(key);
+            // matching lanes are all-ones (i.e. -1), subtract to count them
+            uint64x2_t acc = vdupq_n_u64(0);
+            std::size_t i = 0;
+            for (; i + 2 <= size; i += 2) {
+                auto x = vld1q_u64(data + i);
+                acc = vsubq_u64(acc, Less ? vcltq_u64(x, k) : vcgtq_u64(x, k));
+            }
+            std::size_t result = vgetq_lane_u64(acc, 0) + vgetq_lane_u64(acc, 1);
+            if (Less) {
+                return result + scalarCountLessSmall(data + i, size - i, key);
+            }
+            return result + scalarCountGreaterSmall(data + i, size - i, key);
+        }
+
+        const PostingKernels neon_kernels = {
+            SIMD_Level::NEON, countLess<neonCountSmall<true> >, countGreater<neonCountSmall<false> >
+        };
+#endif
+
+        const PostingKernels *findKernels(SIMD_Level level)
+        {
+            switch (level) {
+                case SIMD_Level::SCALAR:
+                    return &scalar_kernels;
+#if defined(DB0_POSTING_X86_DISPATCH)
+                case SIMD_Level::AVX2:
+                    __builtin_cpu_init();
+                    return (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) ? &avx2_kernels : nullptr;
+#endif
+#if defined(DB0_POSTING_NEON)
+                case SIMD_Level::NEON:
+                    return &neon_kernels;
+#endif
+                default:
+                    return nullptr;
+            }
+        }
+
+        const PostingKernels *findBestKernels()
+        {
+            for (auto level: { SIMD_Level::AVX2, SIMD_Level::NEON }) {
+                if (auto result = findKernels(level)) {
+                    return result;
+                }
+            }
+            return &scalar_kernels;
+        }
+
+        std::atomic<const PostingKernels *> &activeKernels()
+        {
+            static std::atomic<const PostingKernels *> active(findBestKernels());
+            return active;
+        }
+
+    }
+
+    const PostingKernels &getPostingKernels() {
+        return *activeKernels().load(std::memory_order_relaxed);
+    }
+
+    const PostingKernels &getPostingKernels(SIMD_Level level)
+    {
+        auto result = findKernels(level);
+        if (!result) {
+            THROWF(db0::InternalException) << "SIMD level not supported: " << static_cast<int>(level);
+        }
+        return *result;
+    }
+
+    bool setPostingKernels(SIMD_Level level)
+    {
+        auto kernels = findKernels(level);
+        if (!kernels) {
+            return false;
+        }
+        activeKernels().store(kernels, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool findCommonKey(KeyRun *runs, std::size_t count, int direction, std::uint64_t &key,
+        std::size_t &exhausted)
+    {
+        assert(count > 0);
+        auto &kernels = getPostingKernels();
+        // number of runs positioned at "key"
+        std::size_t matched = 0;
+        for (std::size_t i = 0;; i = (i + 1 == count) ? 0 : i + 1) {
+            auto &run = runs[i];
+            std::uint64_t item;
+            if (direction > 0) {
+                run.m_begin += kernels.countLess(run.m_begin, run.size(), key);
+                if (run.empty()) {
+                    exhausted = i;
+                    return false;
+                }
+                item = *run.m_begin;
+            } else {
+                run.m_end -= kernels.countGreater(run.m_begin, run.size(), key);
+                if (run.empty()) {
+                    exhausted = i;
+                    return false;
+                }
+                item = run.m_end[-1];
+            }
+            if (item == key) {
+                if (++matched == count) {
+                    return true;
+                }
+            } else {
+                // continue with the new candidate
+                key = item;
+                matched = 1;
+            }
+        }
+    }
+
+}
@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <dbzero/core/memory/diff_kernels.hpp>
+
+namespace db0
+
+{
+
+    // A contiguous run of sorted 64-bit keys (ascending in memory)
+    struct KeyRun
+    {
+        const std::uint64_t *m_begin = nullptr;
+        const std::uint64_t *m_end = nullptr;
+
+        inline bool empty() const {
+            return m_begin == m_end;
+        }
+
+        inline std::size_t size() const {
+            return m_end - m_begin;
+        }
+    };
+
+    // Search primitives over sorted runs of 64-bit keys, used for block-at-a-time joins of inverted lists
+    struct PostingKernels
+    {
+        SIMD_Level m_level;
+        // number of leading items < key (i.e. index of the first item >= key), galloping from the front
+        std::size_t (*countLess)(const std::uint64_t *, std::size_t size, std::uint64_t key);
+        // number of trailing items > key, galloping from the back
+        std::size_t (*countGreater)(const std::uint64_t *, std::size_t size, std::uint64_t key);
+    };
+
+    // Retrieve the currently active kernels (by default the best available)
+    const PostingKernels &getPostingKernels();
+
+    // Retrieve kernels of a specific implementation (must be supported)
+    // NOTE: only SCALAR, AVX2 and NEON variants exist (64-bit compares are not available with SSE2)
+    const PostingKernels &getPostingKernels(SIMD_Level);
+
+    // Override the active implementation (e.g. for testing / benchmarking)
+    // @return false if the level is not supported on the current CPU
+    bool setPostingKernels(SIMD_Level);
+
+    /**
+     * Leapfrog join over in-memory runs: locate the first key common to all runs,
+     * starting from "key" in the direction of iteration (ascending if direction > 0)
+     * Runs are narrowed to their unvisited parts
+     * @param exhausted index of the run which got exhausted (only set when returning false)
+     * @return true if found (key is set to the common key), false if any of the runs got exhausted,
+     * key is then set to the next candidate (beyond all items of the exhausted run)
+     */
+    bool findCommonKey(KeyRun *runs, std::size_t count, int direction, std::uint64_t &key,
+        std::size_t &exhausted);
+
+}
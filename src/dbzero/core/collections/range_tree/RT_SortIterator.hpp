@@ -6,6 +6,8 @@
 #include "RangeTree.hpp"
 #include "IndexBase.hpp"
 #include "FastQueue.hpp"
+#include <limits>
+#include <algorithm>
 #include <dbzero/core/collections/full_text/FT_IteratorBase.hpp>
 #include <dbzero/core/collections/full_text/FT_Iterator.hpp>
 #include <dbzero/core/collections/full_text/FT_ANDIterator.hpp>
@@ -23,6 +25,9 @@ namespace db0
     /**
      * The RT_SortIterator can iterate over a specific RangeTree + arbitraty full-text query iterator
      * and sort the results by the RangeTree key
+     * Blocks are ingested lazily in key order, so a limited iteration (see setLimit) terminates early
+     * and only retains the top items of each block. Sparse queries are materialized once and
+     * joined with the blocks from memory, dense ones are re-evaluated per block
      * @tparam KeyT type of the RangeTree key
      * @tparam ValueT type of the RangeTree value
     */
@@ -78,6 +83,8 @@ namespace db0
         SortedIteratorType getSerialTypeId() const override;
 
         void getSignature(std::vector<std::byte> &) const override;
+
+        void setLimit(std::size_t max_count) override;
         
     protected:
         void serializeImpl(std::vector<std::byte> &) const override;
@@ -126,7 +133,6 @@ namespace db0
                 m_null_it = std::move(m_null_query_it);
                 m_null_query_it = nullptr;
             }
-            fetchNext();            
         }
         
         struct HeapItem
@@ -164,6 +170,14 @@ namespace db0
         // fetch queue (non-final items)
         FastQueue<std::pair<HeapItem, bool>, 2> m_fetch_queue;
         bool m_is_end = false;
+        // the first item is fetched on first access (i.e. after the limit is known)
+        bool m_initialized = false;
+        // the maximum number of items to be yielded and the number of items fetched so far
+        std::size_t m_limit = std::numeric_limits<std::size_t>::max();
+        std::size_t m_count = 0;
+        // sorted results of a sparse FT query (used in place of m_query_it for joins with blocks)
+        std::vector<ValueT> m_query_values;
+        bool m_is_materialized = false;
 
         struct MaxCompT
         {
@@ -197,11 +211,69 @@ namespace db0
 
         // Feed the next item into the look-ahead buffer (if anything available)
         void fetchNext();
+
+        inline void pushNext(const HeapItem &item, bool is_null_key)
+        {
+            m_lh_queue.push(std::make_pair(item, is_null_key));
+            ++m_count;
+        }
+
+        inline void ensureInitialized() const
+        {
+            if (!m_initialized) {
+                const_cast<self_t&>(*this).init();
+            }
+        }
+
+        void init();
+
+        // Materialize the FT query if its cardinality does not exceed the average block size
+        void tryMaterializeQuery();
     };
     
-    template <typename KeyT, typename ValueT> bool RT_SortIterator<KeyT, ValueT>::isEnd() const {
+    template <typename KeyT, typename ValueT> bool RT_SortIterator<KeyT, ValueT>::isEnd() const
+    {
+        ensureInitialized();
         return m_lh_queue.empty();
     }
+
+    template <typename KeyT, typename ValueT> void RT_SortIterator<KeyT, ValueT>::setLimit(std::size_t max_count) {
+        m_limit = max_count;
+    }
+
+    template <typename KeyT, typename ValueT> void RT_SortIterator<KeyT, ValueT>::init()
+    {
+        m_initialized = true;
+        if (!m_is_end && m_has_query && m_tree_ptr && !m_tree_it.isEnd()) {
+            tryMaterializeQuery();
+        }
+        fetchNext();
+    }
+
+    template <typename KeyT, typename ValueT> void RT_SortIterator<KeyT, ValueT>::tryMaterializeQuery()
+    {
+        auto range_count = m_tree_ptr->getRangeCount();
+        if (range_count < 2) {
+            // a single block is joined only once
+            return;
+        }
+        // NOTE: the cost of materialization is bounded by a single block's scan,
+        // beyond this the query is considered dense and evaluated per block
+        auto max_size = m_tree_ptr->size() / range_count;
+        std::vector<ValueT> values;
+        auto it = m_query_it->beginTyped(-1);
+        while (!it->isEnd()) {
+            if (values.size() > max_size) {
+                return;
+            }
+            values.emplace_back();
+            it->next(&values.back());
+        }
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+        m_query_values = std::move(values);
+        m_is_materialized = true;
+    }
     
     template <typename KeyT, typename ValueT> std::unique_ptr<FT_Iterator<ValueT> >
     RT_SortIterator<KeyT, ValueT>::beginNullBlockQuery()
@@ -234,6 +306,7 @@ namespace db0
     template <typename KeyT, typename ValueT> void RT_SortIterator<KeyT, ValueT>::next(void *buf)
     {
         // pulls from the the look-ahead buffer and tries retrieving the next element        
+        ensureInitialized();
         if (buf) {
             *static_cast<ValueT*>(buf) = m_lh_queue.head().first.m_value;
         }
@@ -246,6 +319,10 @@ namespace db0
         if (m_is_end) {
             return;
         }
+        if (m_count >= m_limit) {
+            m_is_end = true;
+            return;
+        }
 
         if (m_inner_it) {
             for (;;) {
@@ -254,7 +331,7 @@ namespace db0
                     assert(!m_sorted_it->isEnd());
                     ValueT value;
                     m_sorted_it->next(&value);
-                    m_lh_queue.push(std::make_pair(HeapItem(m_sort_key, value), false));
+                    pushNext(HeapItem(m_sort_key, value), false);
                     if (m_sorted_it->isEnd()) {
                         m_sorted_it = nullptr;
                         m_sort_buffer.clear();
@@ -276,6 +353,7 @@ namespace db0
                     // since the null area was reached, finish with combining the
                     // null block and the inner sorted iterator
                     m_sorted_it = m_inner_it->beginSorted(beginNullBlockQuery());
+                    m_sorted_it->setLimit(m_limit - m_count);
                     if (m_sorted_it->isEnd()) {
                         // edge case when null items cannot be joined with the inner iterator
                         m_sorted_it = nullptr;
@@ -290,7 +368,7 @@ namespace db0
                 HeapItem next_item_2;
                 bool next_key_null_2 = false;
                 if (!tryNextSorted(next_item_2, next_key_null_2)) {
-                    m_lh_queue.push(std::make_pair(next_item_1, next_key_null_1));
+                    pushNext(next_item_1, next_key_null_1);
                     return;
                 }
 
@@ -320,6 +398,7 @@ namespace db0
                     
                     // sort the buffer with the inner iterator
                     m_sorted_it = m_inner_it->beginSorted(std::move(inner_query));
+                    m_sorted_it->setLimit(m_limit - m_count);
                     m_sorted_null_block = false;
                     // it might happen that values are not present in the inner iterator (need to be ignored)
                     if (m_sorted_it->isEnd()) {
@@ -330,7 +409,7 @@ namespace db0
                 } else {
                     // return item 2 to fetch buffer
                     m_fetch_queue.push(std::make_pair(next_item_2, next_key_null_2));
-                    m_lh_queue.push(std::make_pair(next_item_1, next_key_null_1));
+                    pushNext(next_item_1, next_key_null_1);
                     return;
                 }
             }
@@ -338,7 +417,7 @@ namespace db0
             HeapItem next_item;
             bool next_key_null = false;
             if (tryNextSorted(next_item, next_key_null)) {
-                m_lh_queue.push(std::make_pair(next_item, next_key_null));
+                pushNext(next_item, next_key_null);
             }
         }
     }
@@ -403,7 +482,12 @@ namespace db0
             // ingest another range (block of data) by joining with the query iterator
             // NOTE: use UniqueKey = false to retrieve object multiple times if added under different keys
             FT_ANDIteratorFactory<ValueT, false> and_factory;
-            if (m_has_query) {
+            if (m_is_materialized) {
+                using MemoryIndexT = FT_MemoryIndex<ValueT>;
+                and_factory.add(std::make_unique<FT_IndexIterator<MemoryIndexT, ValueT> >(
+                    MemoryIndexT(m_query_values.data(), m_query_values.data() + m_query_values.size()), -1
+                ));
+            } else if (m_has_query) {
                 and_factory.add(m_query_it->beginTyped(-1));
             }
 
@@ -418,10 +502,29 @@ namespace db0
             if (inner_it) {
                 // cast to well known type
                 const auto &rt_inner_it = *static_cast<const RT_IteratorT*>(inner_it);
+                // with a limit (and no inner sort) only the top remaining items need to be retained,
+                // the worst of them kept at the front of the heap
+                bool is_bounded = !m_inner_it && m_limit != std::numeric_limits<std::size_t>::max();
+                auto max_items = m_limit - m_count;
                 while (!it->isEnd()) {  
                     // retrieve current full item from the inner iterator (key + value)
                     m_items.push_back(*rt_inner_it.asNative());
                     it->next();
+                    if (is_bounded) {
+                        if (m_asc) {
+                            std::push_heap(m_items.begin(), m_items.end(), MaxCompT());
+                            if (m_items.size() > max_items) {
+                                std::pop_heap(m_items.begin(), m_items.end(), MaxCompT());
+                                m_items.pop_back();
+                            }
+                        } else {
+                            std::push_heap(m_items.begin(), m_items.end(), MinCompT());
+                            if (m_items.size() > max_items) {
+                                std::pop_heap(m_items.begin(), m_items.end(), MinCompT());
+                                m_items.pop_back();
+                            }
+                        }
+                    }
                 }
                 if (m_asc) {
                     std::make_heap(m_items.begin(), m_items.end(), MinCompT());
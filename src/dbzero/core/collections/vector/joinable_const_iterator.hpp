@@ -310,7 +310,68 @@ namespace db0
 				return !this->m_comp(*m_current, *next) && !this->m_comp(*next, *m_current);
 			}
 		}
-		
+
+		/**
+		 * Get the contiguous range of items remaining to be visited (including the current one)
+		 * i.e. [current, end) for the forward or [begin, current] for the backward iterator
+		 * @return false if not available (invalid or bounded iterator)
+		 */
+		bool getRun(const data_t *&begin, const data_t *&end) const {
+			return getRun(m_direction, begin, end);
+		}
+
+		// Get the run for an explicitly specified direction
+		bool getRun(int direction, const data_t *&begin, const data_t *&end) const
+		{
+			if (!isValid() || m_bound_check.hasBound()) {
+				return false;
+			}
+			if (direction > 0) {
+				begin = m_current;
+				end = this->m_end;
+			} else {
+				begin = this->m_begin;
+				end = m_current + 1;
+			}
+			return true;
+		}
+
+		/**
+		 * Advance by up to count items in the direction of iteration
+		 * @return the number of items actually skipped
+		 */
+		std::size_t skip(std::size_t count)
+		{
+			if (!isValid()) {
+				return 0;
+			}
+			if (m_bound_check.hasBound()) {
+				// bounds need to be validated item by item
+				std::size_t result = 0;
+				while (result < count && isValid()) {
+					if (m_direction > 0) {
+						++(*this);
+					} else {
+						--(*this);
+					}
+					++result;
+				}
+				return result;
+			}
+			// number of items remaining (including the current one)
+			std::size_t remaining = (m_direction > 0) ? (this->m_end - m_current) : (m_current - this->m_begin + 1);
+			if (count >= remaining) {
+				set_end();
+				return remaining;
+			}
+			if (m_direction > 0) {
+				m_current += count;
+			} else {
+				m_current -= count;
+			}
+			return count;
+		}
+
 	private:
 		const data_t *m_current = nullptr;
 		int m_direction = -1;
@@ -8,6 +8,7 @@
 #include <unordered_set>
 #include <cstring>
 #include <optional>
+#include <limits>
 #include "v_bdata_block.hpp"
 #include <dbzero/core/serialization/FixedVersioned.hpp>
 #include <dbzero/core/serialization/Types.hpp>
@@ -212,6 +213,49 @@ DB0_PACKED_END
             (*m_last_block).modify().modifyItem((std::size_t)(index & m_db_mask)) = item;
         }
 
+        /**
+         * Copy a range of items (grow vector if necessary), block by block
+         */
+        void setItems(std::uint64_t index, const ItemT *items, std::uint64_t count)
+        {
+            if (index + count > size()) {
+                auto grow_by = index + count - size();
+                while (grow_by > 0) {
+                    auto diff = std::min<std::uint64_t>(grow_by, std::numeric_limits<unsigned int>::max());
+                    growBy((unsigned int)diff);
+                    grow_by -= diff;
+                }
+            }
+            while (count > 0) {
+                // access within data block element (not thread safe)
+                getDataBlock(getKey(0, index));
+                auto offset = index & m_db_mask;
+                auto diff = std::min<std::uint64_t>(count, ((std::uint64_t)1 << (m_db_shift - this->getBClass())) - offset);
+                std::copy(items, items + diff, &(*m_last_block).modify().modifyItem((std::size_t)offset));
+                items += diff;
+                index += diff;
+                count -= diff;
+            }
+        }
+
+        /**
+         * Fetch the data block holding a specific item, the block remains mapped for as long as it's referenced
+         * @return the block and the number of consecutive items available there (starting from index)
+         */
+        std::pair<std::shared_ptr<const DataBlockType>, std::size_t> fetchBlockOf(std::uint64_t index) const
+        {
+            assert(index < size());
+            auto key = getKey(0, index);
+            std::shared_ptr<const DataBlockType> block = fetchDataBlock(key);
+            auto range = getDataBlockRange(index);
+            return { block, (std::size_t)(std::min(range.second, size()) - index) };
+        }
+
+        // Pointer to an item within the data block retrieved with fetchBlockOf
+        const ItemT *getItemPtr(const DataBlockType &block, std::uint64_t index) const {
+            return &block->getItem((std::size_t)(index & m_db_mask));
+        }
+
         // threadsafe
         ItemT getItem(std::uint64_t index) const 
         {
@@ -1327,6 +1371,8 @@ DB0_PACKED_END
                 // avoid unnecessary initializing end iterator
                 if (!is_end()) {
                     initDataBlock();
+                    // the iterator is likely to be used for a sequential scan
+                    m_collection_ptr->prefetchDataBlocks(m_index);
                 }
             }
             
@@ -1503,6 +1549,9 @@ DB0_PACKED_END
         };
 
     private:
+        // max number of data blocks to be prefetched when the iterator is created
+        static constexpr unsigned int PREFETCH_BLOCKS = 64;
+
         /**
          * Fetch data block containing specific item from backend
          */
@@ -1510,6 +1559,43 @@ DB0_PACKED_END
             return fetchDataBlock(this->getKey(0, index));
         }
 
+        /**
+         * Issue the read-ahead hint for data blocks following the one containing a specific item
+         * NOTE: only blocks referenced by the same block of pointers are considered
+         */
+        void prefetchDataBlocks(std::uint64_t index) const
+        {
+            if (height() < 2) {
+                return;
+            }
+            auto first_block = index >> m_db_shift;
+            auto end_block = std::min<std::uint64_t>(
+                ((size() - 1) >> m_db_shift) + 1, ((first_block >> m_pb_shift) + 1) << m_pb_shift
+            );
+            end_block = std::min<std::uint64_t>(end_block, first_block + 1 + PREFETCH_BLOCKS);
+            if (first_block + 1 >= end_block) {
+                return;
+            }
+            
+            auto &prefix = this->getMemspace().getPrefix();
+            std::size_t page_size = (*this)->m_page_size;
+            progressive_mutex::scoped_read_lock rw_lock(this->m_mutex);
+            const ptr_block &block = getPtrBlock(this->getKey(1, index), rw_lock);
+            // coalesce consecutively allocated blocks into ranges
+            std::uint64_t range_begin = 0, range_end = 0;
+            for (auto block_num = first_block + 1; block_num != end_block; ++block_num) {
+                auto address = block->getItem(block_num & m_pb_mask).getOffset();
+                if (address != range_end) {
+                    if (range_end) {
+                        prefix.prefetch(range_begin, range_end - range_begin);
+                    }
+                    range_begin = address;
+                }
+                range_end = address + page_size;
+            }
+            prefix.prefetch(range_begin, range_end - range_begin);
+        }
+
     public :
 
         const_iterator begin(uint64_t index = 0) const {
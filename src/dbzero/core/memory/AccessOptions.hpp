@@ -38,6 +38,8 @@ namespace db0
     static constexpr std::uint16_t RESOURCE_RECYCLED            = 0x0200;
     // prevent resource from being overwritten (e.g. prevent upgrade to a higher transaction number in PrefixImpl)
     static constexpr std::uint16_t RESOURCE_FREEZE              = 0x0400;
+    // the lock has been accessed since registered / last visited by the CacheRecycler (S3-FIFO policy)
+    static constexpr std::uint16_t RESOURCE_ACCESSED            = 0x0800;
         
     enum class AccessType: unsigned int
     {
@@ -5,6 +5,9 @@
 #include "config.hpp"
 #include <cassert>
 #include <iostream>
+#include <dbzero/core/threading/Flags.hpp>
+#include <dbzero/core/exception/Exceptions.hpp>
+#include <dbzero/core/utils/Tracer.hpp>
 
 namespace db0
 
@@ -27,6 +30,24 @@ namespace db0
         return (capacity > 0) ? ((capacity - 1) / MIN_PAGE_SIZE + 1) : 0;
     }
     
+    // Key identifying the lock's contents in the ghost queue
+    std::uint64_t getGhostKey(const ResourceLock &lock)
+    {
+        auto storage_key = reinterpret_cast<std::uintptr_t>(&lock.getStorage());
+        return (storage_key * 0x9E3779B97F4A7C15ull) ^ lock.getAddress();
+    }
+    
+    CachePolicy parseCachePolicy(const std::string &name)
+    {
+        if (name == "lru") {
+            return CachePolicy::LRU;
+        }
+        if (name != "s3fifo") {
+            THROWF(db0::InputException) << "Unsupported cache policy: " << name;
+        }
+        return CachePolicy::S3_FIFO;
+    }
+    
     CacheRecycler::CacheRecycler(std::size_t capacity, const std::atomic<std::size_t> &dirty_meter,
         std::optional<std::size_t> flush_size,
         std::function<void(std::size_t limit)> flush_dirty,
@@ -34,6 +55,7 @@ namespace db0
         : m_capacity(capacity)
         // NOTE: buffers are overprovisioned
         , m_res_bufs { getMaxSize(m_capacity), getMaxSize(m_capacity) }
+        , m_small_bufs { getMaxSize(m_capacity), getMaxSize(m_capacity) }
         , m_dirty_meter(dirty_meter)
         // assign default flush size
         , m_flush_size(flush_size.value_or(DEFAULT_FLUSH_SIZE))
@@ -42,9 +64,8 @@ namespace db0
     {
     }
 
-    std::size_t CacheRecycler::adjustSize(std::unique_lock<std::mutex> &, list_t &res_buf,
-        std::size_t requested_release_size)
-    {                  
+    void CacheRecycler::flushDirty(std::unique_lock<std::mutex> &, std::size_t requested_release_size)
+    {
         // calculate size to be released from the dirty locks
         // so that they occupy <50% of the cache
         // NOTE: this has to be done before actual size adjustment
@@ -53,11 +74,26 @@ namespace db0
             // request flushing (and releasing) specific volume of dirty locks
             m_flush_dirty(limit);
         }
-        
+    }
+    
+    std::size_t CacheRecycler::adjustSize(std::unique_lock<std::mutex> &lock, list_t &res_buf,
+        std::size_t requested_release_size)
+    {
+        flushDirty(lock, requested_release_size);
         std::size_t released_size = 0;
         // try flushing 'requested_release_size' number of excess elements
+        // NOTE: visit each lock at most once (the accessed ones are moved to the back)
+        auto count = res_buf.size();
         auto it = res_buf.begin(), end = res_buf.end();
-        while (it != end && released_size < requested_release_size) {
+        for (; count > 0 && it != end && released_size < requested_release_size; --count) {
+            if ((*it)->m_resource_flags & db0::RESOURCE_ACCESSED) {
+                // hit recorded without the mutex, the lock becomes the most recently used one
+                atomicResetFlags((*it)->m_resource_flags, db0::RESOURCE_ACCESSED);
+                auto next = std::next(it);
+                res_buf.splice(res_buf.end(), it);
+                it = next;
+                continue;
+            }
             // only release locks with no active external references (other than the CacheRecycler itself)
             // NOTE: dirty locks are relased by m_flush_dirty callback
             if ((*it).use_count() == 1 && !(*it)->isDirty()) {
@@ -71,18 +107,143 @@ namespace db0
         return released_size;
     }
     
+    std::size_t CacheRecycler::adjustSize(std::unique_lock<std::mutex> &lock, int priority, std::size_t release_size)
+    {
+        if (m_policy == CachePolicy::S3_FIFO) {
+            flushDirty(lock, release_size);
+            return evictS3(lock, priority, release_size);
+        }
+        return adjustSize(lock, m_res_bufs[priority], release_size);
+    }
+    
     void CacheRecycler::adjustSize(std::unique_lock<std::mutex> &lock, std::size_t release_size)
     {
+        DB0_TRACE("CacheRecycler::evict", release_size);
         // release from low-priority cache first
-        auto released_size = adjustSize(lock, m_res_bufs[1], release_size);
+        auto released_size = adjustSize(lock, 1, release_size);
         // update current size
         m_current_size[1] -= released_size;
         release_size -= released_size;
         if (release_size > 0) {
-            released_size = adjustSize(lock, m_res_bufs[0], release_size);
+            released_size = adjustSize(lock, 0, release_size);
             m_current_size[0] -= released_size;
         }
     }
+    
+    std::size_t CacheRecycler::getSmallTarget(int priority) const {
+        return db0::getCapacity(m_capacity, priority) * SMALL_QUEUE_PERCENT / 100;
+    }
+    
+    std::size_t CacheRecycler::evictS3(std::unique_lock<std::mutex> &lock, int priority, std::size_t release_size)
+    {
+        // evict from the probationary queue while it exceeds its target size
+        auto released_size = evictSmall(lock, priority, release_size, getSmallTarget(priority));
+        if (released_size < release_size) {
+            released_size += evictMain(lock, priority, release_size - released_size);
+        }
+        // the main queue may consist of in-use / dirty locks only
+        if (released_size < release_size) {
+            released_size += evictSmall(lock, priority, release_size - released_size, 0);
+        }
+        return released_size;
+    }
+    
+    std::size_t CacheRecycler::evictSmall(std::unique_lock<std::mutex> &, int priority, std::size_t release_size,
+        std::size_t min_size)
+    {
+        auto &small_buf = m_small_bufs[priority];
+        std::size_t released_size = 0;
+        auto it = small_buf.begin();
+        while (it != small_buf.end() && released_size < release_size && m_small_size[priority] > min_size) {
+            auto lock_size = (*it)->usedMem();
+            m_small_size[priority] -= lock_size;
+            if (!((*it)->m_resource_flags & db0::RESOURCE_ACCESSED) && (*it).use_count() == 1 && !(*it)->isDirty()) {
+                // never accessed since registered, remember in the ghost queue
+                addGhost(**it);
+                released_size += lock_size;
+                it = small_buf.erase(it);
+            } else {
+                // accessed, in use or dirty - promote to the main queue
+                atomicResetFlags((*it)->m_resource_flags, db0::RESOURCE_ACCESSED);
+                auto res_lock = std::move(*it);
+                it = small_buf.erase(it);
+                pushBack(m_res_bufs[priority], std::move(res_lock), false);
+            }
+        }
+        return released_size;
+    }
+    
+    std::size_t CacheRecycler::evictMain(std::unique_lock<std::mutex> &, int priority, std::size_t release_size)
+    {
+        auto &res_buf = m_res_bufs[priority];
+        std::size_t released_size = 0;
+        // visit each lock at most once (reinserted locks are moved to the back)
+        auto count = res_buf.size();
+        auto it = res_buf.begin();
+        for (; count > 0 && released_size < release_size; --count) {
+            auto next = std::next(it);
+            if ((*it)->m_resource_flags & db0::RESOURCE_ACCESSED) {
+                // give the lock another round
+                atomicResetFlags((*it)->m_resource_flags, db0::RESOURCE_ACCESSED);
+                res_buf.splice(res_buf.end(), it);
+            } else if ((*it).use_count() == 1 && !(*it)->isDirty()) {
+                released_size += (*it)->usedMem();
+                res_buf.erase(it);
+            }
+            it = next;
+        }
+        return released_size;
+    }
+    
+    void CacheRecycler::pushBack(list_t &res_buf, std::shared_ptr<ResourceLock> res_lock, bool probation)
+    {
+        // resize is a costly operation but cannot be avoided if the number of locked
+        // resources exceeds the assumed limit
+        // note that this operation does not change the configured cache capacity
+        if (res_buf.size() == res_buf.max_size()) {
+            // After resize, all iterators to cached elements will be invalidated!!
+            res_buf.resize(std::max<std::size_t>(res_buf.size() * 2, 1));
+            // Update self-iterators in all cached locks
+            for (auto it = res_buf.begin(), end = res_buf.end(); it != end; ++it) {
+                (*it)->m_recycle_it = it;
+            }
+        }
+        res_lock->m_probation = probation;
+        res_buf.push_back(res_lock);
+        res_lock->m_recycle_it = std::prev(res_buf.end());
+    }
+    
+    void CacheRecycler::insertS3(std::unique_lock<std::mutex> &, std::shared_ptr<ResourceLock> res_lock, int priority)
+    {
+        // locks recently evicted from the probationary queue are admitted directly to the main queue
+        if (isGhost(*res_lock)) {
+            pushBack(m_res_bufs[priority], res_lock, false);
+        } else {
+            m_small_size[priority] += res_lock->usedMem();
+            pushBack(m_small_bufs[priority], res_lock, true);
+        }
+    }
+    
+    void CacheRecycler::addGhost(const ResourceLock &res_lock)
+    {
+        auto key = getGhostKey(res_lock);
+        m_ghost_fifo.push_back(key);
+        ++m_ghost_keys[key];
+        // the ghost queue tracks as many keys as there are locks cached
+        auto max_size = std::max<std::size_t>(m_res_bufs[0].size() + m_res_bufs[1].size() +
+            m_small_bufs[0].size() + m_small_bufs[1].size(), 1);
+        while (m_ghost_fifo.size() > max_size) {
+            auto it = m_ghost_keys.find(m_ghost_fifo.front());
+            if (--(it->second) == 0) {
+                m_ghost_keys.erase(it);
+            }
+            m_ghost_fifo.pop_front();
+        }
+    }
+    
+    bool CacheRecycler::isGhost(const ResourceLock &res_lock) const {
+        return m_ghost_keys.find(getGhostKey(res_lock)) != m_ghost_keys.end();
+    }
 
     void CacheRecycler::updateSize(std::unique_lock<std::mutex> &lock, int priority, std::size_t expected_size)
     {
@@ -95,7 +256,7 @@ namespace db0
             }
 
             // release excess locks plus flush size
-            auto released_size = adjustSize(lock, m_res_bufs[priority], m_current_size[priority] - expected_size);
+            auto released_size = adjustSize(lock, priority, m_current_size[priority] - expected_size);
             m_current_size[priority] -= released_size;
         }
     }
@@ -108,20 +269,58 @@ namespace db0
         }
     }
     
+    void CacheRecycler::setPolicy(CachePolicy policy)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (policy == m_policy) {
+            return;
+        }
+        if (policy == CachePolicy::LRU) {
+            // move locks from the probationary queues (as the least recently used ones)
+            for (int priority = 0; priority < 2; ++priority) {
+                auto &small_buf = m_small_bufs[priority];
+                auto &res_buf = m_res_bufs[priority];
+                while (!small_buf.empty()) {
+                    auto res_lock = std::move(small_buf.back());
+                    small_buf.pop_back();
+                    pushBack(res_buf, res_lock, false);
+                    res_buf.splice(res_buf.begin(), res_lock->m_recycle_it);
+                }
+                m_small_size[priority] = 0;
+            }
+            m_ghost_fifo.clear();
+            m_ghost_keys.clear();
+        }
+        // NOTE: when switching to S3-FIFO the existing locks are retained in the main queues
+        m_policy = policy;
+    }
+    
     void CacheRecycler::update(std::shared_ptr<ResourceLock> res_lock)
     {        
         bool flushed = false, flush_result = false;
 		if (res_lock) {
+            // record the hit only, the mutex is not required
+            // (LRU: the lock is moved to the back of the queue lazily, on eviction)
+            // NOTE: flush-callback pending for repeat requires the slow path
+            if (res_lock->isRecycled() && m_last_flush_callback_result) {
+                if (!(res_lock->m_resource_flags & db0::RESOURCE_ACCESSED)) {
+                    atomicSetFlags(res_lock->m_resource_flags, db0::RESOURCE_ACCESSED);
+                }
+                return;
+            }
 			// access existing resource
 			std::unique_lock<std::mutex> lock(m_mutex);
             int priority = res_lock->isCached() ? 0 : 1;
 			if (res_lock->isRecycled()) {
-				// resource already in cache, just bring to back (lowest priority for removal)
-                m_res_bufs[priority].splice(m_res_bufs[priority].end(), res_lock->m_recycle_it);
+                if (m_policy == CachePolicy::S3_FIFO) {
+                    atomicSetFlags(res_lock->m_resource_flags, db0::RESOURCE_ACCESSED);
+                } else {
+				    // resource already in cache, just bring to back (lowest priority for removal)
+                    m_res_bufs[priority].splice(m_res_bufs[priority].end(), res_lock->m_recycle_it);
+                }
 			} else {
                 // add new resource (if to be cached)
                 auto lock_size = res_lock->usedMem();
-                auto &res_buf = m_res_bufs[priority];                
                 if (lock_size > m_capacity) {
                     // Cache size is too small to keep this resource
                     // (or is uninitialized)
@@ -133,26 +332,17 @@ namespace db0
                     flushed = flush_returned_values.first;
                     flush_result = flush_returned_values.second;
                 }
-                // resize is a costly operation but cannot be avoided if the number of locked
-                // resources exceeds the assumed limit
-                // note that this operation does not change the configured cache capacity
-                if (res_buf.size() == res_buf.max_size()) {
-                    // After resize, all iterators to cached elements will be invalidated!!
-                    res_buf.resize(res_buf.size() * 2);
-                    // Update self-iterators in all cached locks
-                    for (auto it = res_buf.begin(), end = res_buf.end(); it != end; ++it) {
-                        (*it)->m_recycle_it = it;
-                    }
+                if (m_policy == CachePolicy::S3_FIFO) {
+                    insertS3(lock, res_lock, priority);
+                } else {
+                    pushBack(m_res_bufs[priority], res_lock, false);
                 }
-                res_buf.push_back(res_lock);
-                res_lock->m_recycle_it = std::prev(res_buf.end());
                 res_lock->setRecycled(true);
 			}
 		}
         // NOTE: flush-callback will be repeated if unable to handle the previous time
-        if (m_flush_callback && (flushed || !m_last_flush_callback_result.first)) {
-            m_last_flush_callback_result.second = flush_result;
-            m_last_flush_callback_result.first = m_flush_callback(flush_result);
+        if (m_flush_callback && (flushed || !m_last_flush_callback_result)) {
+            m_last_flush_callback_result = m_flush_callback(flush_result);
         }
 	}
     
@@ -193,16 +383,17 @@ namespace db0
         
         // try releasing excess locks
         updateSize(_lock, priority, new_size);
-        auto &res_buf = m_res_bufs[priority];
-        // new capacity of the fixed list should allow storing existing locks
-        auto new_max_size = std::max((m_capacity - 1) / MIN_PAGE_SIZE + 1, res_buf.size());
-        if (new_max_size > res_buf.max_size()) {
-            // After resize, all iterators to cached elements will be invalidated!!
-            res_buf.resize(new_max_size);
-            
-            // Update self-iterators in all cached locks
-            for (auto it = res_buf.begin(), end = res_buf.end(); it != end; ++it) {
-                (*it)->m_recycle_it = it;
+        for (auto res_buf: { &m_res_bufs[priority], &m_small_bufs[priority] }) {
+            // new capacity of the fixed list should allow storing existing locks
+            auto new_max_size = std::max((m_capacity - 1) / MIN_PAGE_SIZE + 1, res_buf->size());
+            if (new_max_size > res_buf->max_size()) {
+                // After resize, all iterators to cached elements will be invalidated!!
+                res_buf->resize(new_max_size);
+                
+                // Update self-iterators in all cached locks
+                for (auto it = res_buf->begin(), end = res_buf->end(); it != end; ++it) {
+                    (*it)->m_recycle_it = it;
+                }
             }
         }
     }
@@ -213,7 +404,12 @@ namespace db0
             res.setRecycled(false);
             int priority = res.isCached() ? 0 : 1;
             m_current_size[priority] -= res.size();
-            m_res_bufs[priority].erase(res.m_recycle_it);
+            if (res.m_probation) {
+                m_small_size[priority] -= res.usedMem();
+                m_small_bufs[priority].erase(res.m_recycle_it);
+            } else {
+                m_res_bufs[priority].erase(res.m_recycle_it);
+            }
         }
     }
     
@@ -232,6 +428,11 @@ namespace db0
         for (const auto &p: m_res_bufs[1]) {
             f(p);
         }
+        for (const auto &small_buf: m_small_bufs) {
+            for (const auto &p: small_buf) {
+                f(p);
+            }
+        }
     }
     
     std::size_t CacheRecycler::getCapacity() const
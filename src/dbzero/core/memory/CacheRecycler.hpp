@@ -11,6 +11,8 @@
 #include <optional>
 #include <atomic>
 #include <chrono>
+#include <string>
+#include <unordered_map>
 #include <dbzero/core/memory/ResourceLock.hpp>
 #include <dbzero/core/utils/FixedList.hpp>
 
@@ -18,6 +20,19 @@ namespace db0
 
 {
 
+	enum class CachePolicy: std::uint8_t
+	{
+		// single LRU queue per priority class
+		// cache hits are recorded without taking the mutex (the lock is moved to the back on eviction)
+		LRU = 1,
+		// probationary (small) FIFO + main FIFO with reinsertion and a ghost queue (per priority class)
+		// resistant to large sequential scans, cache hits are recorded without taking the mutex
+		S3_FIFO = 2
+	};
+
+	// Parse the policy name ("lru" or "s3fifo"), throws InputException on unknown name
+	CachePolicy parseCachePolicy(const std::string &);
+
 	class CacheRecycler
     {
 	public:
@@ -58,6 +73,15 @@ namespace db0
 
 		void setFlushSize(unsigned int);
 
+		/**
+		 * Change the replacement policy at runtime, the cached locks are retained
+		 */
+		void setPolicy(CachePolicy);
+
+		CachePolicy getPolicy() const {
+			return m_policy;
+		}
+
         /**
          * Acquire lock of the entire instance
         */
@@ -81,6 +105,9 @@ namespace db0
 		void forEach(std::function<void(std::shared_ptr<ResourceLock>)>) const;
 		
 	private:
+		// S3-FIFO: the target size of the probationary queue (as % of the priority class capacity)
+		static constexpr std::size_t SMALL_QUEUE_PERCENT = 10;
+
         using list_t = db0::FixedList<std::shared_ptr<ResourceLock> >;
         using iterator = list_t::iterator;
 		
@@ -89,13 +116,22 @@ namespace db0
 		// buffers for priority cache (#0) and secondary cache (#1)
 		std::array<list_t, 2> m_res_bufs;
 		std::array<std::size_t, 2> m_current_size = {0, 0};
+		std::atomic<CachePolicy> m_policy = CachePolicy::LRU;
+		// S3-FIFO probationary queues (m_res_bufs act as the main queues)
+		// NOTE: m_current_size accounts for both queues
+		std::array<list_t, 2> m_small_bufs;
+		std::array<std::size_t, 2> m_small_size = {0, 0};
+		// S3-FIFO ghost queue: keys of locks recently evicted from the probationary queues
+		std::deque<std::uint64_t> m_ghost_fifo;
+		std::unordered_map<std::uint64_t, unsigned int> m_ghost_keys;
 		const std::atomic<std::size_t> &m_dirty_meter;
 		// number of locks to be flushed at once
 		std::size_t m_flush_size;
 		mutable std::mutex m_mutex;
 		std::function<void(std::size_t limit)> m_flush_dirty;
 		std::function<bool(bool)> m_flush_callback;
-		std::pair<bool, bool> m_last_flush_callback_result = {true, false};
+		// NOTE: read by the lock-free hit path
+		std::atomic<bool> m_last_flush_callback_result = true;
 		
 		// Flush rate limiting
 		std::chrono::high_resolution_clock::time_point m_next_flush_time{};
@@ -110,6 +146,21 @@ namespace db0
          */
         std::size_t adjustSize(std::unique_lock<std::mutex> &, list_t &res_buf, std::size_t release_size);
 		void adjustSize(std::unique_lock<std::mutex> &, std::size_t release_size);
+		// release from a specific priority class according to the current policy
+		std::size_t adjustSize(std::unique_lock<std::mutex> &, int priority, std::size_t release_size);
+		// request flushing dirty locks so that they occupy <50% of the cache
+		void flushDirty(std::unique_lock<std::mutex> &, std::size_t release_size);
+		
+		// S3-FIFO eviction from a specific priority class
+		std::size_t evictS3(std::unique_lock<std::mutex> &, int priority, std::size_t release_size);
+		// @param min_size stop when the probationary queue size is reduced to min_size
+		std::size_t evictSmall(std::unique_lock<std::mutex> &, int priority, std::size_t release_size, std::size_t min_size);
+		std::size_t evictMain(std::unique_lock<std::mutex> &, int priority, std::size_t release_size);
+		void pushBack(list_t &, std::shared_ptr<ResourceLock>, bool probation);
+		void insertS3(std::unique_lock<std::mutex> &, std::shared_ptr<ResourceLock>, int priority);
+		void addGhost(const ResourceLock &);
+		bool isGhost(const ResourceLock &) const;
+		std::size_t getSmallTarget(int priority) const;
 		void updateSize(std::unique_lock<std::mutex> &, int priority, std::size_t expected_size);
 		// update overall size
 		void updateSize(std::unique_lock<std::mutex> &, std::size_t expected_size);
@@ -52,8 +52,45 @@ namespace db0
         assert(m_state_num > 0);
     }
     
+    DP_Lock::DP_Lock(StorageContext context, std::uint64_t address, std::vector<std::byte> &&data,
+        FlagSet<AccessOptions> access_mode, StateNumType read_state_num)
+        : ResourceLock(context, address, data.size(), access_mode)
+        , m_state_num(read_state_num)
+    {
+        assert(addrPageAligned(m_context.m_storage_ref.get()));
+        assert(read_state_num > 0);
+        m_data.swap(data);
+        if (!access_mode[AccessOptions::no_cow] && !access_mode[AccessOptions::create]) {
+            m_cow_data.resize(m_data.size());
+            std::memcpy(m_cow_data.data(), m_data.data(), m_data.size());
+        }
+    }
+    
+    DP_Lock::DP_Lock(StorageContext context, std::uint64_t address, std::size_t size,
+        std::shared_ptr<const std::byte> shared_data, FlagSet<AccessOptions> access_mode, StateNumType read_state_num)
+        : ResourceLock(context, address, size, access_mode, shared_data)
+        , m_state_num(read_state_num)
+    {
+        assert(addrPageAligned(m_context.m_storage_ref.get()));
+        assert(read_state_num > 0);
+    }
+    
+    void DP_Lock::prepareFlush(FlushMethod flush_method)
+    {
+        if (flush_method != FlushMethod::diff || m_access_mode[AccessOptions::no_flush] || !isDirty()) {
+            return;
+        }
+        auto cow_ptr = getCowPtr();
+        if (cow_ptr) {
+            m_prepared = this->getDiffs(cow_ptr, m_prepared_diffs) ? PreparedFlush::diffs : PreparedFlush::full;
+        }
+    }
+    
     bool DP_Lock::_tryFlush(FlushMethod flush_method)
     {
+        // the pre-computed diffs are only valid for this call
+        auto prepared = m_prepared;
+        m_prepared = PreparedFlush::none;
         // no-flush flag is important for volatile locks (atomic operations)
         if (m_access_mode[AccessOptions::no_flush]) {
             return true;
@@ -76,7 +113,10 @@ namespace db0
                     }
 
                     std::vector<std::uint16_t> diffs;
-                    if (!this->getDiffs(cow_ptr, diffs)) {
+                    if (prepared != PreparedFlush::none) {
+                        diffs.swap(m_prepared_diffs);
+                    }
+                    if (prepared == PreparedFlush::full || (prepared == PreparedFlush::none && !this->getDiffs(cow_ptr, diffs))) {
                         // unable to diff-flush (too many diffs)
                         return false;
                     }
@@ -121,6 +161,8 @@ namespace db0
     {
         assert(state_num > m_state_num);
         assert(!isDirty());
+        // the lock is about to be modified
+        unshare();
         if (is_volatile) {
             // NOTE: in case of volatile locks, CoW data will be reused
             m_access_mode.set(AccessOptions::no_flush);
@@ -41,8 +41,25 @@ namespace db0
         */
         DP_Lock(std::shared_ptr<DP_Lock>, StateNumType write_state_num, FlagSet<AccessOptions>);
         
+        /**
+         * Create a read lock from page contents already fetched from storage (e.g. by the read-ahead)
+         * @param data the page contents, taken over by the lock
+        */
+        DP_Lock(StorageContext, std::uint64_t address, std::vector<std::byte> &&data, FlagSet<AccessOptions>,
+            StateNumType read_state_num);
+
+        /**
+         * Create a read lock over page contents held in an external read-only buffer (e.g. the shared page cache)
+         * @param shared_data the page contents (of a given size), kept alive for the lock's lifetime
+        */
+        DP_Lock(StorageContext, std::uint64_t address, std::size_t size, std::shared_ptr<const std::byte> shared_data,
+            FlagSet<AccessOptions>, StateNumType read_state_num);
+        
         bool tryFlush(FlushMethod) override;
         
+        // Pre-compute diffs for the FlushMethod::diff
+        void prepareFlush(FlushMethod) override;
+        
         /**
          * Flush data from local buffer and clear the 'dirty' flag
          * data is not flushed if not dirty.
@@ -73,6 +90,17 @@ namespace db0
         // the actual state number under which this lock is registered
         StateNumType m_state_num;
         
+        enum class PreparedFlush: std::uint8_t
+        {
+            none = 0,
+            diffs = 1,
+            // diff method not applicable
+            full = 2
+        };
+        // diffs computed by prepareFlush (consumed by the following tryFlush)
+        PreparedFlush m_prepared = PreparedFlush::none;
+        std::vector<std::uint16_t> m_prepared_diffs;
+        
         struct tag_derived {};
         DP_Lock(tag_derived, StorageContext, std::uint64_t address, std::size_t size, FlagSet<AccessOptions> access_mode,
             StateNumType read_state_num, StateNumType write_state_num, std::shared_ptr<ResourceLock> cow_lock);
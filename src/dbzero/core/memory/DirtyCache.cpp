@@ -3,6 +3,7 @@
 
 #include "DirtyCache.hpp"
 #include <dbzero/core/memory/utils.hpp>
+#include <dbzero/core/threading/WorkerPool.hpp>
 
 namespace db0
 
@@ -35,6 +36,17 @@ namespace db0
     {
         std::size_t flushed = 0;
         std::unique_lock<std::mutex> lock(m_mutex);
+        // compute in parallel, then write in order so that the storage layout is deterministic
+        if (m_locks.size() > PREPARE_FLUSH_BATCH) {
+            auto task_count = (m_locks.size() - 1) / PREPARE_FLUSH_BATCH + 1;
+            WorkerPool::getCPUPool().run(task_count, [&](std::size_t index) {
+                auto it = m_locks.begin() + index * PREPARE_FLUSH_BATCH;
+                auto end = (index + 1 == task_count) ? m_locks.end() : it + PREPARE_FLUSH_BATCH;
+                for (; it != end; ++it) {
+                    (*it)->prepareFlush(flush_method);
+                }
+            });
+        }
         auto it = m_locks.begin();
         while (it != m_locks.end()) {
             if ((*it)->tryFlush(flush_method)) {
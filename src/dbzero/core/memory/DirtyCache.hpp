@@ -27,6 +27,8 @@ namespace db0
         // register resource with the dirty locks
         void append(std::shared_ptr<ResourceLock>);
         // only flush locks which support a specific flush method
+        // NOTE: the flush is split into the parallel stage (e.g. diffs computation) and
+        // the serial stage of writing to storage (in the same order as the locks were registered)
         void tryFlush(FlushMethod);
         void flush();
         
@@ -50,6 +52,8 @@ namespace db0
         std::atomic<std::size_t> *m_dirty_meter_ptr = nullptr;
         mutable std::mutex m_mutex;
         std::deque<std::shared_ptr<ResourceLock> > m_locks;
+        // the number of locks in a single parallel task of prepareFlush
+        static constexpr std::size_t PREPARE_FLUSH_BATCH = 64;
         const std::size_t m_page_size;
         const unsigned int m_shift;
         // total bytes supported by this cache
@@ -4,7 +4,8 @@
 #pragma once
 
 #include <memory>
-#include <map>
+#include <array>
+#include <vector>
 #include <cstdint>
 #include <functional>
 #include <shared_mutex>
@@ -14,6 +15,7 @@
 #include <dbzero/core/memory/BoundaryLock.hpp>
 #include <dbzero/core/memory/AccessOptions.hpp>
 #include <dbzero/core/memory/utils.hpp>
+#include "PageTable.hpp"
 
 namespace db0
 
@@ -39,6 +41,7 @@ namespace db0
         bool exists(StateNumType state_num, std::uint64_t page_num) const;
 
         // NOTE: may return expired lock
+        // NOTE: the returned reference remains valid until the lock is erased from the map
         // @return nullptr if lock not found
         std::weak_ptr<ResourceLockT> *find(StateNumType state_num, std::uint64_t page_num,
             StateNumType &read_state_num) const;
@@ -70,9 +73,6 @@ namespace db0
         // we need to only perform them from a well researched contexts
         friend class PrefixCache;
         
-        void insert(std::unique_lock<std::shared_mutex> &, StateNumType state_num, 
-            std::shared_ptr<ResourceLockT>);
-        
         // Erase lock stored under a known state number
         void erase(StateNumType state_num, std::shared_ptr<ResourceLockT> lock);
         void erase(StateNumType state_num, std::uint64_t page_num);
@@ -84,19 +84,28 @@ namespace db0
 
     private:
         const unsigned int m_shift;
-        mutable std::shared_mutex m_rw_mutex;
+        
+        // page-wise cache, note that a single DP_Lock may be associated with multiple pages
+        // the pages are distributed over independently locked stripes (by page number hash)
+        struct Stripe
+        {
+            mutable std::shared_mutex m_rw_mutex;
+            PageVersionsTable m_pages;
+            WeakRefPool<ResourceLockT> m_refs;
+            // total number of versions
+            std::size_t m_size = 0;
 
-        struct CompT {
-            inline bool operator()(const PageKeyT &k1, const PageKeyT &k2) const {
-                return k1.first < k2.first || (k1.first == k2.first && k1.second < k2.second);
-            }
+            void set(std::uint64_t page_num, StateNumType state_num, std::shared_ptr<ResourceLockT>);
+            void erase(std::uint64_t page_num, PageVersions &, const PageVersions::Version *);
+            void clear();
         };
+        
+        static constexpr std::size_t STRIPE_COUNT = std::size_t(1) << PageVersionsTable::STRIPE_BITS;
+        mutable std::array<Stripe, STRIPE_COUNT> m_stripes;
 
-        // page-wise cache, note that a single DP_Lock may be associated with multiple pages
-        mutable std::map<PageKeyT, std::weak_ptr<ResourceLockT>, CompT> m_cache;        
-        using CacheIterator = typename decltype(m_cache)::iterator;
-
-        CacheIterator findImpl(std::uint64_t page_num, StateNumType state_num) const;
+        inline Stripe &getStripe(std::uint64_t page_num) const {
+            return m_stripes[PageVersionsTable::stripeOf(page_num)];
+        }
     };
     
     template <typename ResourceLockT>
@@ -106,158 +115,188 @@ namespace db0
     }
     
     template <typename ResourceLockT>
-    void PageMap<ResourceLockT>::insert(StateNumType state_num, std::shared_ptr<ResourceLockT> res_lock)
+    void PageMap<ResourceLockT>::Stripe::set(std::uint64_t page_num, StateNumType state_num,
+        std::shared_ptr<ResourceLockT> res_lock)
     {
-        std::unique_lock<std::shared_mutex> _lock(m_rw_mutex);
-        m_cache[{res_lock->getAddress() >> m_shift, state_num}] = res_lock;
+        auto &versions = m_pages.findOrCreate(page_num);
+        if (auto it = versions.findExact(state_num)) {
+            m_refs[it->m_ref] = res_lock;
+            return;
+        }
+        auto ref = m_refs.alloc();
+        m_refs[ref] = res_lock;
+        versions.insert({ state_num, ref });
+        ++m_size;
     }
     
     template <typename ResourceLockT>
-    void PageMap<ResourceLockT>::insert(std::unique_lock<std::shared_mutex> &, StateNumType state_num, 
-        std::shared_ptr<ResourceLockT> res_lock)
+    void PageMap<ResourceLockT>::Stripe::erase(std::uint64_t page_num, PageVersions &versions,
+        const PageVersions::Version *it)
     {
-        m_cache[{res_lock->getAddress() >> m_shift, state_num}] = res_lock;
+        m_refs.free(it->m_ref);
+        versions.erase(it);
+        --m_size;
+        if (versions.empty()) {
+            m_pages.erase(page_num);
+        }
     }
-
+    
+    template <typename ResourceLockT>
+    void PageMap<ResourceLockT>::Stripe::clear()
+    {
+        m_pages.clear();
+        m_refs.clear();
+        m_size = 0;
+    }
+    
+    template <typename ResourceLockT>
+    void PageMap<ResourceLockT>::insert(StateNumType state_num, std::shared_ptr<ResourceLockT> res_lock) {
+        insert(state_num, res_lock, res_lock->getAddress() >> m_shift);
+    }
+    
     template <typename ResourceLockT>
     void PageMap<ResourceLockT>::insert(StateNumType state_num, std::shared_ptr<ResourceLockT> res_lock,
         std::uint64_t page_num)
     {
-        std::unique_lock<std::shared_mutex> _lock(m_rw_mutex);
-        m_cache[{page_num, state_num}] = res_lock;
+        auto &stripe = getStripe(page_num);
+        std::unique_lock<std::shared_mutex> _lock(stripe.m_rw_mutex);
+        stripe.set(page_num, state_num, res_lock);
     }
 
     template <typename ResourceLockT>
     void PageMap<ResourceLockT>::forEach(std::function<void(const ResourceLockT &)> f) const 
     {
-        std::shared_lock<std::shared_mutex> _lock(m_rw_mutex);
-        for (const auto &p: m_cache) {
-            auto lock = p.second.lock();
-            if (lock) {
-                f(*lock);
-            }
+        for (auto &stripe: m_stripes) {
+            std::shared_lock<std::shared_mutex> _lock(stripe.m_rw_mutex);
+            stripe.m_pages.forEach([&](std::uint64_t, const PageVersions &versions) {
+                for (auto &version: versions) {
+                    auto lock = stripe.m_refs[version.m_ref].lock();
+                    if (lock) {
+                        f(*lock);
+                    }
+                }
+            });
         }
     }
     
     template <typename ResourceLockT>
     void PageMap<ResourceLockT>::forEach(std::function<void(ResourceLockT &)> f) 
     {
-        std::shared_lock<std::shared_mutex> _lock(m_rw_mutex);
-        for (const auto &p: m_cache) {
-            auto lock = p.second.lock();
-            if (lock) {
-                f(*lock);
-            }
+        for (auto &stripe: m_stripes) {
+            std::shared_lock<std::shared_mutex> _lock(stripe.m_rw_mutex);
+            stripe.m_pages.forEach([&](std::uint64_t, const PageVersions &versions) {
+                for (auto &version: versions) {
+                    auto lock = stripe.m_refs[version.m_ref].lock();
+                    if (lock) {
+                        f(*lock);
+                    }
+                }
+            });
         }
     }
     
     template <typename ResourceLockT>
     bool PageMap<ResourceLockT>::exists(StateNumType state_num, std::uint64_t page_num) const
     {
-        std::shared_lock<std::shared_mutex> _lock(m_rw_mutex);
-        return findImpl(page_num, state_num) != m_cache.end();
+        auto &stripe = getStripe(page_num);
+        std::shared_lock<std::shared_mutex> _lock(stripe.m_rw_mutex);
+        auto versions = stripe.m_pages.find(page_num);
+        return versions && versions->findLE(state_num);
     }
     
     template <typename ResourceLockT>
     std::weak_ptr<ResourceLockT> *PageMap<ResourceLockT>::find(StateNumType state_num, std::uint64_t page_num,
         StateNumType &read_state_num) const
     {        
-        std::shared_lock<std::shared_mutex> lock(m_rw_mutex);
-        auto it = findImpl(page_num, state_num);
-        if (it == m_cache.end()) {
+        auto &stripe = getStripe(page_num);
+        std::shared_lock<std::shared_mutex> lock(stripe.m_rw_mutex);
+        auto versions = stripe.m_pages.find(page_num);
+        if (!versions) {
             return nullptr;
         }
-        read_state_num = it->first.second;
-        return &it->second;
-    }
-    
-    template <typename ResourceLockT>
-    typename PageMap<ResourceLockT>::CacheIterator PageMap<ResourceLockT>::findImpl(
-        std::uint64_t page_num, StateNumType state_num) const
-    {
-        if (m_cache.empty()) {
-            return m_cache.end();
-        }
-        
-        // Find the first element with key >= {page_num, state_num}
-        auto it = m_cache.lower_bound({page_num, state_num});
-        
-        // If we found exact match or an element with same page_num and state <= state_num
-        if (it != m_cache.end() && it->first.first == page_num && it->first.second <= state_num) {
-            return it;
-        }
-        
-        // Look backwards for the largest state <= state_num with same page_num
-        if (it == m_cache.begin()) {
-            return m_cache.end(); // No valid element found
-        }
-        
-        --it; // Safe because we checked it != m_cache.begin()
-        
-        // Check if this element matches our criteria
-        if (it->first.first == page_num && it->first.second <= state_num) {
-            return it;
+        // find the largest state <= state_num
+        auto it = versions->findLE(state_num);
+        if (!it) {
+            return nullptr;
         }
-        
-        return m_cache.end();
+        read_state_num = it->m_state_num;
+        return &stripe.m_refs[it->m_ref];
     }
     
     template <typename ResourceLockT>
     void PageMap<ResourceLockT>::erase(StateNumType state_num, std::shared_ptr<ResourceLockT> res_lock)
     {
-        std::unique_lock<std::shared_mutex> lock(m_rw_mutex);
         auto page_num = res_lock->getAddress() >> m_shift;
-        auto it = findImpl(page_num, state_num);
-        assert(it != m_cache.end());
-        if (it == m_cache.end()) {
+        auto &stripe = getStripe(page_num);
+        std::unique_lock<std::shared_mutex> lock(stripe.m_rw_mutex);
+        auto versions = stripe.m_pages.find(page_num);
+        auto it = versions ? versions->findLE(state_num) : nullptr;
+        assert(it);
+        if (!it) {
             THROWF(db0::InternalException) << "Attempt to erase non-existing lock from PageMap";
         }
-        assert(it->second.lock() == res_lock);
-        m_cache.erase(it);
+        assert(stripe.m_refs[it->m_ref].lock() == res_lock);
+        stripe.erase(page_num, *versions, it);
     }
     
     template <typename ResourceLockT> void PageMap<ResourceLockT>::clear() 
     {
-        std::unique_lock<std::shared_mutex> lock(m_rw_mutex);
-        m_cache.clear();
+        for (auto &stripe: m_stripes) {
+            std::unique_lock<std::shared_mutex> lock(stripe.m_rw_mutex);
+            stripe.clear();
+        }
     }
     
-    template <typename ResourceLockT> bool PageMap<ResourceLockT>::empty() const
-    {
-        std::shared_lock<std::shared_mutex> lock(m_rw_mutex);
-        return m_cache.empty();
+    template <typename ResourceLockT> bool PageMap<ResourceLockT>::empty() const {
+        return size() == 0;
     }
     
     template <typename ResourceLockT>
     void PageMap<ResourceLockT>::erase(StateNumType state_num, std::uint64_t page_num)
     {
-        std::unique_lock<std::shared_mutex> lock(m_rw_mutex);
-#ifndef NDEBUG        
-        auto result = m_cache.erase({page_num, state_num});
-        assert(result);
-#else
-        m_cache.erase({page_num, state_num});
-#endif                
+        auto &stripe = getStripe(page_num);
+        std::unique_lock<std::shared_mutex> lock(stripe.m_rw_mutex);
+        auto versions = stripe.m_pages.find(page_num);
+        auto it = versions ? versions->findExact(state_num) : nullptr;
+        assert(it);
+        if (it) {
+            stripe.erase(page_num, *versions, it);
+        }
     }
     
     template <typename ResourceLockT>
     std::shared_ptr<ResourceLockT> PageMap<ResourceLockT>::replace(
         StateNumType state_num, std::shared_ptr<ResourceLockT> res_lock, std::uint64_t page_num)
     {
-        std::unique_lock<std::shared_mutex> _lock(m_rw_mutex);
+        // NOTE: the lock is registered under its own address (which may differ from page_num)
+        auto lock_page_num = res_lock->getAddress() >> m_shift;
+        auto &stripe = getStripe(page_num);
+        std::unique_lock<std::shared_mutex> _lock(stripe.m_rw_mutex);
         // find exact match of the page / state
-        auto it = m_cache.find({page_num, state_num});
-        if (it == m_cache.end()) {
-            insert(_lock, state_num, res_lock);
-            return {};
+        auto versions = stripe.m_pages.find(page_num);
+        auto it = versions ? versions->findExact(state_num) : nullptr;
+        std::shared_ptr<ResourceLockT> existing_lock;
+        if (it) {
+            existing_lock = stripe.m_refs[it->m_ref].lock();
+            if (!existing_lock) {
+                // remove expired weak_ptr
+                // this is fine because we're inserting under updated more recent state
+                stripe.erase(page_num, *versions, it);
+            }
         }
-        auto existing_lock = it->second.lock();
         if (!existing_lock) {
-            // remove expired weak_ptr
-            // this is fine because we're inserting under updated more recent state
-            assert(state_num >= it->first.second);
-            m_cache.erase(it);
-            insert(_lock, state_num, res_lock);
+            if (lock_page_num == page_num) {
+                stripe.set(page_num, state_num, res_lock);
+            } else {
+                auto &lock_stripe = getStripe(lock_page_num);
+                if (&lock_stripe == &stripe) {
+                    stripe.set(lock_page_num, state_num, res_lock);
+                } else {
+                    _lock.unlock();
+                    std::unique_lock<std::shared_mutex> lock(lock_stripe.m_rw_mutex);
+                    lock_stripe.set(lock_page_num, state_num, res_lock);
+                }
+            }
             return {};
         }
         
@@ -270,59 +309,66 @@ namespace db0
     template <typename ResourceLockT>
     std::size_t PageMap<ResourceLockT>::size() const 
     {
-        std::shared_lock<std::shared_mutex> lock(m_rw_mutex);
-        return m_cache.size();
+        std::size_t result = 0;
+        for (auto &stripe: m_stripes) {
+            std::shared_lock<std::shared_mutex> lock(stripe.m_rw_mutex);
+            result += stripe.m_size;
+        }
+        return result;
     }
     
     template <typename ResourceLockT>
     std::size_t PageMap<ResourceLockT>::clearExpired(StateNumType head_state_num)
     {
         std::size_t count = 0;
-        std::unique_lock<std::shared_mutex> lock(m_rw_mutex);
-        if (m_cache.empty()) {
-            return 0;
-        }
-                
-        auto it = m_cache.begin();
-        while (it != m_cache.end()) {
-            auto page_num = it->first.first;
-            // remove expired locks of a specific page until reaching the head_state_num
-            for (;;) {
-                assert(it != m_cache.end());
-                assert(it->first.first == page_num);
-                if (!it->second.expired() || it->first.second > head_state_num) {
-                    break;
-                }
-                assert(it->first.second <= head_state_num);
-                assert(it->second.expired());
-                it = m_cache.erase(it);
-                ++count;
-
+        std::vector<std::uint64_t> empty_pages;
+        for (auto &stripe: m_stripes) {
+            std::unique_lock<std::shared_mutex> lock(stripe.m_rw_mutex);
+            empty_pages.clear();
+            stripe.m_pages.forEach([&](std::uint64_t page_num, PageVersions &versions) {
+                // remove expired locks of a specific page (oldest first) until reaching the head_state_num
                 // NOTE: if the lock is non-expired then all higher state locks must also be retained
                 // otherwise would result in breaking the cache consistency for accessing head_state_num
-                if (it == m_cache.end() || it->first.first != page_num) {
-                    break;
+                while (!versions.empty()) {
+                    auto it = versions.begin();
+                    if (!stripe.m_refs[it->m_ref].expired() || it->m_state_num > head_state_num) {
+                        break;
+                    }
+                    stripe.m_refs.free(it->m_ref);
+                    versions.erase(it);
+                    --stripe.m_size;
+                    ++count;
                 }
+                if (versions.empty()) {
+                    empty_pages.push_back(page_num);
+                }
+            });
+            // NOTE: pages are removed after the scan since erase may relocate the remaining buckets
+            for (auto page_num: empty_pages) {
+                stripe.m_pages.erase(page_num);
             }
-            // iterate over to the next page
-            while (it != m_cache.end() && it->first.first == page_num) {
-                ++it;
-            }
-        }        
-        
+        }
         return count;
     }
     
     template <typename ResourceLockT>
     bool PageMap<ResourceLockT>::hasLocks() const
     {
-        std::shared_lock<std::shared_mutex> lock(m_rw_mutex);
-        for (const auto &p: m_cache) {
-            if (!p.second.expired()) {
+        for (auto &stripe: m_stripes) {
+            std::shared_lock<std::shared_mutex> lock(stripe.m_rw_mutex);
+            bool result = false;
+            stripe.m_pages.forEach([&](std::uint64_t, const PageVersions &versions) {
+                for (auto &version: versions) {
+                    if (!stripe.m_refs[version.m_ref].expired()) {
+                        result = true;
+                    }
+                }
+            });
+            if (result) {
                 return true;
             }
         }
         return false;
     }
     
-}
\ No newline at end of file
+}
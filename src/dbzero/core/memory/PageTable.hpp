@@ -0,0 +1,319 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <array>
+#include <cstdint>
+#include <cassert>
+#include <algorithm>
+#include <limits>
+#include "config.hpp"
+
+namespace db0
+
+{
+
+    /**
+     * Pool of weak references with stable addresses (i.e. never moved once allocated)
+     * items are addressed by 32-bit indexes, released items are reused
+    */
+    template <typename T> class WeakRefPool
+    {
+    public:
+        std::uint32_t alloc()
+        {
+            if (!m_free.empty()) {
+                auto index = m_free.back();
+                m_free.pop_back();
+                return index;
+            }
+            if ((m_size & CHUNK_MASK) == 0) {
+                m_chunks.emplace_back(new Chunk());
+            }
+            return m_size++;
+        }
+
+        void free(std::uint32_t index)
+        {
+            (*this)[index].reset();
+            m_free.push_back(index);
+        }
+
+        inline std::weak_ptr<T> &operator[](std::uint32_t index) const {
+            return (*m_chunks[index >> CHUNK_SHIFT])[index & CHUNK_MASK];
+        }
+
+        void clear()
+        {
+            m_chunks.clear();
+            m_free.clear();
+            m_size = 0;
+        }
+
+    private:
+        static constexpr unsigned int CHUNK_SHIFT = 8;
+        static constexpr std::uint32_t CHUNK_MASK = (1u << CHUNK_SHIFT) - 1;
+        using Chunk = std::array<std::weak_ptr<T>, 1u << CHUNK_SHIFT>;
+        std::vector<std::unique_ptr<Chunk> > m_chunks;
+        std::vector<std::uint32_t> m_free;
+        std::uint32_t m_size = 0;
+    };
+
+    /**
+     * Versions (state numbers) of a single page, sorted ascending
+     * a few versions are held inline, longer lists are moved to the heap
+    */
+    class PageVersions
+    {
+    public:
+        struct Version
+        {
+            StateNumType m_state_num;
+            // index in the WeakRefPool
+            std::uint32_t m_ref;
+        };
+
+        PageVersions() = default;
+        PageVersions(PageVersions &&) = default;
+        PageVersions &operator=(PageVersions &&) = default;
+
+        inline std::size_t size() const {
+            return m_size;
+        }
+
+        inline bool empty() const {
+            return m_size == 0;
+        }
+
+        inline const Version *begin() const {
+            return m_ext ? m_ext->data() : m_inline.data();
+        }
+
+        inline const Version *end() const {
+            return begin() + m_size;
+        }
+
+        // Find the most recent version with state number <= state_num
+        const Version *findLE(StateNumType state_num) const
+        {
+            auto first = begin();
+            for (auto it = end(); it != first;) {
+                --it;
+                if (it->m_state_num <= state_num) {
+                    return it;
+                }
+            }
+            return nullptr;
+        }
+
+        const Version *findExact(StateNumType state_num) const
+        {
+            auto it = findLE(state_num);
+            return (it && it->m_state_num == state_num) ? it : nullptr;
+        }
+
+        // NOTE: state_num must not exist
+        void insert(Version version)
+        {
+            if (!m_ext && m_size == INLINE_SIZE) {
+                m_ext = std::make_unique<std::vector<Version> >(m_inline.begin(), m_inline.end());
+            }
+            if (m_ext) {
+                auto it = std::upper_bound(m_ext->begin(), m_ext->end(), version.m_state_num, compare);
+                m_ext->insert(it, version);
+            } else {
+                auto it = std::upper_bound(m_inline.begin(), m_inline.begin() + m_size, version.m_state_num, compare);
+                std::move_backward(it, m_inline.begin() + m_size, m_inline.begin() + m_size + 1);
+                *it = version;
+            }
+            ++m_size;
+        }
+
+        void erase(const Version *it)
+        {
+            assert(it >= begin() && it < end());
+            auto index = it - begin();
+            if (m_ext) {
+                m_ext->erase(m_ext->begin() + index);
+                if (m_ext->size() <= INLINE_SIZE) {
+                    std::copy(m_ext->begin(), m_ext->end(), m_inline.begin());
+                    m_ext = nullptr;
+                }
+            } else {
+                std::move(m_inline.begin() + index + 1, m_inline.begin() + m_size, m_inline.begin() + index);
+            }
+            --m_size;
+        }
+
+    private:
+        static constexpr std::uint32_t INLINE_SIZE = 3;
+        std::array<Version, INLINE_SIZE> m_inline;
+        std::uint32_t m_size = 0;
+        std::unique_ptr<std::vector<Version> > m_ext;
+
+        static bool compare(StateNumType state_num, const Version &version) {
+            return state_num < version.m_state_num;
+        }
+    };
+
+    /**
+     * Open-addressing (linear probing) hash table: page_num -> PageVersions
+     * the table is not synchronized, see PageMap for the lock-striped wrapper
+    */
+    class PageVersionsTable
+    {
+    public:
+        struct Bucket
+        {
+            std::uint64_t m_page_num = EMPTY;
+            PageVersions m_versions;
+        };
+
+        static constexpr std::uint64_t EMPTY = std::numeric_limits<std::uint64_t>::max();
+
+        PageVersions *find(std::uint64_t page_num) {
+            return const_cast<PageVersions *>(static_cast<const PageVersionsTable &>(*this).find(page_num));
+        }
+
+        const PageVersions *find(std::uint64_t page_num) const
+        {
+            if (m_buckets.empty()) {
+                return nullptr;
+            }
+            for (auto index = slotOf(page_num);; index = (index + 1) & m_mask) {
+                auto &bucket = m_buckets[index];
+                if (bucket.m_page_num == page_num) {
+                    return &bucket.m_versions;
+                }
+                if (bucket.m_page_num == EMPTY) {
+                    return nullptr;
+                }
+            }
+        }
+
+        PageVersions &findOrCreate(std::uint64_t page_num)
+        {
+            assert(page_num != EMPTY);
+            if ((m_count + 1) * 4 > m_buckets.size() * 3) {
+                rehash(std::max<std::size_t>(MIN_CAPACITY, m_buckets.size() * 2));
+            }
+            for (auto index = slotOf(page_num);; index = (index + 1) & m_mask) {
+                auto &bucket = m_buckets[index];
+                if (bucket.m_page_num == page_num) {
+                    return bucket.m_versions;
+                }
+                if (bucket.m_page_num == EMPTY) {
+                    bucket.m_page_num = page_num;
+                    ++m_count;
+                    return bucket.m_versions;
+                }
+            }
+        }
+
+        // Remove the page entry (must exist and have no versions)
+        void erase(std::uint64_t page_num)
+        {
+            auto index = slotOf(page_num);
+            while (m_buckets[index].m_page_num != page_num) {
+                assert(m_buckets[index].m_page_num != EMPTY);
+                index = (index + 1) & m_mask;
+            }
+            assert(m_buckets[index].m_versions.empty());
+            // backward-shift deletion (no tombstones)
+            for (auto next = (index + 1) & m_mask;; next = (next + 1) & m_mask) {
+                auto &bucket = m_buckets[next];
+                if (bucket.m_page_num == EMPTY) {
+                    break;
+                }
+                auto home = slotOf(bucket.m_page_num);
+                // move the bucket if its home slot is not within the (index, next] range
+                if (((next - home) & m_mask) >= ((next - index) & m_mask)) {
+                    m_buckets[index] = std::move(bucket);
+                    index = next;
+                }
+            }
+            m_buckets[index].m_page_num = EMPTY;
+            m_buckets[index].m_versions = {};
+            --m_count;
+        }
+
+        template <typename F> void forEach(F &&f) const
+        {
+            for (auto &bucket: m_buckets) {
+                if (bucket.m_page_num != EMPTY) {
+                    f(bucket.m_page_num, bucket.m_versions);
+                }
+            }
+        }
+
+        template <typename F> void forEach(F &&f)
+        {
+            for (auto &bucket: m_buckets) {
+                if (bucket.m_page_num != EMPTY) {
+                    f(bucket.m_page_num, bucket.m_versions);
+                }
+            }
+        }
+
+        void clear()
+        {
+            m_buckets.clear();
+            m_mask = 0;
+            m_count = 0;
+        }
+
+        // number of pages
+        inline std::size_t size() const {
+            return m_count;
+        }
+
+        // the top bits of the hash select the stripe (see PageMap)
+        static constexpr unsigned int STRIPE_BITS = 6;
+
+        static inline std::uint64_t hash(std::uint64_t page_num) {
+            // Fibonacci hashing spreads the (mostly sequential) page numbers
+            return page_num * 0x9E3779B97F4A7C15ull;
+        }
+
+        static inline std::size_t stripeOf(std::uint64_t page_num) {
+            return hash(page_num) >> (64 - STRIPE_BITS);
+        }
+
+    private:
+        static constexpr std::size_t MIN_CAPACITY = 16;
+        std::vector<Bucket> m_buckets;
+        std::size_t m_mask = 0;
+        std::size_t m_count = 0;
+        unsigned int m_bits = 0;
+
+        inline std::size_t slotOf(std::uint64_t page_num) const {
+            // skip the bits used for striping
+            return (hash(page_num) << STRIPE_BITS) >> (64 - m_bits);
+        }
+
+        void rehash(std::size_t capacity)
+        {
+            std::vector<Bucket> buckets(capacity);
+            std::swap(buckets, m_buckets);
+            m_mask = capacity - 1;
+            m_bits = 0;
+            while ((std::size_t(1) << m_bits) < capacity) {
+                ++m_bits;
+            }
+            for (auto &bucket: buckets) {
+                if (bucket.m_page_num == EMPTY) {
+                    continue;
+                }
+                auto index = slotOf(bucket.m_page_num);
+                while (m_buckets[index].m_page_num != EMPTY) {
+                    index = (index + 1) & m_mask;
+                }
+                m_buckets[index] = std::move(bucket);
+            }
+        }
+    };
+
+}
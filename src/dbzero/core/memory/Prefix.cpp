@@ -32,6 +32,14 @@ namespace db0
     {
     }
     
+    void Prefix::prefetch(std::uint64_t, std::size_t)
+    {
+    }
+    
+    void Prefix::attachSharedCache(std::shared_ptr<SharedPageCache>, std::uint64_t)
+    {
+    }
+    
     bool Prefix::beginRefresh()
     {
         // refresh not supported by default
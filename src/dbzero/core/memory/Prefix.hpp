@@ -7,6 +7,7 @@
 #include <dbzero/core/memory/MemLock.hpp>
 #include <dbzero/core/memory/AccessOptions.hpp>
 #include <optional>
+#include <memory>
 
 namespace db0
 
@@ -15,6 +16,7 @@ namespace db0
     class Allocator;
     class BaseStorage;
     class ProcessTimer;
+    class SharedPageCache;
     
     /**
      * The Prefix interface represents a single DB0 Prefix space
@@ -45,6 +47,19 @@ namespace db0
         
         virtual std::size_t getPageSize() const = 0;
         
+        /**
+         * Hint that a specific address range is about to be read (e.g. by a sequential scan)
+         * the implementation may fetch the underlying pages asynchronously, the default is no-op
+        */
+        virtual void prefetch(std::uint64_t address, std::size_t size);
+
+        /**
+         * Attach the cross-process page cache to consult before reading from storage (read-only prefixes)
+         * @param prefix_uuid the identifier of the prefix (i.e. Fixture UUID), unique across processes
+         * the default implementation ignores the cache
+        */
+        virtual void attachSharedCache(std::shared_ptr<SharedPageCache>, std::uint64_t prefix_uuid);
+        
         /**
          * Get current (or the last finalized) state number
          * The current and finalized state number may be different for read/write prefixes (on head transaction)
@@ -6,6 +6,7 @@
 #include <dbzero/core/threading/ProgressiveMutex.hpp>
 #include <dbzero/core/storage/BaseStorage.hpp>
 #include <dbzero/core/utils/ProcessTimer.hpp>
+#include <dbzero/core/utils/Tracer.hpp>
 #include <iostream>
 #include "BoundaryLock.hpp"
 #include "CacheRecycler.hpp"
@@ -45,6 +46,33 @@ namespace db0
 
         auto lock = std::make_shared<DP_Lock>(m_dp_context, page_num << m_shift, m_page_size,
             access_mode, read_state_num, state_num, cow_lock);
+        registerPage(lock, is_volatile);
+        return lock;
+    }
+    
+    std::shared_ptr<DP_Lock> PrefixCache::insertPage(std::uint64_t page_num, StateNumType read_state_num,
+        FlagSet<AccessOptions> access_mode, std::vector<std::byte> &&data)
+    {
+        assert(!access_mode[AccessOptions::write]);
+        assert(data.size() == m_page_size);
+        auto lock = std::make_shared<DP_Lock>(m_dp_context, page_num << m_shift, std::move(data), access_mode,
+            read_state_num);
+        registerPage(lock, false);
+        return lock;
+    }
+    
+    std::shared_ptr<DP_Lock> PrefixCache::insertPage(std::uint64_t page_num, StateNumType read_state_num,
+        FlagSet<AccessOptions> access_mode, std::shared_ptr<const std::byte> shared_data)
+    {
+        assert(!access_mode[AccessOptions::write]);
+        auto lock = std::make_shared<DP_Lock>(m_dp_context, page_num << m_shift, m_page_size, shared_data,
+            access_mode, read_state_num);
+        registerPage(lock, false);
+        return lock;
+    }
+    
+    void PrefixCache::registerPage(std::shared_ptr<DP_Lock> lock, bool is_volatile)
+    {
         // register under the lock's evaluated state number
         m_dp_map.insert(lock->getStateNum(), lock);
         
@@ -59,8 +87,6 @@ namespace db0
                 m_cache_recycler_ptr->update(lock);
             }
         }
-
-        return lock;
     }
     
     std::shared_ptr<DP_Lock> PrefixCache::findPage(std::uint64_t page_num, StateNumType state_num,
@@ -472,6 +498,7 @@ namespace db0
     
     void PrefixCache::commit(ProcessTimer *parent_timer)
     {
+        DB0_TRACE("PrefixCache::commit");
         std::unique_ptr<ProcessTimer> timer;
         if (parent_timer) {
             timer = std::make_unique<ProcessTimer>("PrefixCache::commit", parent_timer);
@@ -72,6 +72,17 @@ namespace db0
         std::shared_ptr<DP_Lock> createPage(std::uint64_t page_num, StateNumType read_state_num,
             StateNumType state_num, FlagSet<AccessOptions>, std::shared_ptr<ResourceLock> cow_lock = nullptr);
         
+        /**
+         * Create a read-only page lock from contents already fetched from storage (e.g. by the read-ahead)
+         * @param data the page contents, taken over by the lock
+        */
+        std::shared_ptr<DP_Lock> insertPage(std::uint64_t page_num, StateNumType read_state_num,
+            FlagSet<AccessOptions>, std::vector<std::byte> &&data);
+        
+        // Create a read-only page lock over an external buffer (e.g. a page pinned in the shared cache)
+        std::shared_ptr<DP_Lock> insertPage(std::uint64_t page_num, StateNumType read_state_num,
+            FlagSet<AccessOptions>, std::shared_ptr<const std::byte> shared_data);
+        
         /**
          * Create a new wide range associated resource lock
          * @param size the lock size (must be > page size but may not be page aligned)
@@ -194,6 +205,7 @@ namespace db0
         */
         void forEach(std::function<void(ResourceLock &)>) const;
         
+        void registerPage(std::shared_ptr<DP_Lock>, bool is_volatile);
         void eraseRange(std::uint64_t address, std::size_t size, StateNumType state_num);
         void eraseBoundaryRange(std::uint64_t address, std::size_t size, StateNumType state_num);
 
@@ -3,6 +3,7 @@
 
 #include "PrefixImpl.hpp"
 #include "CacheRecycler.hpp"
+#include <dbzero/core/utils/Tracer.hpp>
 
 namespace db0
 
@@ -24,6 +25,10 @@ namespace db0
             // increment state number for read-write storage (i.e. new data transaction)
             ++m_head_state_num;
         }
+        // NOTE: read-ahead is opt-in (the worker thread is only useful for scan-heavy workloads)
+        if (m_storage_ptr->getFlags().test(StorageOptions::READ_AHEAD) && m_storage_ptr->supportsConcurrentReads()) {
+            m_read_ahead = std::make_unique<ReadAhead>(*m_storage_ptr, m_page_size);
+        }
     }
 
     PrefixImpl::PrefixImpl(std::string name, std::atomic<std::size_t> &dirty_meter, CacheRecycler &cache_recycler,
@@ -163,7 +168,38 @@ namespace db0
                     // assert lock is from past transaction
                     assert(mutation_id < state_num);
                 }
-                lock = m_cache.createPage(page_num, mutation_id, 0, access_mode);
+                if (m_read_ahead) {
+                    // NOTE: only the finalized state can be prefetched (pages of the head transaction may still change)
+                    auto finalized_state_num = std::min(state_num, getStateNum(true));
+                    if (finalized_state_num > 0) {
+                        m_read_ahead->onFault(page_num, finalized_state_num);
+                    }
+                    // take over the page if already prefetched in the same version
+                    std::vector<std::byte> data;
+                    if (m_read_ahead->tryGet(page_num, mutation_id, data)) {
+                        lock = insertPage(page_num, mutation_id, access_mode, std::move(data));
+                    }
+                }
+                if (!lock && m_shared_cache) {
+                    // map the shared page directly (pinned), copy only if unable to pin
+                    if (auto shared_data = m_shared_cache->tryPin(m_prefix_uuid, page_num, mutation_id)) {
+                        ++m_shared_cache_hits;
+                        lock = m_cache.insertPage(page_num, mutation_id, access_mode, shared_data);
+                    } else {
+                        std::vector<std::byte> data(m_page_size);
+                        if (m_shared_cache->tryGet(m_prefix_uuid, page_num, mutation_id, data.data())) {
+                            ++m_shared_cache_hits;
+                            lock = m_cache.insertPage(page_num, mutation_id, access_mode, std::move(data));
+                        } else {
+                            ++m_shared_cache_misses;
+                            m_storage_ptr->read(page_num << m_shift, mutation_id, m_page_size, data.data(), access_mode);
+                            lock = insertPage(page_num, mutation_id, access_mode, std::move(data));
+                        }
+                    }
+                }
+                if (!lock) {
+                    lock = m_cache.createPage(page_num, mutation_id, 0, access_mode);
+                }
             }
         } else {
             assert(getAccessType() == AccessType::READ_WRITE);
@@ -196,6 +232,19 @@ namespace db0
         return lock;
     }
     
+    std::shared_ptr<DP_Lock> PrefixImpl::insertPage(std::uint64_t page_num, StateNumType mutation_id,
+        FlagSet<AccessOptions> access_mode, std::vector<std::byte> &&data)
+    {
+        if (m_shared_cache) {
+            // publish the page and keep the pinned shared copy instead of the local one
+            m_shared_cache->put(m_prefix_uuid, page_num, mutation_id, data.data());
+            if (auto shared_data = m_shared_cache->tryPin(m_prefix_uuid, page_num, mutation_id)) {
+                return m_cache.insertPage(page_num, mutation_id, access_mode, shared_data);
+            }
+        }
+        return m_cache.insertPage(page_num, mutation_id, access_mode, std::move(data));
+    }
+    
     std::shared_ptr<WideLock> PrefixImpl::mapWideRange(
         std::uint64_t first_page, std::uint64_t end_page, std::uint64_t address, std::size_t size, 
         StateNumType state_num, FlagSet<AccessOptions> access_mode)
@@ -282,6 +331,28 @@ namespace db0
         return lock;
     }
     
+    void PrefixImpl::prefetch(std::uint64_t address, std::size_t size)
+    {
+        if (!m_read_ahead || !size) {
+            return;
+        }
+        auto state_num = getStateNum(true);
+        if (state_num > 0) {
+            m_read_ahead->prefetch(address >> m_shift, ((address + size - 1) >> m_shift) + 1, state_num);
+        }
+    }
+    
+    void PrefixImpl::attachSharedCache(std::shared_ptr<SharedPageCache> shared_cache, std::uint64_t prefix_uuid)
+    {
+        // NOTE: pages of a read/write prefix may be modified by the head transaction
+        if (m_access_type != AccessType::READ_ONLY || !shared_cache || shared_cache->getPageSize() != m_page_size) {
+            return;
+        }
+        assert(prefix_uuid);
+        m_shared_cache = shared_cache;
+        m_prefix_uuid = prefix_uuid;
+    }
+    
     StateNumType PrefixImpl::getStateNum(bool finalized) const
     {
         // NOTE: must apply atomic operation adjustment
@@ -319,6 +390,10 @@ namespace db0
 #ifndef NDEBUG
         m_cache.release();
 #endif
+        if (m_read_ahead) {
+            // the background reads must complete before closing the storage
+            m_read_ahead->stop();
+        }
         m_storage_ptr->close();
     }
     
@@ -332,6 +407,7 @@ namespace db0
     
     std::uint64_t PrefixImpl::completeRefresh()
     {
+        DB0_TRACE("PrefixImpl::completeRefresh");
         m_cache.beginRefresh();
         // remove updated pages from the cache
         // so that the new version can be fetched when needed
@@ -446,6 +522,17 @@ namespace db0
         callback("dirty_cache_bytes", m_cache.getDirtySize());        
         callback("dirty_dp_total", cow_stats.first);
         callback("dirty_dp_cow", cow_stats.second);
+        if (m_read_ahead) {
+            auto read_ahead_stats = m_read_ahead->getStats();
+            callback("readahead_hits", read_ahead_stats.m_hits);
+            callback("readahead_wasted", read_ahead_stats.m_wasted);
+            callback("readahead_window", read_ahead_stats.m_window);
+        }
+        if (m_shared_cache) {
+            callback("shared_cache_hits", m_shared_cache_hits.load(std::memory_order_relaxed));
+            callback("shared_cache_misses", m_shared_cache_misses.load(std::memory_order_relaxed));
+            callback("shared_cache_pinned", m_shared_cache->getPinnedCount());
+        }
     }
 
 }
\ No newline at end of file
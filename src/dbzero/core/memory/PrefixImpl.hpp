@@ -17,6 +17,8 @@
 #include "config.hpp"
 #include "PrefixViewImpl.hpp"
 #include "PrefixCache.hpp"
+#include "ReadAhead.hpp"
+#include "SharedPageCache.hpp"
     
 namespace db0
 
@@ -48,6 +50,10 @@ namespace db0
         std::size_t getPageSize() const override {
             return m_page_size;
         }
+        
+        void prefetch(std::uint64_t address, std::size_t size) override;
+
+        void attachSharedCache(std::shared_ptr<SharedPageCache>, std::uint64_t prefix_uuid) override;
 
         std::uint64_t commit(ProcessTimer * = nullptr) override;
 
@@ -99,10 +105,21 @@ namespace db0
         const std::uint32_t m_shift;
         StateNumType m_head_state_num;
         mutable PrefixCache m_cache;
+        // sequential access detection & prefetch (only if supported by the storage)
+        std::unique_ptr<ReadAhead> m_read_ahead;
+        // cross-process cache of finalized pages (read-only access only)
+        std::shared_ptr<SharedPageCache> m_shared_cache;
+        std::uint64_t m_prefix_uuid = 0;
+        // NOTE: updated by concurrent readers
+        std::atomic<std::uint64_t> m_shared_cache_hits = 0;
+        std::atomic<std::uint64_t> m_shared_cache_misses = 0;
         // flag indicating atomic operation in progress
         bool m_atomic = false;
         
         std::shared_ptr<DP_Lock> mapPage(std::uint64_t page_num, StateNumType state_num, FlagSet<AccessOptions>);
+        // Insert the read-only page fetched from storage (shared via the shared page cache if attached)
+        std::shared_ptr<DP_Lock> insertPage(std::uint64_t page_num, StateNumType mutation_id, FlagSet<AccessOptions>,
+            std::vector<std::byte> &&data);
         std::shared_ptr<BoundaryLock> mapBoundaryRange(std::uint64_t page_num, std::uint64_t address,
             std::size_t size, StateNumType state_num, FlagSet<AccessOptions>);
         std::shared_ptr<WideLock> mapWideRange(std::uint64_t first_page, std::uint64_t end_page, std::uint64_t address, 
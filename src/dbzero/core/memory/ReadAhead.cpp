@@ -0,0 +1,324 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#include "ReadAhead.hpp"
+#include <algorithm>
+#include <new>
+#include <set>
+#include <dbzero/core/storage/BaseStorage.hpp>
+#ifndef _WIN32
+#  include <pthread.h>
+#endif
+
+namespace db0
+
+{
+    
+    namespace
+    {
+        
+        // all existing instances, for the fork handlers
+        struct ReadAheadRegistry
+        {
+            std::mutex m_mutex;
+            std::set<ReadAhead*> m_instances;
+        };
+        
+        ReadAheadRegistry &getRegistry()
+        {
+            // NOTE: never destroyed, since the fork handlers may be invoked at any time
+            static auto *registry = new ReadAheadRegistry();
+            return *registry;
+        }
+        
+    }
+    
+    ReadAhead::ReadAhead(BaseStorage &storage, std::size_t page_size)
+        : m_storage(storage)
+        , m_page_size(page_size)
+    {
+#ifndef _WIN32
+        static std::once_flag at_fork_flag;
+        std::call_once(at_fork_flag, []() {
+            pthread_atfork(&ReadAhead::onForkPrepare, &ReadAhead::onForkParent, &ReadAhead::onForkChild);
+        });
+#endif
+        auto &registry = getRegistry();
+        std::unique_lock<std::mutex> lock(registry.m_mutex);
+        registry.m_instances.insert(this);
+    }
+
+    ReadAhead::~ReadAhead()
+    {
+        {
+            auto &registry = getRegistry();
+            std::unique_lock<std::mutex> lock(registry.m_mutex);
+            registry.m_instances.erase(this);
+        }
+        stop();
+    }
+    
+    void ReadAhead::onForkPrepare()
+    {
+        // NOTE: the instance locks are held across fork so that the child inherits a consistent state
+        auto &registry = getRegistry();
+        registry.m_mutex.lock();
+        for (auto instance: registry.m_instances) {
+            instance->m_mutex.lock();
+        }
+    }
+    
+    void ReadAhead::onForkParent()
+    {
+        auto &registry = getRegistry();
+        for (auto instance: registry.m_instances) {
+            instance->m_mutex.unlock();
+        }
+        registry.m_mutex.unlock();
+    }
+    
+    void ReadAhead::onForkChild()
+    {
+        auto &registry = getRegistry();
+        for (auto instance: registry.m_instances) {
+            instance->resetAfterFork();
+            instance->m_mutex.unlock();
+        }
+        registry.m_mutex.unlock();
+    }
+    
+    void ReadAhead::resetAfterFork()
+    {
+        // the worker thread does not exist in the child process, its handle and the condition variable
+        // (possibly referencing the worker as a waiter) are abandoned without being destroyed
+        new (&m_thread) std::thread();
+        new (&m_cv) std::condition_variable();
+        // the in-flight request will never complete, the worker is re-started on the next request
+        m_in_flight.reset();
+        m_requests.clear();
+        m_requested_end = 0;
+        m_run = 0;
+    }
+
+    void ReadAhead::onFault(std::uint64_t page_num, StateNumType state_num)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        // NOTE: gaps within the window are allowed (pages which are already cached don't fault)
+        if (page_num >= m_next_page && page_num <= m_next_page + m_stats.m_window) {
+            ++m_run;
+        } else {
+            // a new run begins, the pages prefetched ahead of the previous one are not likely to be used
+            if (m_requested_end > m_next_page) {
+                drop(m_next_page, m_requested_end, lock);
+            }
+            m_run = 1;
+            m_requested_end = 0;
+        }
+        m_next_page = page_num + 1;
+        if (m_run < MIN_RUN || m_stopped) {
+            return;
+        }
+        // keep the requested range at least half a window ahead of the faulted page
+        if (m_requested_end < m_next_page + m_stats.m_window / 2) {
+            auto end_page = m_next_page + m_stats.m_window;
+            schedule(std::max(m_requested_end, m_next_page), end_page, state_num, lock);
+            m_requested_end = end_page;
+        }
+    }
+
+    bool ReadAhead::tryGet(std::uint64_t page_num, StateNumType mutation_id, std::vector<std::byte> &buffer)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        // the page is being fetched, wait for it rather than issuing a duplicate read
+        m_cv.wait(lock, [&]() {
+            return !m_in_flight || !m_in_flight->contains(page_num);
+        });
+        // a queued (not yet started) request must not wait for the worker thread,
+        // the caller performs the (batched) read instead
+        auto request = takeOver(page_num, lock);
+        if (request) {
+            lock.unlock();
+            fetch(*request);
+            lock.lock();
+            evict(lock);
+        }
+        auto it = m_staged.find(page_num);
+        if (it == m_staged.end()) {
+            return false;
+        }
+        // the staged version may be outdated (e.g. page mutated in the meantime)
+        bool result = it->second.m_mutation_id == mutation_id;
+        if (result) {
+            buffer.swap(it->second.m_data);
+            ++m_stats.m_hits;
+            // the entire window was consumed, grow it
+            if (++m_window_hits >= m_stats.m_window) {
+                m_stats.m_window = std::min(m_stats.m_window * 2, MAX_WINDOW);
+                m_window_hits = 0;
+            }
+        } else {
+            ++m_stats.m_wasted;
+        }
+        m_staged.erase(it);
+        return result;
+    }
+
+    void ReadAhead::prefetch(std::uint64_t first_page, std::uint64_t end_page, StateNumType state_num)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_stopped || first_page >= end_page) {
+            return;
+        }
+        // the hint is capped by the maximum window size
+        schedule(first_page, std::min(end_page, first_page + MAX_WINDOW), state_num, lock);
+    }
+
+    void ReadAhead::clear()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_requests.clear();
+        m_cv.wait(lock, [&]() { return !m_in_flight; });
+        m_stats.m_wasted += m_staged.size();
+        m_staged.clear();
+        m_run = 0;
+        m_requested_end = 0;
+    }
+
+    void ReadAhead::stop()
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_stopped = true;
+            m_requests.clear();
+        }
+        m_cv.notify_all();
+        if (m_thread.joinable()) {
+            m_thread.join();
+        }
+    }
+
+    ReadAhead::Stats ReadAhead::getStats() const
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_stats;
+    }
+
+    std::optional<ReadAhead::Request> ReadAhead::takeOver(std::uint64_t page_num, std::unique_lock<std::mutex> &)
+    {
+        for (auto it = m_requests.begin(); it != m_requests.end(); ++it) {
+            if (!it->contains(page_num)) {
+                continue;
+            }
+            Request result { page_num, it->m_end_page, it->m_state_num };
+            // the leading part (if any) remains queued
+            it->m_end_page = page_num;
+            if (it->m_first_page == it->m_end_page) {
+                m_requests.erase(it);
+            }
+            return result;
+        }
+        return std::nullopt;
+    }
+    
+    void ReadAhead::schedule(std::uint64_t first_page, std::uint64_t end_page, StateNumType state_num,
+        std::unique_lock<std::mutex> &)
+    {
+        // skip the already staged leading pages
+        while (first_page < end_page && m_staged.find(first_page) != m_staged.end()) {
+            ++first_page;
+        }
+        if (first_page == end_page) {
+            return;
+        }
+        m_requests.push_back({ first_page, end_page, state_num });
+        // the worker thread is only started once needed
+        if (!m_thread.joinable()) {
+            m_thread = std::thread(&ReadAhead::run, this);
+        }
+        m_cv.notify_all();
+    }
+
+    void ReadAhead::evict(std::unique_lock<std::mutex> &lock)
+    {
+        if (m_staged.size() <= CAPACITY) {
+            return;
+        }
+        while (m_staged.size() > CAPACITY) {
+            m_staged.erase(m_staged.begin());
+            ++m_stats.m_wasted;
+        }
+        shrink(lock);
+    }
+    
+    void ReadAhead::drop(std::uint64_t first_page, std::uint64_t end_page, std::unique_lock<std::mutex> &lock)
+    {
+        auto it = m_staged.lower_bound(first_page);
+        if (it == m_staged.end() || it->first >= end_page) {
+            return;
+        }
+        while (it != m_staged.end() && it->first < end_page) {
+            it = m_staged.erase(it);
+            ++m_stats.m_wasted;
+        }
+        shrink(lock);
+    }
+    
+    void ReadAhead::shrink(std::unique_lock<std::mutex> &)
+    {
+        // pages fetched in vain
+        m_stats.m_window = std::max(m_stats.m_window / 2, MIN_WINDOW);
+        m_window_hits = 0;
+    }
+
+    void ReadAhead::run()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        for (;;) {
+            m_cv.wait(lock, [&]() { return m_stopped || !m_requests.empty(); });
+            if (m_stopped) {
+                break;
+            }
+            m_in_flight = m_requests.front();
+            m_requests.pop_front();
+            lock.unlock();
+            fetch(*m_in_flight);
+            lock.lock();
+            m_in_flight.reset();
+            evict(lock);
+            m_cv.notify_all();
+        }
+    }
+
+    void ReadAhead::fetch(const Request &request)
+    {
+        std::vector<StateNumType> mutations;
+        try {
+            // stop at the first non-existing page (e.g. end of data)
+            for (auto page_num = request.m_first_page; page_num != request.m_end_page; ++page_num) {
+                StateNumType mutation_id = 0;
+                if (!m_storage.tryFindMutation(page_num, request.m_state_num, mutation_id)) {
+                    break;
+                }
+                mutations.push_back(mutation_id);
+            }
+            if (mutations.empty()) {
+                return;
+            }
+            // fetch all pages with a single (batched) read
+            std::vector<std::byte> buffer(mutations.size() * m_page_size);
+            m_storage.read(request.m_first_page * m_page_size, request.m_state_num, buffer.size(), buffer.data(),
+                { AccessOptions::read });
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+            auto src = buffer.data();
+            for (std::size_t i = 0; i < mutations.size(); ++i, src += m_page_size) {
+                auto &page = m_staged[request.m_first_page + i];
+                page.m_mutation_id = mutations[i];
+                page.m_data.assign(src, src + m_page_size);
+            }
+        } catch (...) {
+            // read-ahead is a best-effort operation, the pages will be read on demand
+        }
+    }
+
+}
@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <deque>
+#include <map>
+#include <optional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "config.hpp"
+
+namespace db0
+
+{
+
+    class BaseStorage;
+
+    /**
+     * Per-prefix read-ahead: detects ascending runs of logical pages faulted in from storage
+     * and asynchronously fetches the next "window" pages on a dedicated thread
+     * Fetched pages are staged here (outside of the PrefixCache, which is not thread safe)
+     * and handed over to the cache on the next fault as clean (read) locks
+     * The window size adapts to the hit rate (doubled when fully consumed, halved when wasted)
+     * NOTE: the underlying storage must allow concurrent reads (see BaseStorage::supportsConcurrentReads)
+     * NOTE: the worker thread is re-started on demand in a forked child process
+    */
+    class ReadAhead
+    {
+    public:
+        // number of consecutive page faults required to trigger the read-ahead
+        static constexpr unsigned int MIN_RUN = 3;
+        static constexpr unsigned int MIN_WINDOW = 8;
+        static constexpr unsigned int MAX_WINDOW = 256;
+        // max number of staged pages
+        static constexpr unsigned int CAPACITY = 2 * MAX_WINDOW;
+
+        ReadAhead(BaseStorage &, std::size_t page_size);
+        ~ReadAhead();
+
+        /**
+         * Register a page fault (page not found in cache) for read
+         * @param state_num the finalized state number to prefetch pages from (only mutations up to this state are staged)
+        */
+        void onFault(std::uint64_t page_num, StateNumType state_num);
+
+        /**
+         * Take over the staged page contents (if available)
+         * NOTE: the call blocks if the page is currently being fetched, a queued (not yet started) request
+         * for the page is taken over and read by the calling thread
+         * @param mutation_id the exact mutation (state number) of the page requested
+         * @return false if page not staged or staged in a different version
+        */
+        bool tryGet(std::uint64_t page_num, StateNumType mutation_id, std::vector<std::byte> &buffer);
+
+        // Explicitly request fetching of pages [first_page, end_page)
+        void prefetch(std::uint64_t first_page, std::uint64_t end_page, StateNumType state_num);
+
+        // Cancel pending requests and drop all staged pages
+        void clear();
+
+        // Complete the in-flight request and stop the worker thread
+        void stop();
+
+        struct Stats
+        {
+            // number of staged pages consumed
+            std::uint64_t m_hits = 0;
+            // number of staged pages dropped without being used
+            std::uint64_t m_wasted = 0;
+            unsigned int m_window = MIN_WINDOW;
+        };
+
+        Stats getStats() const;
+
+    private:
+        struct Request
+        {
+            std::uint64_t m_first_page;
+            std::uint64_t m_end_page;
+            StateNumType m_state_num;
+            
+            inline bool contains(std::uint64_t page_num) const {
+                return page_num >= m_first_page && page_num < m_end_page;
+            }
+        };
+
+        struct StagedPage
+        {
+            StateNumType m_mutation_id;
+            std::vector<std::byte> m_data;
+        };
+
+        BaseStorage &m_storage;
+        const std::size_t m_page_size;
+        mutable std::mutex m_mutex;
+        std::condition_variable m_cv;
+        std::deque<Request> m_requests;
+        // the request currently processed by the worker thread
+        std::optional<Request> m_in_flight;
+        // staged pages by page number (the lowest page numbers are evicted first)
+        std::map<std::uint64_t, StagedPage> m_staged;
+        // sequential access detector
+        std::uint64_t m_next_page = 0;
+        unsigned int m_run = 0;
+        // the end of the already requested range (within the current run)
+        std::uint64_t m_requested_end = 0;
+        // number of hits since the last window adjustment
+        unsigned int m_window_hits = 0;
+        Stats m_stats;
+        bool m_stopped = false;
+        std::thread m_thread;
+
+        // withdraw the part of a queued request starting at the page (if present)
+        std::optional<Request> takeOver(std::uint64_t page_num, std::unique_lock<std::mutex> &);
+        void schedule(std::uint64_t first_page, std::uint64_t end_page, StateNumType state_num,
+            std::unique_lock<std::mutex> &);
+        void evict(std::unique_lock<std::mutex> &);
+        // drop staged pages from a specific range as wasted and shrink the window
+        void drop(std::uint64_t first_page, std::uint64_t end_page, std::unique_lock<std::mutex> &);
+        void shrink(std::unique_lock<std::mutex> &);
+        void run();
+        void fetch(const Request &);
+        
+        static void onForkPrepare();
+        static void onForkParent();
+        static void onForkChild();
+        void resetAfterFork();
+    };
+
+}
@@ -43,12 +43,15 @@ namespace db0
         , m_address(lock->m_address)
         // copy-on-write, the recycled flag must be erased
         , m_resource_flags(
-            (lock->m_resource_flags & ~(db0::RESOURCE_RECYCLED | db0::RESOURCE_DIRTY))            
+            (lock->m_resource_flags & ~(db0::RESOURCE_RECYCLED | db0::RESOURCE_DIRTY | db0::RESOURCE_ACCESSED))            
         )
         , m_access_mode(access_mode)
         , m_data(lock->m_data)
         , m_cow_lock(lock)
     {
+        if (lock->m_shared_data) {
+            m_data.assign(lock->m_shared_data.get(), lock->m_shared_data.get() + lock->m_shared_size);
+        }
 #ifndef NDEBUG
         rl_usage += this->size();
         ++rl_count;
@@ -56,6 +59,23 @@ namespace db0
 #endif      
     }
     
+    ResourceLock::ResourceLock(StorageContext storage_context, std::uint64_t address, std::size_t size,
+        FlagSet<AccessOptions> access_mode, std::shared_ptr<const std::byte> shared_data)
+        : m_context(storage_context)
+        , m_address(address)
+        , m_access_mode(access_mode)
+        , m_shared_data(shared_data)
+        , m_shared_size(size)
+    {
+        assert(m_shared_data);
+        assert(!access_mode[AccessOptions::write]);
+#ifndef NDEBUG
+        rl_usage += this->size();
+        ++rl_count;
+        ++rl_op_count;
+#endif
+    }
+    
     ResourceLock::~ResourceLock()
     {
 #ifndef NDEBUG        
@@ -68,6 +88,9 @@ namespace db0
         assert(!isDirty());
     }
     
+    void ResourceLock::prepareFlush(FlushMethod) {
+    }
+    
     bool ResourceLock::addrPageAligned(BaseStorage &storage) const {
         return m_address % storage.getPageSize() == 0;
     }
@@ -201,18 +224,28 @@ namespace db0
     
     std::size_t ResourceLock::usedMem() const
     {
-        std::size_t result = m_data.size() + sizeof(*this);
+        // NOTE: the external buffer is accounted for as well (to limit the number of locks holding it)
+        std::size_t result = this->size() + sizeof(*this);
         // assume potential CoW buffer
         if (!m_access_mode[AccessOptions::no_cow]) {
-            result += m_data.size();
+            result += this->size();
         }
         return result;
     }
     
     std::uint64_t ResourceLock::getAddressOf(const void *ptr) const
     {
-        assert(ptr >= m_data.data() && ptr < m_data.data() + m_data.size());
-        return m_address + static_cast<const std::byte*>(ptr) - m_data.data();
+        auto buffer = static_cast<const std::byte*>(getBuffer());
+        assert(ptr >= buffer && ptr < buffer + this->size());
+        return m_address + static_cast<const std::byte*>(ptr) - buffer;
+    }
+    
+    void ResourceLock::unshare()
+    {
+        if (m_shared_data) {
+            m_data.assign(m_shared_data.get(), m_shared_data.get() + m_shared_size);
+            m_shared_data = nullptr;
+        }
     }
     
     bool ResourceLock::getDiffs(const void *buf, std::vector<std::uint16_t> &result) const
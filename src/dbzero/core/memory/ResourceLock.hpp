@@ -65,6 +65,13 @@ namespace db0
         
         // Copy-on-write constructor
         ResourceLock(std::shared_ptr<ResourceLock>, FlagSet<AccessOptions>);
+
+        /**
+         * Create a read-only lock over an externally owned buffer (e.g. a page mapped from the shared cache)
+         * @param shared_data the buffer (of a given size) kept alive for the lock's lifetime
+        */
+        ResourceLock(StorageContext, std::uint64_t address, std::size_t size, FlagSet<AccessOptions>,
+            std::shared_ptr<const std::byte> shared_data);
         
         virtual ~ResourceLock();
         
@@ -72,12 +79,13 @@ namespace db0
          * Get the underlying buffer
         */
         inline void *getBuffer() const {
-            return m_data.data();
+            // NOTE: the external buffer may be mapped read-only
+            return m_shared_data ? const_cast<std::byte*>(m_shared_data.get()) : m_data.data();
         }
 
         inline void *getBuffer(std::uint64_t address) const
         {
-            assert(address >= m_address && address < m_address + m_data.size());
+            assert(address >= m_address && address < m_address + size());
             return static_cast<std::byte*>(getBuffer()) + address - m_address;
         }
         
@@ -94,6 +102,12 @@ namespace db0
          * Data is flushed into the current state of the associated storage view
         */
         virtual void flush() = 0;
+        
+        /**
+         * Pre-compute data required by the following tryFlush call (e.g. diffs)
+         * This operation only reads the lock's data and can be run concurrently for different locks
+        */
+        virtual void prepareFlush(FlushMethod);
 
         /**
          * Clear the 'dirty' flag if it has been set, clear diffs
@@ -106,7 +120,12 @@ namespace db0
         }
         
         inline std::size_t size() const {
-            return m_data.size();
+            return m_shared_data ? m_shared_size : m_data.size();
+        }
+
+        // Check if the lock's data is held in an external buffer
+        inline bool isShared() const {
+            return m_shared_data != nullptr;
         }
 
         inline bool isRecycled() const {
@@ -197,8 +216,13 @@ namespace db0
         FlagSet<AccessOptions> m_access_mode;
         
         mutable std::vector<std::byte> m_data;
+        // the external read-only buffer (used instead of m_data if set)
+        std::shared_ptr<const std::byte> m_shared_data;
+        std::size_t m_shared_size = 0;
         // CacheRecycler's iterator
         iterator m_recycle_it = 0;
+        // CacheRecycler's queue indicator (the probationary queue of the S3-FIFO policy)
+        bool m_probation = false;
         // immutable copy-on-write lock (i.e. previous version)
         std::shared_ptr<ResourceLock> m_cow_lock;
         // the internally managed CoW's buffer
@@ -214,6 +238,8 @@ namespace db0
         bool addrPageAligned(BaseStorage &) const;
         
         const std::byte *getCowPtr() const;
+        // Copy the external buffer's contents into the local buffer (before the lock can be modified)
+        void unshare();
         bool getDiffs(const void *buf, std::vector<std::uint16_t> &result) const;
                 
 #ifndef NDEBUG
@@ -0,0 +1,553 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#include "SharedPageCache.hpp"
+#include <cstring>
+#include <cassert>
+#include <thread>
+#include <chrono>
+#include <array>
+#include <algorithm>
+#include <dbzero/core/exception/Exceptions.hpp>
+#ifndef _WIN32
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include <signal.h>
+#endif
+
+namespace db0
+
+{
+
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "SharedPageCache requires lock-free 64-bit atomics");
+
+    static constexpr std::uint64_t SHARED_PAGE_CACHE_MAGIC = 0xdb0ca11e5ba7edULL;
+    static constexpr std::uint32_t SHARED_PAGE_CACHE_VERSION = 3;
+    // how long to wait for another process to create / initialize the segment
+    static constexpr auto INIT_TIMEOUT = std::chrono::seconds(1);
+
+    // header state (lower 2 bits of Header::m_init, the upper bits hold the initializing process ID)
+    static constexpr std::uint64_t HEADER_EMPTY = 0;
+    static constexpr std::uint64_t HEADER_INIT = 1;
+    static constexpr std::uint64_t HEADER_READY = 2;
+
+    struct alignas(64) SharedPageCache::Header
+    {
+        // (pid << 2) | state
+        std::atomic<std::uint64_t> m_init;
+        std::uint32_t m_version;
+        std::uint64_t m_magic;
+        std::uint64_t m_page_size;
+        std::uint64_t m_slot_count;
+        // set once more than MAX_ATTACHED processes attached (the segment is then never removed automatically)
+        std::atomic<std::uint32_t> m_untracked;
+        // IDs of the attached processes (0 = free entry)
+        std::atomic<std::int32_t> m_attached[MAX_ATTACHED];
+    };
+
+    struct alignas(64) SharedPageCache::Slot
+    {
+        // seqlock sequence, odd while the slot is being written
+        std::atomic<std::uint64_t> m_seq;
+        // ID of the process writing to the slot (0 if none), allows recovering slots of crashed writers
+        std::atomic<std::uint64_t> m_writer;
+        // key (prefix UUID = 0 indicates an empty slot)
+        std::atomic<std::uint64_t> m_prefix_uuid;
+        std::atomic<std::uint64_t> m_page_num;
+        std::atomic<std::uint64_t> m_mutation_id;
+        // processes holding the page mapped (one bit per index of the attached process)
+        std::atomic<std::uint64_t> m_pins[MAX_ATTACHED / 64];
+    };
+
+    // split-mix finalizer
+    static inline std::uint64_t mix(std::uint64_t x)
+    {
+        x ^= x >> 30;
+        x *= 0xbf58476d1ce4e5b9ULL;
+        x ^= x >> 27;
+        x *= 0x94d049bb133111ebULL;
+        x ^= x >> 31;
+        return x;
+    }
+
+    static inline std::size_t alignUp(std::size_t value, std::size_t alignment) {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    // segment layout: header, slot table, page data (page aligned)
+    static constexpr std::size_t SLOTS_OFFSET = 64 + SharedPageCache::MAX_ATTACHED * 4;
+    static constexpr std::size_t SLOT_SIZE = 128;
+
+    static inline std::size_t getDataOffset(std::size_t slot_count, std::size_t page_size) {
+        return alignUp(SLOTS_OFFSET + slot_count * SLOT_SIZE, page_size);
+    }
+
+    static inline std::size_t getSegmentSize(std::size_t slot_count, std::size_t page_size) {
+        return getDataOffset(slot_count, page_size) + slot_count * page_size;
+    }
+
+#ifndef _WIN32
+
+    static inline int getProcessId() {
+        return ::getpid();
+    }
+
+    static bool isProcessAlive(std::uint64_t pid)
+    {
+        // NOTE: EPERM means the process exists but belongs to another user
+        return ::kill(static_cast<pid_t>(pid), 0) == 0 || errno != ESRCH;
+    }
+
+    SharedPageCache::SharedPageCache(const std::string &name, std::size_t capacity, std::size_t page_size)
+        : m_name(name)
+        , m_page_size(page_size)
+        , m_pid(getProcessId())
+    {
+        static_assert(sizeof(Header) <= SLOTS_OFFSET);
+        static_assert(sizeof(Slot) == SLOT_SIZE);
+        assert(page_size > 0);
+        // only the process which created the segment sets its size (so that it never changes once mapped)
+        int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        bool is_creator = fd >= 0;
+        if (!is_creator && errno == EEXIST) {
+            fd = ::shm_open(name.c_str(), O_RDWR, 0600);
+        }
+        if (fd < 0) {
+            THROWF(db0::IOException) << "SharedPageCache: unable to open shared memory segment " << name
+                << ": " << strerror(errno) << THROWF_END;
+        }
+
+        auto fail = [&](int err, const char *what) {
+            ::close(fd);
+            if (is_creator) {
+                ::shm_unlink(name.c_str());
+            }
+            THROWF(db0::IOException) << "SharedPageCache: " << what << " failed: " << strerror(err) << THROWF_END;
+        };
+
+        struct stat st;
+        auto deadline = std::chrono::steady_clock::now() + INIT_TIMEOUT;
+        for (;;) {
+            if (::fstat(fd, &st) != 0) {
+                fail(errno, "fstat");
+            }
+            if (st.st_size || is_creator) {
+                break;
+            }
+            if (std::chrono::steady_clock::now() >= deadline) {
+                // the creator must have died before sizing the segment
+                is_creator = true;
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        m_size = st.st_size;
+        if (!m_size) {
+            // new segment, size by the requested capacity
+            auto slot_count = (capacity / (page_size + SLOT_SIZE)) / WAYS * WAYS;
+            while (slot_count && getSegmentSize(slot_count, page_size) > capacity) {
+                slot_count -= WAYS;
+            }
+            if (!slot_count) {
+                ::close(fd);
+                if (is_creator) {
+                    ::shm_unlink(name.c_str());
+                }
+                THROWF(db0::InputException) << "SharedPageCache: capacity too small: " << capacity << THROWF_END;
+            }
+            m_size = getSegmentSize(slot_count, page_size);
+            // shared memory is allocated lazily, exceeding the available space would crash on first access (SIGBUS)
+            struct statvfs vfs;
+            if (::fstatvfs(fd, &vfs) == 0 && static_cast<std::uint64_t>(vfs.f_bavail) * vfs.f_frsize < m_size) {
+                ::close(fd);
+                ::shm_unlink(name.c_str());
+                THROWF(db0::InputException) << "SharedPageCache: capacity " << capacity
+                    << " exceeds the available shared memory: " << static_cast<std::uint64_t>(vfs.f_bavail) * vfs.f_frsize
+                    << THROWF_END;
+            }
+            // NOTE: the contents are zero-initialized
+            if (::ftruncate(fd, m_size) != 0) {
+                fail(errno, "ftruncate");
+            }
+        }
+
+        m_segment = ::mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        int err = errno;
+        if (m_segment != MAP_FAILED) {
+            m_ro_segment = ::mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0);
+            err = errno;
+        }
+        ::close(fd);
+        if (m_segment == MAP_FAILED || m_ro_segment == MAP_FAILED) {
+            if (m_segment != MAP_FAILED) {
+                ::munmap(m_segment, m_size);
+            }
+            m_segment = nullptr;
+            m_ro_segment = nullptr;
+            THROWF(db0::IOException) << "SharedPageCache: mmap failed: " << strerror(err) << THROWF_END;
+        }
+
+        m_header = static_cast<Header*>(m_segment);
+        initHeader();
+        if ((m_header->m_init.load(std::memory_order_acquire) & 3) != HEADER_READY
+            || m_header->m_magic != SHARED_PAGE_CACHE_MAGIC
+            || m_header->m_version != SHARED_PAGE_CACHE_VERSION || m_header->m_page_size != page_size
+            || !m_header->m_slot_count || getSegmentSize(m_header->m_slot_count, page_size) > m_size)
+        {
+            ::munmap(m_segment, m_size);
+            ::munmap(m_ro_segment, m_size);
+            m_segment = nullptr;
+            THROWF(db0::InputException) << "SharedPageCache: incompatible shared memory segment " << name
+                << " (page size = " << page_size << ")" << THROWF_END;
+        }
+
+        m_slot_count = m_header->m_slot_count;
+        m_slots = reinterpret_cast<Slot*>(static_cast<std::byte*>(m_segment) + SLOTS_OFFSET);
+        m_data = static_cast<std::byte*>(m_segment) + getDataOffset(m_slot_count, page_size);
+        m_ro_data = static_cast<const std::byte*>(m_ro_segment) + getDataOffset(m_slot_count, page_size);
+        attach();
+    }
+
+    SharedPageCache::~SharedPageCache()
+    {
+        if (m_segment) {
+            close();
+            ::munmap(m_segment, m_size);
+            ::munmap(m_ro_segment, m_size);
+        }
+    }
+
+    void SharedPageCache::close()
+    {
+        std::unique_lock<std::mutex> lock(m_pin_mutex);
+        // NOTE: a forked child process does not detach the parent's registration
+        if (getProcessId() == m_pid && detach()) {
+            ::shm_unlink(m_name.c_str());
+        }
+        // the entry may now be reused by another process, pins are no longer tracked
+        m_attached_index = -1;
+    }
+
+    void SharedPageCache::initHeader()
+    {
+        const std::uint64_t owned = (static_cast<std::uint64_t>(m_pid) << 2) | HEADER_INIT;
+        auto init = m_header->m_init.load(std::memory_order_acquire);
+        auto deadline = std::chrono::steady_clock::now() + INIT_TIMEOUT;
+        for (;;) {
+            if ((init & 3) == HEADER_READY) {
+                return;
+            }
+            if ((init & 3) == HEADER_EMPTY || !isProcessAlive(init >> 2)) {
+                // initialize (or take over from the process which died while initializing)
+                if (m_header->m_init.compare_exchange_strong(init, owned, std::memory_order_acquire)) {
+                    break;
+                }
+                continue;
+            }
+            if (std::chrono::steady_clock::now() >= deadline) {
+                // initialization still in progress, reported as incompatible
+                return;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            init = m_header->m_init.load(std::memory_order_acquire);
+        }
+
+        // slot count is derived from the actual segment size
+        std::size_t slot_count = (m_size - SLOTS_OFFSET) / (m_page_size + SLOT_SIZE) / WAYS * WAYS;
+        while (slot_count && getSegmentSize(slot_count, m_page_size) > m_size) {
+            slot_count -= WAYS;
+        }
+        m_header->m_version = SHARED_PAGE_CACHE_VERSION;
+        m_header->m_magic = SHARED_PAGE_CACHE_MAGIC;
+        m_header->m_page_size = m_page_size;
+        m_header->m_slot_count = slot_count;
+        m_header->m_init.store((static_cast<std::uint64_t>(m_pid) << 2) | HEADER_READY, std::memory_order_release);
+    }
+
+    void SharedPageCache::attach()
+    {
+        for (unsigned int i = 0; i < MAX_ATTACHED; ++i) {
+            auto &entry = m_header->m_attached[i];
+            auto pid = entry.load(std::memory_order_relaxed);
+            // reuse entries of processes which exited without detaching
+            if ((!pid || !isProcessAlive(pid)) && entry.compare_exchange_strong(pid, m_pid)) {
+                m_attached_index = i;
+                // clear pins left by a previous process with the same index
+                auto mask = ~(std::uint64_t(1) << (i % 64));
+                for (std::size_t slot = 0; slot < m_slot_count; ++slot) {
+                    m_slots[slot].m_pins[i / 64].fetch_and(mask);
+                }
+                return;
+            }
+        }
+        m_header->m_untracked.store(1, std::memory_order_relaxed);
+    }
+
+    bool SharedPageCache::detach()
+    {
+        if (m_attached_index < 0) {
+            return false;
+        }
+        m_header->m_attached[m_attached_index].store(0, std::memory_order_release);
+        if (m_header->m_untracked.load(std::memory_order_relaxed)) {
+            return false;
+        }
+        for (auto &entry: m_header->m_attached) {
+            auto pid = entry.load(std::memory_order_acquire);
+            if (pid && isProcessAlive(pid)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void SharedPageCache::unlink(const std::string &name) {
+        ::shm_unlink(name.c_str());
+    }
+
+    bool SharedPageCache::exists(const std::string &name)
+    {
+        int fd = ::shm_open(name.c_str(), O_RDONLY, 0600);
+        if (fd < 0) {
+            return false;
+        }
+        ::close(fd);
+        return true;
+    }
+
+    std::string SharedPageCache::getDefaultName(std::size_t page_size) {
+        return "/db0-page-cache-" + std::to_string(::getuid()) + "-" + std::to_string(page_size);
+    }
+
+#else
+
+    static inline int getProcessId() {
+        return 0;
+    }
+
+    static bool isProcessAlive(std::uint64_t) {
+        return true;
+    }
+
+    SharedPageCache::SharedPageCache(const std::string &name, std::size_t, std::size_t page_size)
+        : m_name(name)
+        , m_page_size(page_size)
+    {
+        THROWF(db0::InputException) << "SharedPageCache: not supported on this platform" << THROWF_END;
+    }
+
+    SharedPageCache::~SharedPageCache()
+    {
+    }
+
+    void SharedPageCache::close() {
+    }
+
+    void SharedPageCache::unlink(const std::string &) {
+    }
+
+    bool SharedPageCache::exists(const std::string &) {
+        return false;
+    }
+
+    std::string SharedPageCache::getDefaultName(std::size_t page_size) {
+        return "/db0-page-cache-" + std::to_string(page_size);
+    }
+
+#endif
+
+    SharedPageCache::Slot *SharedPageCache::getSet(std::uint64_t prefix_uuid, std::uint64_t page_num) const
+    {
+        // NOTE: the mutation ID is not hashed so that versions of the same page compete for the same set
+        auto set_num = mix(prefix_uuid ^ mix(page_num)) % (m_slot_count / WAYS);
+        return m_slots + set_num * WAYS;
+    }
+
+    std::byte *SharedPageCache::getData(const Slot *slot) const {
+        return m_data + (slot - m_slots) * m_page_size;
+    }
+
+    bool SharedPageCache::tryGet(std::uint64_t prefix_uuid, std::uint64_t page_num, StateNumType mutation_id,
+        void *buffer) const
+    {
+        assert(prefix_uuid);
+        auto slot = getSet(prefix_uuid, page_num);
+        for (unsigned int i = 0; i < WAYS; ++i, ++slot) {
+            auto seq = slot->m_seq.load(std::memory_order_acquire);
+            if ((seq & 1) || slot->m_prefix_uuid.load(std::memory_order_relaxed) != prefix_uuid
+                || slot->m_page_num.load(std::memory_order_relaxed) != page_num
+                || slot->m_mutation_id.load(std::memory_order_relaxed) != mutation_id)
+            {
+                continue;
+            }
+            std::memcpy(buffer, getData(slot), m_page_size);
+            // validate that the slot was not overwritten while copying
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return slot->m_seq.load(std::memory_order_relaxed) == seq;
+        }
+        return false;
+    }
+
+    std::shared_ptr<const std::byte> SharedPageCache::tryPin(std::uint64_t prefix_uuid, std::uint64_t page_num,
+        StateNumType mutation_id)
+    {
+        assert(prefix_uuid);
+        // NOTE: pins can only be tracked for the registered (attaching) process
+        if (m_attached_index < 0 || getProcessId() != m_pid) {
+            return nullptr;
+        }
+        auto slot = getSet(prefix_uuid, page_num);
+        for (unsigned int i = 0; i < WAYS; ++i, ++slot) {
+            auto seq = slot->m_seq.load(std::memory_order_acquire);
+            if ((seq & 1) || slot->m_prefix_uuid.load(std::memory_order_relaxed) != prefix_uuid
+                || slot->m_page_num.load(std::memory_order_relaxed) != page_num
+                || slot->m_mutation_id.load(std::memory_order_relaxed) != mutation_id)
+            {
+                continue;
+            }
+
+            std::size_t slot_index = slot - m_slots;
+            {
+                std::unique_lock<std::mutex> lock(m_pin_mutex);
+                auto &count = m_pin_counts[slot_index];
+                if (!count) {
+                    // NOTE: the pin must be visible before checking the writer (which checks the pins after taking the slot)
+                    auto &pins = slot->m_pins[m_attached_index / 64];
+                    auto bit = std::uint64_t(1) << (m_attached_index % 64);
+                    pins.fetch_or(bit);
+                    if (slot->m_writer.load() || slot->m_seq.load() != seq) {
+                        pins.fetch_and(~bit);
+                        m_pin_counts.erase(slot_index);
+                        return nullptr;
+                    }
+                }
+                ++count;
+            }
+            auto self = shared_from_this();
+            return std::shared_ptr<const std::byte>(m_ro_data + slot_index * m_page_size,
+                [self, slot_index](const std::byte *) {
+                    self->unpin(slot_index);
+                }
+            );
+        }
+        return nullptr;
+    }
+
+    void SharedPageCache::unpin(std::size_t slot_index)
+    {
+        std::unique_lock<std::mutex> lock(m_pin_mutex);
+        auto it = m_pin_counts.find(slot_index);
+        assert(it != m_pin_counts.end());
+        if (--it->second) {
+            return;
+        }
+        m_pin_counts.erase(it);
+        // NOTE: a forked child must not release the parent's pins
+        if (getProcessId() == m_pid && m_attached_index >= 0) {
+            m_slots[slot_index].m_pins[m_attached_index / 64].fetch_and(~(std::uint64_t(1) << (m_attached_index % 64)));
+        }
+    }
+
+    std::size_t SharedPageCache::getPinnedCount() const
+    {
+        std::unique_lock<std::mutex> lock(m_pin_mutex);
+        return m_pin_counts.size();
+    }
+
+    bool SharedPageCache::isPinned(const Slot *slot) const
+    {
+        for (unsigned int i = 0; i < MAX_ATTACHED / 64; ++i) {
+            auto pins = slot->m_pins[i].load();
+            while (pins) {
+                auto index = i * 64 + __builtin_ctzll(pins);
+                auto pid = m_header->m_attached[index].load();
+                if (pid && isProcessAlive(pid)) {
+                    return true;
+                }
+                pins &= pins - 1;
+            }
+        }
+        return false;
+    }
+
+    bool SharedPageCache::tryAcquire(Slot *slot) const
+    {
+        // NOTE: the process ID is not cached since the instance might be inherited by a forked child
+        std::uint64_t pid = getProcessId();
+        std::uint64_t writer = 0;
+        if (!slot->m_writer.compare_exchange_strong(writer, pid)) {
+            // slot is being written by another process / thread, recover it if the writer no longer exists
+            if (isProcessAlive(writer) || !slot->m_writer.compare_exchange_strong(writer, pid)) {
+                return false;
+            }
+        }
+        if (isPinned(slot)) {
+            slot->m_writer.store(0, std::memory_order_release);
+            return false;
+        }
+        return true;
+    }
+
+    void SharedPageCache::put(std::uint64_t prefix_uuid, std::uint64_t page_num, StateNumType mutation_id,
+        const void *buffer)
+    {
+        assert(prefix_uuid);
+        auto set = getSet(prefix_uuid, page_num);
+        // candidate slots in order of preference
+        std::array<Slot*, WAYS> candidates;
+        unsigned int count = 0;
+        auto add = [&](Slot *slot) {
+            if (std::find(candidates.begin(), candidates.begin() + count, slot) == candidates.begin() + count) {
+                candidates[count++] = slot;
+            }
+        };
+        for (unsigned int i = 0; i < WAYS; ++i) {
+            auto slot = set + i;
+            if (slot->m_prefix_uuid.load(std::memory_order_relaxed) == prefix_uuid
+                && slot->m_page_num.load(std::memory_order_relaxed) == page_num)
+            {
+                if (slot->m_mutation_id.load(std::memory_order_relaxed) == mutation_id
+                    && !(slot->m_seq.load(std::memory_order_relaxed) & 1))
+                {
+                    // already cached
+                    return;
+                }
+                // replace the other version of the same page (or the one left by a crashed writer)
+                add(slot);
+            }
+        }
+        for (unsigned int i = 0; i < WAYS; ++i) {
+            if (!set[i].m_prefix_uuid.load(std::memory_order_relaxed)) {
+                // empty slot
+                add(set + i);
+            }
+        }
+        auto next_victim = m_next_victim.fetch_add(1, std::memory_order_relaxed);
+        for (unsigned int i = 0; i < WAYS; ++i) {
+            add(set + (next_victim + i) % WAYS);
+        }
+
+        for (auto victim: candidates) {
+            if (!tryAcquire(victim)) {
+                continue;
+            }
+            // NOTE: the sequence is already odd if the previous writer died while writing
+            auto seq = victim->m_seq.load(std::memory_order_relaxed) | 1;
+            victim->m_seq.store(seq, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            victim->m_prefix_uuid.store(prefix_uuid, std::memory_order_relaxed);
+            victim->m_page_num.store(page_num, std::memory_order_relaxed);
+            victim->m_mutation_id.store(mutation_id, std::memory_order_relaxed);
+            std::memcpy(getData(victim), buffer, m_page_size);
+            victim->m_seq.store(seq + 1, std::memory_order_release);
+            victim->m_writer.store(0, std::memory_order_release);
+            return;
+        }
+    }
+
+}
@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <cstddef>
+#include "config.hpp"
+
+namespace db0
+
+{
+
+    /**
+     * Cross-process cache of finalized data pages, backed by a named POSIX shared memory segment (/dev/shm)
+     * Pages are keyed by (prefix UUID, page number, mutation ID), since a page's contents
+     * in a finalized mutation never change, the cache does not require any invalidation
+     * The segment is organized as a set-associative table of fixed-size slots, each slot protected by a seqlock
+     * (readers never block and simply report a miss on contention, writers skip slots being written)
+     * Slots (and the segment header) locked by a process which no longer exists are recovered by other processes
+     * The segment is removed when the last attached process detaches
+     * Pages can be mapped read-only without copying (tryPin), a pinned slot is not overwritten until released
+     * by all processes which pinned it (pins of processes which no longer exist are ignored)
+     * NOTE: all processes attaching the same segment name must use the same page size
+     * NOTE: instances must be owned by std::shared_ptr to allow pinning
+    */
+    class SharedPageCache: public std::enable_shared_from_this<SharedPageCache>
+    {
+    public:
+        // number of slots per set
+        static constexpr unsigned int WAYS = 4;
+        // number of attached processes tracked for the segment's removal
+        static constexpr unsigned int MAX_ATTACHED = 256;
+
+        /**
+         * Attach (or create) the shared memory segment
+         * @param name the segment name (e.g. "/db0-cache")
+         * @param capacity the segment capacity in bytes (only applied when the segment is created,
+         * must not exceed the available shared memory)
+        */
+        SharedPageCache(const std::string &name, std::size_t capacity, std::size_t page_size);
+        ~SharedPageCache();
+
+        /**
+         * Copy the page contents into the buffer if cached
+         * @return false on cache miss
+        */
+        bool tryGet(std::uint64_t prefix_uuid, std::uint64_t page_num, StateNumType mutation_id, void *buffer) const;
+
+        /**
+         * Map the cached page read-only, the slot is pinned until the returned pointer is released
+         * @return nullptr on cache miss or if unable to pin (e.g. slot being written, untracked process)
+        */
+        std::shared_ptr<const std::byte> tryPin(std::uint64_t prefix_uuid, std::uint64_t page_num,
+            StateNumType mutation_id);
+
+        // Publish the page contents (best effort, skipped if already cached or slots are contended)
+        void put(std::uint64_t prefix_uuid, std::uint64_t page_num, StateNumType mutation_id, const void *buffer);
+
+        std::size_t getPageSize() const {
+            return m_page_size;
+        }
+
+        std::size_t getSlotCount() const {
+            return m_slot_count;
+        }
+
+        /**
+         * Detach from the segment (removed if this was the last attached process)
+         * pages still pinned by this process remain mapped until the instance is destroyed but are no longer protected
+        */
+        void close();
+
+        // Number of slots pinned by this process
+        std::size_t getPinnedCount() const;
+
+        // Remove the named segment (the memory is released once detached by all processes)
+        static void unlink(const std::string &name);
+
+        // Check if the named segment exists
+        static bool exists(const std::string &name);
+
+        // The segment name shared by processes of the current user for a specific page size
+        static std::string getDefaultName(std::size_t page_size);
+
+    private:
+        struct Header;
+        struct Slot;
+
+        const std::string m_name;
+        const std::size_t m_page_size;
+        std::size_t m_slot_count = 0;
+        std::size_t m_size = 0;
+        void *m_segment = nullptr;
+        // the same segment mapped read-only (for pinned pages)
+        void *m_ro_segment = nullptr;
+        Header *m_header = nullptr;
+        Slot *m_slots = nullptr;
+        std::byte *m_data = nullptr;
+        const std::byte *m_ro_data = nullptr;
+        // process-local victim selection counter
+        std::atomic<unsigned int> m_next_victim = 0;
+        // the attaching process and its entry in the header (-1 if not tracked)
+        int m_pid = 0;
+        int m_attached_index = -1;
+        mutable std::mutex m_pin_mutex;
+        // pin counts of this process by slot index
+        std::unordered_map<std::size_t, std::uint32_t> m_pin_counts;
+
+        Slot *getSet(std::uint64_t prefix_uuid, std::uint64_t page_num) const;
+        std::byte *getData(const Slot *) const;
+
+        // Check if the slot is pinned by any existing process
+        bool isPinned(const Slot *) const;
+        // Take over the slot for writing (fails if being written by another process or pinned)
+        bool tryAcquire(Slot *) const;
+        void unpin(std::size_t slot_index);
+
+        // Initialize the header or wait for it to be initialized by another process
+        void initHeader();
+        void attach();
+        // @return true if this was the last attached process
+        bool detach();
+    };
+
+}
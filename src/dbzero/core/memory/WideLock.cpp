@@ -50,6 +50,9 @@ namespace db0
         return _tryFlush(flush_method);
     }
 
+    void WideLock::prepareFlush(FlushMethod) {
+    }
+    
     void WideLock::flush() {
         _tryFlush(FlushMethod::full);
     }
@@ -28,6 +28,8 @@ namespace db0
         
         bool tryFlush(FlushMethod) override;
         void flush() override;
+        // NOTE: wide locks compute page-wise diffs while flushing
+        void prepareFlush(FlushMethod) override;
         
         // Flush the residual part only of the wide lock
         void flushResidual();
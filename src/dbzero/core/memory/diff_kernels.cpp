@@ -0,0 +1,293 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#include "diff_kernels.hpp"
+#include <atomic>
+#include <cassert>
+#include <dbzero/core/exception/Exceptions.hpp>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #include <immintrin.h>
+    // AVX2 / AVX-512 variants are compiled with function-level target attributes
+    // and selected at runtime, the baseline build flags remain unchanged
+    #define DB0_DIFF_X86_DISPATCH
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+    #define DB0_DIFF_NEON
+#endif
+
+namespace db0
+
+{
+
+    namespace
+    {
+
+        inline unsigned ctz32(std::uint32_t value)
+        {
+#if defined(_MSC_VER)
+            unsigned long index;
+            _BitScanForward(&index, value);
+            return index;
+#else
+            return __builtin_ctz(value);
+#endif
+        }
+
+        inline unsigned ctz64(std::uint64_t value)
+        {
+#if defined(_MSC_VER)
+            unsigned long index;
+            _BitScanForward64(&index, value);
+            return index;
+#else
+            return __builtin_ctzll(value);
+#endif
+        }
+
+        // Scalar implementations (also used to process the tails of the vectorized ones)
+        template <bool Equal>
+        std::size_t scalarFind(const std::uint8_t *p1, const std::uint8_t *p2, std::size_t size)
+        {
+            for (std::size_t i = 0; i < size; ++i) {
+                if ((p1[i] == p2[i]) == Equal) {
+                    return i;
+                }
+            }
+            return size;
+        }
+
+        template <bool Zero>
+        std::size_t scalarFindZero(const std::uint8_t *p, std::size_t size)
+        {
+            for (std::size_t i = 0; i < size; ++i) {
+                if ((p[i] == 0) == Zero) {
+                    return i;
+                }
+            }
+            return size;
+        }
+
+        const DiffKernels scalar_kernels = {
+            SIMD_Level::SCALAR, scalarFind<true>, scalarFind<false>, scalarFindZero<true>, scalarFindZero<false>
+        };
+
+#if defined(DB0_DIFF_COPY_SSE2)
+        // @param p2 the second buffer or nullptr to compare with zeros
+        template <bool Equal>
+        std::size_t sse2Find(const std::uint8_t *p1, const std::uint8_t *p2, std::size_t size)
+        {
+            const __m128i zero = _mm_setzero_si128();
+            std::size_t i = 0;
+            for (; i + 16 <= size; i += 16) {
+                auto a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p1 + i));
+                auto b = p2 ? _mm_loadu_si128(reinterpret_cast<const __m128i*>(p2 + i)) : zero;
+                std::uint32_t mask = _mm_movemask_epi8(_mm_cmpeq_epi8(a, b));
+                if (!Equal) {
+                    mask ^= 0xFFFFu;
+                }
+                if (mask) {
+                    return i + ctz32(mask);
+                }
+            }
+            if (p2) {
+                return i + scalarFind<Equal>(p1 + i, p2 + i, size - i);
+            }
+            return i + scalarFindZero<Equal>(p1 + i, size - i);
+        }
+
+        const DiffKernels sse2_kernels = {
+            SIMD_Level::SSE2,
+            sse2Find<true>,
+            sse2Find<false>,
+            [](const std::uint8_t *p, std::size_t size) { return sse2Find<true>(p, nullptr, size); },
+            [](const std::uint8_t *p, std::size_t size) { return sse2Find<false>(p, nullptr, size); }
+        };
+#endif
+
+#if defined(DB0_DIFF_X86_DISPATCH)
+        template <bool Equal>
+        __attribute__((target("avx2")))
+        std::size_t avx2Find(const std::uint8_t *p1, const std::uint8_t *p2, std::size_t size)
+        {
+            const __m256i zero = _mm256_setzero_si256();
+            std::size_t i = 0;
+            for (; i + 32 <= size; i += 32) {
+                auto a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p1 + i));
+                auto b = p2 ? _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p2 + i)) : zero;
+                std::uint32_t mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b));
+                if (!Equal) {
+                    mask = ~mask;
+                }
+                if (mask) {
+                    return i + ctz32(mask);
+                }
+            }
+            return i + sse2Find<Equal>(p1 + i, p2 ? p2 + i : nullptr, size - i);
+        }
+
+        __attribute__((target("avx2"))) std::size_t avx2FindEqual(const std::uint8_t *p1, const std::uint8_t *p2, std::size_t size) {
+            return avx2Find<true>(p1, p2, size);
+        }
+
+        __attribute__((target("avx2"))) std::size_t avx2FindDiff(const std::uint8_t *p1, const std::uint8_t *p2, std::size_t size) {
+            return avx2Find<false>(p1, p2, size);
+        }
+
+        __attribute__((target("avx2"))) std::size_t avx2FindZero(const std::uint8_t *p, std::size_t size) {
+            return avx2Find<true>(p, nullptr, size);
+        }
+
+        __attribute__((target("avx2"))) std::size_t avx2FindNonZero(const std::uint8_t *p, std::size_t size) {
+            return avx2Find<false>(p, nullptr, size);
+        }
+
+        const DiffKernels avx2_kernels = {
+            SIMD_Level::AVX2, avx2FindEqual, avx2FindDiff, avx2FindZero, avx2FindNonZero
+        };
+
+        template <bool Equal>
+        __attribute__((target("avx512f,avx512bw")))
+        std::size_t avx512Find(const std::uint8_t *p1, const std::uint8_t *p2, std::size_t size)
+        {
+            const __m512i zero = _mm512_setzero_si512();
+            std::size_t i = 0;
+            for (; i + 64 <= size; i += 64) {
+                auto a = _mm512_loadu_si512(reinterpret_cast<const void*>(p1 + i));
+                auto b = p2 ? _mm512_loadu_si512(reinterpret_cast<const void*>(p2 + i)) : zero;
+                std::uint64_t mask = Equal ? _mm512_cmpeq_epi8_mask(a, b) : _mm512_cmpneq_epi8_mask(a, b);
+                if (mask) {
+                    return i + ctz64(mask);
+                }
+            }
+            return i + sse2Find<Equal>(p1 + i, p2 ? p2 + i : nullptr, size - i);
+        }
+
+        __attribute__((target("avx512f,avx512bw"))) std::size_t avx512FindEqual(const std::uint8_t *p1, const std::uint8_t *p2, std::size_t size) {
+            return avx512Find<true>(p1, p2, size);
+        }
+
+        __attribute__((target("avx512f,avx512bw"))) std::size_t avx512FindDiff(const std::uint8_t *p1, const std::uint8_t *p2, std::size_t size) {
+            return avx512Find<false>(p1, p2, size);
+        }
+
+        __attribute__((target("avx512f,avx512bw"))) std::size_t avx512FindZero(const std::uint8_t *p, std::size_t size) {
+            return avx512Find<true>(p, nullptr, size);
+        }
+
+        __attribute__((target("avx512f,avx512bw"))) std::size_t avx512FindNonZero(const std::uint8_t *p, std::size_t size) {
+            return avx512Find<false>(p, nullptr, size);
+        }
+
+        const DiffKernels avx512_kernels = {
+            SIMD_Level::AVX512, avx512FindEqual, avx512FindDiff, avx512FindZero, avx512FindNonZero
+        };
+#endif
+
+#if defined(DB0_DIFF_NEON)
+        template <bool Equal>
+        std::size_t neonFind(const std::uint8_t *p1, const std::uint8_t *p2, std::size_t size)
+        {
+            const uint8x16_t zero = vdupq_n_u8(0);
+            std::size_t i = 0;
+            for (; i + 16 <= size; i += 16) {
+                auto a = vld1q_u8(p1 + i);
+                auto b = p2 ? vld1q_u8(p2 + i) : zero;
+                auto eq = vceqq_u8(a, b);
+                // narrow to 4 bits per byte (there's no movemask on NEON)
+                std::uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+                if (!Equal) {
+                    mask = ~mask;
+                }
+                if (mask) {
+                    return i + (ctz64(mask) >> 2);
+                }
+            }
+            if (p2) {
+                return i + scalarFind<Equal>(p1 + i, p2 + i, size - i);
+            }
+            return i + scalarFindZero<Equal>(p1 + i, size - i);
+        }
+
+        const DiffKernels neon_kernels = {
+            SIMD_Level::NEON,
+            neonFind<true>,
+            neonFind<false>,
+            [](const std::uint8_t *p, std::size_t size) { return neonFind<true>(p, nullptr, size); },
+            [](const std::uint8_t *p, std::size_t size) { return neonFind<false>(p, nullptr, size); }
+        };
+#endif
+
+        const DiffKernels *findKernels(SIMD_Level level)
+        {
+            switch (level) {
+                case SIMD_Level::SCALAR:
+                    return &scalar_kernels;
+#if defined(DB0_DIFF_COPY_SSE2)
+                case SIMD_Level::SSE2:
+                    return &sse2_kernels;
+#endif
+#if defined(DB0_DIFF_X86_DISPATCH)
+                case SIMD_Level::AVX2:
+                    __builtin_cpu_init();
+                    return __builtin_cpu_supports("avx2") ? &avx2_kernels : nullptr;
+                case SIMD_Level::AVX512:
+                    __builtin_cpu_init();
+                    return (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) ? &avx512_kernels : nullptr;
+#endif
+#if defined(DB0_DIFF_NEON)
+                case SIMD_Level::NEON:
+                    return &neon_kernels;
+#endif
+                default:
+                    return nullptr;
+            }
+        }
+
+        std::atomic<const DiffKernels *> &activeKernels()
+        {
+            static std::atomic<const DiffKernels *> active(&getDiffKernels(getBestSIMD_Level()));
+            return active;
+        }
+
+    }
+
+    bool isSupported(SIMD_Level level) {
+        return findKernels(level) != nullptr;
+    }
+
+    SIMD_Level getBestSIMD_Level()
+    {
+        for (auto level: { SIMD_Level::AVX512, SIMD_Level::AVX2, SIMD_Level::NEON, SIMD_Level::SSE2 }) {
+            if (isSupported(level)) {
+                return level;
+            }
+        }
+        return SIMD_Level::SCALAR;
+    }
+
+    const DiffKernels &getDiffKernels() {
+        return *activeKernels().load(std::memory_order_relaxed);
+    }
+
+    const DiffKernels &getDiffKernels(SIMD_Level level)
+    {
+        auto result = findKernels(level);
+        if (!result) {
+            THROWF(db0::InternalException) << "SIMD level not supported: " << static_cast<int>(level);
+        }
+        return *result;
+    }
+
+    bool setDiffKernels(SIMD_Level level)
+    {
+        auto kernels = findKernels(level);
+        if (!kernels) {
+            return false;
+        }
+        activeKernels().store(kernels, std::memory_order_relaxed);
+        return true;
+    }
+
+}
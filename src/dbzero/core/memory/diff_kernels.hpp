@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <dbzero/core/compiler_attributes.hpp>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define DB0_DIFF_COPY_SSE2
+#elif defined(__ARM_NEON) || defined(__aarch64__)
+    #include <arm_neon.h>
+    #define DB0_DIFF_COPY_NEON
+#endif
+
+namespace db0
+
+{
+
+    enum class SIMD_Level: std::uint8_t
+    {
+        SCALAR = 0,
+        SSE2 = 1,
+        AVX2 = 2,
+        AVX512 = 3,
+        NEON = 4
+    };
+
+    // Byte-scanning primitives used by getDiffs
+    // each function returns the index of the first matching byte or "size" if not found
+    struct DiffKernels
+    {
+        SIMD_Level m_level;
+        // first index where the 2 buffers are equal
+        std::size_t (*findEqual)(const std::uint8_t *, const std::uint8_t *, std::size_t size);
+        // first index where the 2 buffers differ
+        std::size_t (*findDiff)(const std::uint8_t *, const std::uint8_t *, std::size_t size);
+        // first zero byte
+        std::size_t (*findZero)(const std::uint8_t *, std::size_t size);
+        // first non-zero byte
+        std::size_t (*findNonZero)(const std::uint8_t *, std::size_t size);
+    };
+
+    // Check if a specific implementation is available on the current CPU
+    bool isSupported(SIMD_Level);
+
+    // The best implementation available on the current CPU
+    SIMD_Level getBestSIMD_Level();
+
+    // Retrieve the currently active kernels (by default the best available)
+    const DiffKernels &getDiffKernels();
+
+    // Retrieve kernels of a specific implementation (must be supported)
+    const DiffKernels &getDiffKernels(SIMD_Level);
+
+    // Override the active implementation (e.g. for testing / benchmarking)
+    // @return false if the level is not supported on the current CPU
+    bool setDiffKernels(SIMD_Level);
+
+    // Copy used when applying diffs, optimized for the short runs typical for diff areas
+    DB0_FORCE_INLINE void diffCopy(std::byte *dst, const std::byte *src, std::size_t size)
+    {
+#if defined(DB0_DIFF_COPY_SSE2)
+        if (size >= 16 && size <= 64) {
+            // overlapping unaligned 16-byte moves
+            auto last = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + size - 16));
+            for (std::size_t i = 0; i + 16 < size; i += 16) {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + size - 16), last);
+            return;
+        }
+#elif defined(DB0_DIFF_COPY_NEON)
+        if (size >= 16 && size <= 64) {
+            auto last = vld1q_u8(reinterpret_cast<const std::uint8_t*>(src + size - 16));
+            for (std::size_t i = 0; i + 16 < size; i += 16) {
+                vst1q_u8(reinterpret_cast<std::uint8_t*>(dst + i), vld1q_u8(reinterpret_cast<const std::uint8_t*>(src + i)));
+            }
+            vst1q_u8(reinterpret_cast<std::uint8_t*>(dst + size - 16), last);
+            return;
+        }
+#endif
+        if (size >= 8 && size < 16) {
+            std::uint64_t head, tail;
+            std::memcpy(&head, src, 8);
+            std::memcpy(&tail, src + size - 8, 8);
+            std::memcpy(dst, &head, 8);
+            std::memcpy(dst + size - 8, &tail, 8);
+            return;
+        }
+        if (size < 8) {
+            for (std::size_t i = 0; i < size; ++i) {
+                dst[i] = src[i];
+            }
+            return;
+        }
+        std::memcpy(dst, src, size);
+    }
+
+}
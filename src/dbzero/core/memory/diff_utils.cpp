@@ -2,6 +2,7 @@
 // Copyright (c) 2025 DBZero Software sp. z o.o.
 
 #include "diff_utils.hpp"
+#include "diff_kernels.hpp"
 #include <algorithm>
 #include <cassert>
 #include <cstdint>
@@ -161,7 +162,8 @@ namespace db0
     {
         if (m_diff_ranges) {
             assert(index < m_size);
-            return (*this)[m_offset + index].second - (*this)[m_offset + index].first;
+            auto range = (*this)[index];
+            return range.second - range.first;
         }
         return 0;
     }
@@ -188,6 +190,7 @@ namespace db0
             max_diff = (size * 3) >> 2;
         }
         result.clear();
+        const auto &kernels = getDiffKernels();
         const std::uint8_t *it_1 = static_cast<const std::uint8_t *>(buf_1), *it_2 = static_cast<const std::uint8_t *>(buf_2);
         auto it_base = it_1;
         auto end = it_1 + size;
@@ -223,12 +226,15 @@ namespace db0
                     }
                     continue;
                 }
-                if (*it_1 == *it_2) {
+                // scan for the first identical byte up to the next forced-diff range
+                auto limit = (diff_start && diff_start < end) ? diff_start : end;
+                auto len = kernels.findEqual(it_1, it_2, limit - it_1);
+                it_1 += len;
+                it_2 += len;
+                diff_len += len;
+                if (it_1 != limit) {
                     break;
                 }
-                ++it_1;
-                ++it_2;
-                ++diff_len;                
             }
             
             // account for the administrative space overhead (approximate)
@@ -243,13 +249,11 @@ namespace db0
             if (it_1 == end) {
                 break;
             }
-            std::uint16_t sim_len = 0;
-            for (; it_1 != end && *it_1 == *it_2; ++it_1, ++it_2) {
-                if (it_1 == diff_start) {
-                    break;
-                }
-                ++sim_len;
-            }
+            // identical area ends at the first differing byte or the next forced-diff range
+            auto limit = (diff_start && diff_start < end) ? diff_start : end;
+            std::uint16_t sim_len = kernels.findDiff(it_1, it_2, limit - it_1);
+            it_1 += sim_len;
+            it_2 += sim_len;
             // do not include the trailing similarity area
             if (it_1 == end) {
                 break;
@@ -278,6 +282,7 @@ namespace db0
             max_diff = (size * 3) >> 2;
         }
         result.clear();
+        const auto &kernels = getDiffKernels();
         const std::uint8_t *it_base = static_cast<const std::uint8_t *>(buf);
         auto it = it_base;
         auto end = it + size;
@@ -313,11 +318,13 @@ namespace db0
                     }
                     continue;
                 }
-                if (!*it) {
+                auto limit = (diff_start && diff_start < end) ? diff_start : end;
+                auto len = kernels.findZero(it, limit - it);
+                it += len;
+                diff_len += len;
+                if (it != limit) {
                     break;
                 }
-                ++diff_len;
-                ++it;
             }
             // account for the administrative space overhead (approximate)
             diff_total += diff_len + sizeof(std::uint16_t);
@@ -330,13 +337,9 @@ namespace db0
             if (it == end) {
                 break;
             }
-            std::uint16_t sim_len = 0;
-            for (; it != end && !*it; ++it) {
-                if (it == diff_start) {
-                    break;
-                }
-                ++sim_len;
-            }
+            auto limit = (diff_start && diff_start < end) ? diff_start : end;
+            std::uint16_t sim_len = kernels.findNonZero(it, limit - it);
+            it += sim_len;
             // do not include the trailing similarity area
             if (it == end) {
                 break;
@@ -379,7 +382,7 @@ namespace db0
                 if (dp_result + diff_size > dp_end) {
                     THROWF(db0::IOException) << "applyDiffs: diff application exceeds buffer size";
                 }
-                std::memcpy(dp_result, dp_in, diff_size);
+                diffCopy(dp_result, dp_in, diff_size);
                 dp_result += diff_size;
                 dp_in += diff_size;
             }
@@ -10,6 +10,7 @@
 #include <dbzero/core/dram/DRAM_Allocator.hpp>
 #include <dbzero/core/memory/AccessOptions.hpp>
 #include <dbzero/core/utils/ProcessTimer.hpp>
+#include <dbzero/core/utils/Tracer.hpp>
 #include <dbzero/core/memory/utils.hpp>
 #include "copy_prefix.hpp"
 
@@ -18,15 +19,43 @@ namespace db0
 {
 
     o_prefix_config::o_prefix_config(std::uint32_t block_size, std::uint32_t page_size,
-        std::uint32_t dram_page_size, std::uint32_t page_io_step_size)
+        std::uint32_t dram_page_size, std::uint32_t page_io_step_size, PageCodecType page_codec)
         : m_block_size(block_size)
         , m_page_size(page_size)
         , m_dram_page_size(dram_page_size)
         , m_page_io_step_size(page_io_step_size)
+        , m_page_codec(static_cast<std::uint64_t>(page_codec))
     {
         std::memset(m_reserved.data(), 0, sizeof(m_reserved));
     }
     
+    // Location of a diff block to be applied on a specific data page
+    struct DiffBlockRef
+    {
+        std::byte *m_dp_buf;
+        std::uint64_t m_page_num;
+        StateNumType m_state_num;
+        std::uint64_t m_storage_page_num;
+    };
+    
+    // Location of a compressed full-DP (stored as a variable-length block)
+    struct CompressedPageRef
+    {
+        std::byte *m_dp_buf;
+        std::uint64_t m_page_num;
+        StateNumType m_state_num;
+        std::uint64_t m_storage_page_num;
+    };
+    
+    const PageCodec *tryGetPageCodec(const o_prefix_config &config)
+    {
+        if (!config.m_page_codec) {
+            return nullptr;
+        }
+        // NOTE: throws if the codec is not available in this build
+        return &getPageCodec(static_cast<PageCodecType>(config.m_page_codec));
+    }
+    
     DRAM_Pair tryGetDRAMPair(DRAM_IOStream *dram_io_ptr)
     {
         if (!dram_io_ptr) {
@@ -38,7 +67,8 @@ namespace db0
     BDevStorage::BDevStorage(const std::string &file_name, AccessType access_type, LockFlags lock_flags,
         std::optional<std::size_t> meta_io_step_size, StorageFlags flags)
         : BaseStorage(access_type, flags)
-        , m_file(file_name, access_type, lock_flags)
+        , m_file(file_name, access_type, lock_flags,
+            flags[StorageOptions::POSITIONAL_IO] ? FileIOMode::POSITIONAL : FileIOMode::BUFFERED)
         , m_config(readConfig())
         , m_dram_changelog_io(getChangeLogIOStream<DRAM_ChangeLogStreamT>(
             m_config.m_dram_changelog_io_offset, access_type)
@@ -49,8 +79,10 @@ namespace db0
         , m_meta_io(init(getMetaIOStream(
             m_config.m_meta_io_offset, meta_io_step_size.value_or(DEFAULT_META_IO_STEP_SIZE), access_type), flags)
         )
+        , m_dram_checkpoint_io(tryGetDRAMCheckpointIOStream(m_config.m_dram_checkpoint_io_offset, access_type))
         , m_dram_io(init(getDRAMIOStream(
-            m_config.m_dram_io_offset, m_config.m_dram_page_size, access_type), m_dram_changelog_io, flags)
+            m_config.m_dram_io_offset, m_config.m_dram_page_size, access_type), m_dram_changelog_io,
+            m_dram_checkpoint_io.get(), flags)
         )
         , m_sparse_pair(m_dram_io.getDRAMPair(), access_type, flags)
         , m_sparse_index(m_sparse_pair.getSparseIndex())
@@ -68,6 +100,7 @@ namespace db0
         )
         , m_ext_space(tryGetDRAMPair(m_ext_dram_io.get()), access_type)
         , m_page_io(getPage_IO(getNextStoragePageNum(), m_config.m_page_io_step_size))
+        , m_page_codec(tryGetPageCodec(m_config))
 #ifndef NDEBUG
         , m_data_mirror(m_config.m_page_size)
 #endif
@@ -92,16 +125,35 @@ namespace db0
                     << " exceeds DP changelog state number " << dp_state_num;
             }
         }
+        
+        if (m_access_type == AccessType::READ_WRITE && m_flags.test(StorageOptions::PIPELINED_COMMIT)) {
+            m_commit_pipeline = std::make_unique<CommitPipeline>(getMaxStateNum());
+        }
     }
     
     BDevStorage::~BDevStorage()
     {
+        // NOTE: the flusher thread must complete before any of the streams is destroyed
+        m_commit_pipeline = nullptr;
     }
     
-    DRAM_IOStream BDevStorage::init(DRAM_IOStream &&dram_io, DRAM_ChangeLogStreamT &dram_change_log, StorageFlags flags)
+    DRAM_IOStream BDevStorage::init(DRAM_IOStream &&dram_io, DRAM_ChangeLogStreamT &dram_change_log,
+        DRAM_CheckpointIOStream *checkpoint_io, StorageFlags flags)
     {
         if (!flags[StorageOptions::NO_LOAD]) {
-            dram_io.load(dram_change_log);
+            bool read_only = dram_io.getAccessType() == AccessType::READ_ONLY;
+            DRAM_Checkpoint checkpoint;
+            // NOTE: in read/write mode only the checkpoint written on close can be used, otherwise
+            // chunks of an abruptly terminated transaction (to be trashed by the full load) might be left behind
+            if (checkpoint_io && checkpoint_io->tryRead(checkpoint) && (checkpoint.m_clean || read_only)) {
+                dram_io.load(dram_change_log, checkpoint);
+            } else {
+                dram_io.load(dram_change_log);
+            }
+            if (checkpoint_io && !read_only) {
+                // no longer valid for the writer once modifications begin
+                checkpoint_io->setClean(false);
+            }
         }        
         return std::move(dram_io);
     }
@@ -148,11 +200,19 @@ namespace db0
     }
     
     void BDevStorage::create(const std::string &file_name, std::optional<std::size_t> page_size,
-        std::uint32_t dram_page_size_hint, std::optional<std::size_t> step_size_hint)
+        std::uint32_t dram_page_size_hint, std::optional<std::size_t> step_size_hint, PageCodecType page_codec)
     {
         if (!page_size) {
             page_size = DEFAULT_PAGE_SIZE;
         }
+        if (page_codec != PageCodecType::NONE) {
+            // validate the codec is available
+            getPageCodec(page_codec);
+            // compressed blocks are sized with 16-bit integers
+            if (*page_size > MAX_COMPRESSED_PAGE_SIZE) {
+                THROWF(db0::InputException) << "Page compression is not supported for page size: " << *page_size;
+            }
+        }
         
         std::vector<char> buffer(CONFIG_BLOCK_SIZE);
         // calculate block size to be page aligned and sufficient to fit a single sparse index node
@@ -166,7 +226,7 @@ namespace db0
 
         // create a new config using placement new
         auto config = new (buffer.data()) o_prefix_config(
-            block_size, *page_size, dram_page_size, getPageIOStepSize(block_size, step_size_hint)
+            block_size, *page_size, dram_page_size, getPageIOStepSize(block_size, step_size_hint), page_codec
         );
         
         std::uint64_t offset = CONFIG_BLOCK_SIZE;
@@ -182,6 +242,7 @@ namespace db0
         config->m_dram_changelog_io_offset = next_block_offset();
         config->m_dp_changelog_io_offset = next_block_offset();
         config->m_meta_io_offset = next_block_offset();
+        config->m_dram_checkpoint_io_offset = next_block_offset();
 
         // initialize ext streams only when needed
         bool has_ext_dram_io = config->m_page_io_step_size > 1;
@@ -282,7 +343,8 @@ namespace db0
     
     void BDevStorage::_read(std::uint64_t address, StateNumType state_num, std::size_t size, void *buffer,
         FlagSet<AccessOptions> flags, unsigned int *chain_len) const
-    {     
+    {
+        DB0_TRACE("BDevStorage::read", size);
         assert(state_num > 0 && "BDevStorage::read: state number must be > 0");
         assert((address % m_config.m_page_size == 0) && "BDevStorage::read: address must be page-aligned");
         assert((size % m_config.m_page_size == 0) && "BDevStorage::read: size must be page-aligned");
@@ -299,7 +361,11 @@ namespace db0
         }
         
         std::byte *read_buf = reinterpret_cast<std::byte *>(buffer);
-        // lookup sparse index and read physical pages
+        // Resolve locations of all full-DPs and diff-DPs first, then fetch them as a single batch
+        // NOTE: full-DPs are read directly into the destination buffer
+        std::vector<std::pair<std::uint64_t, void *> > page_reads;
+        std::vector<CompressedPageRef> compressed_pages;
+        std::vector<DiffBlockRef> diff_blocks;
         for (auto page_num = begin_page; page_num != end_page; ++page_num, read_buf += m_config.m_page_size) {
             // query sparse index + diff index
             SparseIndexQuery query(m_sparse_index, m_diff_index, page_num, state_num);
@@ -313,33 +379,73 @@ namespace db0
             }
             
             // query.first yields the full-DP (if it exists)            
-            std::uint64_t page_io_id = query.first();
+            StateNumType first_state_num;
+            std::uint64_t page_io_id = query.first(first_state_num);
             if (page_io_id) {
                 if (!!m_ext_space) {
                     // convert relative page number back to absolute
                     page_io_id = m_ext_space.getAbsolute(page_io_id);
                 }
-                // read full DP
-                m_page_io.read(page_io_id, read_buf);
+                if (m_page_codec) {
+                    // the storage page is fetched along with the diff-DPs and decoded afterwards
+                    compressed_pages.push_back({ read_buf, page_num, first_state_num, page_io_id });
+                } else {
+                    page_reads.emplace_back(page_io_id, read_buf);
+                }
             } else {
                 // requesting a diff-DP only encoded page, use zero buffer as a base
                 std::memset(read_buf, 0, m_config.m_page_size);
             }
             
-            // apply changes from diff-DPs
+            // collect diff-DPs to be applied (in order) on top of the full-DP
             std::uint32_t diff_state_num;
             while (query.next(diff_state_num, page_io_id)) {
                 if (!!m_ext_space) {
                     // convert relative page number back to absolute
                     page_io_id = m_ext_space.getAbsolute(page_io_id);
                 }
-                // apply all diff-updates on top of the full-DP
-                m_page_io.applyFrom(page_io_id, read_buf, { page_num, diff_state_num });
+                diff_blocks.push_back({ read_buf, page_num, diff_state_num, page_io_id });
                 // collect chain-len statistics
                 if (chain_len) {
                     ++(*chain_len);
                 }
-            }            
+            }
+        }
+        
+        // NOTE: a single diff-DP may hold diff blocks (or compressed full-DPs) of multiple pages, 
+        // fetch each one only once
+        std::unordered_map<std::uint64_t, std::size_t> diff_page_index;
+        for (auto &page: compressed_pages) {
+            diff_page_index.emplace(page.m_storage_page_num, diff_page_index.size());
+        }
+        for (auto &block: diff_blocks) {
+            diff_page_index.emplace(block.m_storage_page_num, diff_page_index.size());
+        }
+        std::vector<std::byte> diff_pages(diff_page_index.size() * m_config.m_page_size);
+        for (auto &item: diff_page_index) {
+            auto page_data = diff_pages.data() + item.second * m_config.m_page_size;
+            // NOTE: the page written in the current transaction may not have been flushed yet
+            if (!m_page_io.tryReadPending(item.first, page_data)) {
+                page_reads.emplace_back(item.first, page_data);
+            }
+        }
+        
+        m_page_io.readBatch(page_reads);
+        
+        std::vector<std::byte> work_buf;
+        if (!compressed_pages.empty()) {
+            for (auto &page: compressed_pages) {
+                auto page_data = diff_pages.data() + diff_page_index[page.m_storage_page_num] * m_config.m_page_size;
+                m_page_io.readCompressed(page.m_storage_page_num, page_data, page.m_dp_buf,
+                    { page.m_page_num, page.m_state_num }, work_buf);
+            }
+        }
+        
+        // apply all diff-updates on top of the full-DPs
+        for (auto &block: diff_blocks) {
+            auto page_data = diff_pages.data() + diff_page_index[block.m_storage_page_num] * m_config.m_page_size;
+            m_page_io.applyFrom(block.m_storage_page_num, page_data, block.m_dp_buf,
+                { block.m_page_num, block.m_state_num }, work_buf);
         }
         
 #ifndef NDEBUG
@@ -380,12 +486,23 @@ namespace db0
             if (item && item.m_state_num == state_num) {
                 // page already added in current transaction / update in the stream
                 // this may happen due to cache overflow and later modification of the same page                
+                if (m_page_codec) {
+                    // compressed blocks are variable-length, append a new one and re-point the index
+                    writeCompressed(page_num, state_num, write_buf);
+                    continue;
+                }
                 auto page_io_id = item.m_storage_page_num;
                 if (!!m_ext_space) {
                     // convert relative page number back to absolute
                     page_io_id = m_ext_space.getAbsolute(page_io_id);
                 }
                 m_page_io.write(page_io_id, write_buf);
+            } else if (m_page_codec) {
+                writeCompressed(page_num, state_num, write_buf);
+#ifndef NDEBUG                
+                m_page_io_raw_bytes += m_config.m_page_size;
+                checkPoisonedOp(Settings::__write_poison);
+#endif
             } else {
                 // append as new page
                 bool is_first_page;
@@ -404,6 +521,19 @@ namespace db0
         }
     }
     
+    void BDevStorage::writeCompressed(std::uint64_t page_num, StateNumType state_num, const std::byte *buffer)
+    {
+        assert(m_page_codec);
+        bool is_first_page;
+        auto [page_io_id, overflow] = m_page_io.appendCompressed(buffer, { page_num, state_num }, *m_page_codec,
+            &is_first_page);
+        if (!!m_ext_space) {
+            // NOTE: first page (of each step) must be registered with REL_Index if it's maintained
+            page_io_id = m_ext_space.assignRelative(page_io_id, is_first_page);
+        }
+        m_sparse_index.replace({ page_num, state_num, page_io_id }, overflow);
+    }
+    
     bool BDevStorage::tryWriteDiffs(std::uint64_t address, StateNumType state_num, std::size_t size, void *buffer,
         const std::vector<std::uint16_t> &diff_data, unsigned int max_len)
     {
@@ -472,6 +602,12 @@ namespace db0
     
     bool BDevStorage::flush(ProcessTimer *parent_timer)
     {
+        DB0_TRACE("BDevStorage::flush");
+        if (m_commit_pipeline) {
+            // the previous transaction must be finalized before the DRAM-changelog is appended to
+            // NOTE: must wait before locking since the flusher thread also requires the lock
+            m_commit_pipeline->waitDurable();
+        }
         std::unique_lock<std::shared_mutex> lock(m_mutex);
         std::unique_ptr<ProcessTimer> timer;
         if (parent_timer) {
@@ -509,23 +645,78 @@ namespace db0
         m_dp_changelog_io.flush();
         // Flush ext streams (if existing)
         flushExt(state_num);
-        // NOTE: fsync has stronger guarantees than flush in a multi-process environments
-        m_file.fsync();
-        // flush changelog AFTER all updates from all other streams have been flushed        
-        m_dram_changelog_io.flush();
-        // the last fsync finalizes the commit
-        m_file.fsync();
+        if (m_commit_pipeline) {
+            // the transaction is sealed, fsyncs are performed by the flusher thread
+            m_file.flush();
+            m_commit_pipeline->submit(state_num, [this]() { finalizeCommit(); });
+        } else {
+            // NOTE: fsync has stronger guarantees than flush in a multi-process environments
+            m_file.fsync();
+            // flush changelog AFTER all updates from all other streams have been flushed        
+            m_dram_changelog_io.flush();
+            // the last fsync finalizes the commit
+            m_file.fsync();
+        }
         
         // commit to collect future updates correctly        
         m_sparse_pair.commit();
+        // NOTE: with the pipelined commit the checkpoint is only written on close
+        if (++m_dram_checkpoint_commits >= DRAM_CHECKPOINT_INTERVAL && !m_commit_pipeline) {
+            writeDRAMCheckpoint(false);
+        }
         return true;
     }
     
+    void BDevStorage::writeDRAMCheckpoint(bool clean)
+    {
+        if (!m_dram_checkpoint_io) {
+            return;
+        }
+        DRAM_Checkpoint checkpoint;
+        m_dram_io.getCheckpoint(checkpoint);
+        checkpoint.m_clean = clean;
+        m_dram_checkpoint_io->write(checkpoint);
+        m_dram_checkpoint_commits = 0;
+    }
+    
+    void BDevStorage::finalizeCommit()
+    {
+        // NOTE: the fsync is performed unlocked, the writer may proceed with the next transaction
+        m_file.fsync();
+        {
+            // flush changelog AFTER all updates from all other streams have been synced
+            std::unique_lock<std::shared_mutex> lock(m_mutex);
+            m_dram_changelog_io.flush();
+        }
+        // the last fsync finalizes the commit
+        m_file.fsync();
+    }
+    
+    void BDevStorage::waitDurable(std::optional<StateNumType> state_num)
+    {
+        if (m_commit_pipeline) {
+            m_commit_pipeline->waitDurable(state_num);
+        }
+    }
+    
     void BDevStorage::close()
     {    
         if (m_access_type == AccessType::READ_WRITE) {
             flush();
         }
+        if (m_commit_pipeline) {
+            // complete the pending finalization before closing streams
+            m_commit_pipeline->stop();
+        }
+        
+        if (m_access_type == AccessType::READ_WRITE && m_dram_checkpoint_io) {
+            // the clean checkpoint allows the next writer to skip the full DRAM load
+            if (m_dram_checkpoint_commits > 0) {
+                writeDRAMCheckpoint(true);
+            } else {
+                m_dram_checkpoint_io->setClean(true);
+            }
+        }
         
         // Close extension streams
         if (m_ext_dram_io) {
@@ -536,6 +727,9 @@ namespace db0
         
         m_dram_io.close();
         m_dram_changelog_io.close();
+        if (m_dram_checkpoint_io) {
+            m_dram_checkpoint_io->close();
+        }
         m_dp_changelog_io.close(); 
         m_meta_io.close();
         m_file.close();
@@ -554,6 +748,16 @@ namespace db0
         };
     }
     
+    std::unique_ptr<DRAM_CheckpointIOStream> BDevStorage::tryGetDRAMCheckpointIOStream(std::uint64_t first_block_pos,
+        AccessType access_type)
+    {
+        if (!first_block_pos) {
+            return nullptr;
+        }
+        return std::make_unique<DRAM_CheckpointIOStream>(m_file, first_block_pos, m_config.m_block_size,
+            getTailFunction(), access_type);
+    }
+    
     DRAM_IOStream BDevStorage::getDRAMIOStream(std::uint64_t first_block_pos, std::uint32_t dram_page_size, AccessType access_type) {
         return { m_file, first_block_pos, m_config.m_block_size, getTailFunction(), access_type, dram_page_size };
     }
@@ -581,6 +785,9 @@ namespace db0
             assert(m_ext_dram_changelog_io);
             result =  std::max(result, std::max(m_ext_dram_io->tail(), m_ext_dram_changelog_io->tail()));
         }
+        if (m_dram_checkpoint_io) {
+            result = std::max(result, m_dram_checkpoint_io->tail());
+        }
         
         return result;
     }
@@ -613,6 +820,9 @@ namespace db0
                 address = std::max(address, m_ext_dram_io->tail());
                 address = std::max(address, m_ext_dram_changelog_io->tail());
             }
+            if (m_dram_checkpoint_io) {
+                address = std::max(address, m_dram_checkpoint_io->tail());
+            }
 
             // NOTE: initialize with a known block num = 0 (first block of the first step)
             block_num = 0;
@@ -628,6 +838,10 @@ namespace db0
         return m_sparse_pair.getMaxStateNum();
     }
     
+    bool BDevStorage::supportsConcurrentReads() const {
+        return true;
+    }
+    
     std::function<std::uint64_t()> BDevStorage::getTailFunction() const
     {
         return [this]() {
@@ -647,6 +861,9 @@ namespace db0
                 result = std::max(result, m_ext_dram_io->tail());
                 result = std::max(result, m_ext_dram_changelog_io->tail());
             }
+            if (m_dram_checkpoint_io) {
+                result = std::max(result, m_dram_checkpoint_io->tail());
+            }
             return result;
         };
     }
@@ -800,6 +1017,7 @@ namespace db0
         std::unique_lock<std::shared_mutex> lock(m_mutex);
         callback("dram_io_rand_ops", m_dram_io.getRandOpsCount());
         callback("dram_io_size", m_dram_io.getDRAMPrefix().size());
+        callback("dram_io_checkpoint_state", m_dram_io.getCheckpointStateNum());
         auto file_rand_ops = m_file.getRandOps();
         callback("file_rand_read_ops", file_rand_ops.first);
         callback("file_rand_write_ops", file_rand_ops.second);
@@ -812,6 +1030,9 @@ namespace db0
         auto page_io_stats = m_page_io.getStats();
         callback("page_io_total_bytes", page_io_stats.first);
         callback("page_io_diff_bytes", page_io_stats.second);
+        if (m_page_codec) {
+            callback("page_io_compressed_bytes", m_page_io.getCompressedBytes());
+        }
         if (m_ext_dram_io) {
             callback("ext_dram_io_size", m_ext_dram_io->getDRAMPrefix().size());
         }
@@ -820,6 +1041,10 @@ namespace db0
         #endif
     }
     
+    PageCodecType BDevStorage::getPageCodecType() const {
+        return static_cast<PageCodecType>(m_config.m_page_codec);
+    }
+    
     std::pair<std::size_t, std::size_t> BDevStorage::getDiff_IOStats() const 
     {
         std::unique_lock<std::shared_mutex> lock(m_mutex);
@@ -907,6 +1132,10 @@ namespace db0
         if (!out.m_ext_space) {
             THROWF(db0::IOException) << "BDevStorage::copyTo: destination storage must have ext-space initialized";
         }
+        // NOTE: the page stream is copied as-is, therefore the format must match
+        if (out.m_config.m_page_codec != m_config.m_page_codec) {
+            THROWF(db0::IOException) << "BDevStorage::copyTo: destination storage must use the same page codec";
+        }
         
         auto writer = out.m_dram_changelog_io.getStreamWriter();
         auto maybe_max_state_num = copyDRAM_IO(m_dram_io, m_dram_changelog_io, out.m_dram_io, writer);
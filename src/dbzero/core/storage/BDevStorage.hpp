@@ -16,6 +16,7 @@
 #include <dbzero/core/memory/AccessOptions.hpp>
 #include "BaseStorage.hpp"
 #include "DRAM_IOStream.hpp"
+#include "DRAM_CheckpointIOStream.hpp"
 #include "ChangeLogIOStream.hpp"
 #include "MetaIOStream.hpp"
 #include <dbzero/workspace/LockFlags.hpp>
@@ -23,6 +24,8 @@
 #include <shared_mutex>
 #include "ExtSpace.hpp"
 #include "MemBaseStorage.hpp"
+#include "CommitPipeline.hpp"
+#include "PageCodec.hpp"
 
 namespace db0
 
@@ -54,11 +57,16 @@ DB0_PACKED_BEGIN
         std::uint64_t m_ext_dram_io_offset = 0;
         std::uint32_t m_ext_dram_page_size = 0;
         std::uint64_t m_ext_dram_changelog_io_offset = 0;
+        // codec of the full data pages (PageCodecType), 0 = uncompressed
+        // NOTE: the field occupies what used to be the first reserved slot (0-filled in existing files)
+        std::uint64_t m_page_codec = 0;
+        // DRAM-space checkpoint stream (0 = not available, i.e. files created before the checkpoints were introduced)
+        std::uint64_t m_dram_checkpoint_io_offset = 0;
         // reserved for future use (0-filled)
-        std::array<std::uint64_t, 16> m_reserved;
+        std::array<std::uint64_t, 14> m_reserved;
         
         o_prefix_config(std::uint32_t block_size, std::uint32_t page_size, std::uint32_t dram_page_size,
-            std::uint32_t page_io_step_size);
+            std::uint32_t page_io_step_size, PageCodecType = PageCodecType::NONE);
     };
 DB0_PACKED_END
     
@@ -71,6 +79,9 @@ DB0_PACKED_END
     public:
         static constexpr std::uint32_t DEFAULT_PAGE_SIZE = 4096;
         static constexpr std::size_t DEFAULT_META_IO_STEP_SIZE = 16 << 20;
+        static constexpr std::uint32_t MAX_COMPRESSED_PAGE_SIZE = 32u << 10;
+        // number of commits after which the DRAM-space checkpoint is refreshed
+        static constexpr unsigned int DRAM_CHECKPOINT_INTERVAL = 128;
         using DRAM_ChangeLogStreamT = ChangeLogIOStream<DRAM_ChangeLogT>;
         using DP_ChangeLogStreamT = ChangeLogIOStream<DP_ChangeLogT>;
         
@@ -85,9 +96,11 @@ DB0_PACKED_END
         /**
          * Create a new .db0 file
          * @param step_size_hint defines requested Page IO step size in bytes
+         * @param page_codec codec to compress full data pages with (fixed for the lifetime of the file)
         */
         static void create(const std::string &file_name, std::optional<std::size_t> page_size = {},
-            std::uint32_t dram_page_size_hint = (16u << 10) - 256, std::optional<std::size_t> step_size_hint = {});
+            std::uint32_t dram_page_size_hint = (16u << 10) - 256, std::optional<std::size_t> step_size_hint = {},
+            PageCodecType page_codec = PageCodecType::NONE);
         
         void read(std::uint64_t address, StateNumType state_num, std::size_t size, void *buffer,
             FlagSet<AccessOptions> = { AccessOptions::read, AccessOptions::write }) const override;
@@ -113,6 +126,8 @@ DB0_PACKED_END
 
         void endCommit() override;
         
+        void waitDurable(std::optional<StateNumType> state_num = {}) override;
+        
         void close() override;
         
         std::size_t getPageSize() const override;
@@ -120,6 +135,9 @@ DB0_PACKED_END
 
         StateNumType getMaxStateNum() const override;
         
+        // reads are guarded by the shared mutex
+        bool supportsConcurrentReads() const override;
+        
         void getStats(std::function<void(const std::string &, std::uint64_t)>) const override;
 
         /**
@@ -136,6 +154,8 @@ DB0_PACKED_END
         // @return total bytes written / diff bytes written
         std::pair<std::size_t, std::size_t> getDiff_IOStats() const;
         
+        PageCodecType getPageCodecType() const;
+        
         void fetchDP_ChangeLogs(StateNumType begin_state, std::optional<StateNumType> end_state,
             std::function<void(const DP_ChangeLogT &)> f) const override;
         
@@ -147,7 +167,7 @@ DB0_PACKED_END
             return m_meta_io;
         }
         
-        std::string getFileName() const {
+        std::string getFileName() const override {
             return m_file.getName();
         }
 
@@ -176,6 +196,8 @@ DB0_PACKED_END
         DP_ChangeLogStreamT m_dp_changelog_io;
         // meta-stream keeps meta-data about the other streams
         MetaIOStream m_meta_io;
+        // the most recent DRAM-space checkpoint (must be initialized before DRAM_IOStream)
+        std::unique_ptr<DRAM_CheckpointIOStream> m_dram_checkpoint_io;
         // memory-mapped file I/O
         DRAM_IOStream m_dram_io;
         // SparseIndex + DiffIndex (based over the dram_io)
@@ -189,12 +211,19 @@ DB0_PACKED_END
         ExtSpace m_ext_space;
         // the stream for storing & reading full-DPs and diff-encoded DPs
         Diff_IO m_page_io;
+        // codec of the full-DPs (nullptr if stored uncompressed)
+        // compressed full-DPs are stored as variable-length blocks along with the diff-blocks
+        const PageCodec *m_page_codec = nullptr;
 #ifndef NDEBUG
         MemBaseStorage m_data_mirror;
 #endif
         
         bool m_refresh_pending = false;
+        // number of commits since the last DRAM-space checkpoint
+        unsigned int m_dram_checkpoint_commits = 0;
         mutable std::shared_mutex m_mutex;
+        // the flusher thread (only in the PIPELINED_COMMIT mode)
+        std::unique_ptr<CommitPipeline> m_commit_pipeline;
 #ifndef NDEBUG
         // total number of bytes from mutated data pages
         std::uint64_t m_page_io_raw_bytes = 0;
@@ -203,7 +232,7 @@ DB0_PACKED_END
         unsigned int *m_throw_op_count_ptr = nullptr;
 #endif
 
-        static DRAM_IOStream init(DRAM_IOStream &&, DRAM_ChangeLogStreamT &, StorageFlags);
+        static DRAM_IOStream init(DRAM_IOStream &&, DRAM_ChangeLogStreamT &, DRAM_CheckpointIOStream *, StorageFlags);
         static std::unique_ptr<DRAM_IOStream> initExt(std::unique_ptr<DRAM_IOStream> &&, DRAM_ChangeLogStreamT *, 
             StorageFlags, std::optional<StateNumType> max_state_num);
         
@@ -244,6 +273,8 @@ DB0_PACKED_END
 
         MetaIOStream getMetaIOStream(std::uint64_t first_block_pos, std::size_t step_size, AccessType);
         
+        std::unique_ptr<DRAM_CheckpointIOStream> tryGetDRAMCheckpointIOStream(std::uint64_t first_block_pos, AccessType);
+        
         Diff_IO getPage_IO(std::optional<std::uint64_t> next_page_hint, std::uint32_t step_size);
         
         o_prefix_config readConfig() const;
@@ -265,9 +296,16 @@ DB0_PACKED_END
         void _read(std::uint64_t address, StateNumType state_num, std::size_t size, void *buffer,
             FlagSet<AccessOptions> = { AccessOptions::read, AccessOptions::write }, unsigned int *chain_len = nullptr) const;
         
+        // Append a full-DP as a compressed block (compressed prefixes only)
+        void writeCompressed(std::uint64_t page_num, StateNumType state_num, const std::byte *buffer);
+        
         // Flush ext-space streams only (if existing)
         bool flushExt(StateNumType max_state_num);
         void fsync();
+        // Make the transaction durable: write the DRAM-changelog between the 2 fsyncs
+        void finalizeCommit();
+        // Overwrite the DRAM-space checkpoint with the current (committed) state
+        void writeDRAMCheckpoint(bool clean);
         
         // Synchronization state number for ext-space
         std::optional<StateNumType> getMaxExtStateNum() const;
@@ -16,6 +16,14 @@ namespace db0
         return m_access_type;
     }
     
+    StorageFlags BaseStorage::getFlags() const {
+        return m_flags;
+    }
+    
+    bool BaseStorage::supportsConcurrentReads() const {
+        return false;
+    }
+    
     void BaseStorage::getStats(std::function<void(const std::string &, std::uint64_t)>) const
     {
     }
@@ -53,6 +61,9 @@ namespace db0
     }
 #endif        
 
+    void BaseStorage::waitDurable(std::optional<StateNumType>) {
+    }
+    
     void BaseStorage::beginCommit() {
     }
     
@@ -68,5 +79,9 @@ namespace db0
     BDevStorage &BaseStorage::asFile() {
         THROWF(db0::InternalException) << "Storage is not file-based" << THROWF_END;
     }
+
+    std::string BaseStorage::getFileName() const {
+        return {};
+    }
     
 }
\ No newline at end of file
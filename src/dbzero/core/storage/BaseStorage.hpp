@@ -10,6 +10,7 @@
 #include <functional>
 #include <unordered_map>
 #include <optional>
+#include <string>
 #include "ChangeLogTypes.hpp"
 #include "StorageFlags.hpp"
 
@@ -89,6 +90,13 @@ namespace db0
 
         virtual AccessType getAccessType() const;
         
+        // Storage options this instance was opened with
+        StorageFlags getFlags() const;
+        
+        // Check if read / tryFindMutation can be called from a background thread
+        // concurrently with other operations (e.g. to implement read-ahead), false by default
+        virtual bool supportsConcurrentReads() const;
+        
         /**
          * Flush all in-memory changes to disk
          * @return true if any changes were flushed (false if there were no modifications to be flushed)
@@ -127,6 +135,10 @@ namespace db0
         virtual void beginCommit();
         virtual void endCommit();
         
+        // Block until the specific state (or all committed states if not specified) is durable
+        // this is only relevant for storages which finalize commits asynchronously (see StorageOptions::PIPELINED_COMMIT)
+        virtual void waitDurable(std::optional<StateNumType> state_num = {});
+        
         // Retrieve the complete change log (i.e. DP updates) for each transaction from the given range
         // @param begin_state the first state number to be included in the change log
         // @param end_state the first state number past the last state number to be included 
@@ -137,6 +149,9 @@ namespace db0
         
         // Throws where this conversion is not possible
         virtual BDevStorage &asFile();
+
+        // The underlying file name (empty if not file-based)
+        virtual std::string getFileName() const;
         
 #ifndef NDEBUG
         // state number, file offset
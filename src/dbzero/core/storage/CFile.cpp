@@ -12,6 +12,7 @@
 #  include <direct.h>
 #else
 #  include <unistd.h>
+#  include <fcntl.h>
 #endif
 
 
@@ -22,6 +23,8 @@
 #endif
 
 #include <dbzero/core/exception/Exceptions.hpp>
+#include <dbzero/core/threading/WorkerPool.hpp>
+#include "IOUring.hpp"
 
 namespace db0
 
@@ -42,8 +45,30 @@ namespace db0
         return result;
     }
 
-    FILE *openFile(const char *file_name, AccessType access_type)
+    std::uint64_t getFileSize(int fd)
     {
+        struct stat st;
+        if (fstat(fd, &st)) {
+            THROWF(db0::IOException) << "CFile::getFileSize: fstat failed";
+        }
+        return st.st_size;
+    }
+    
+    FileIOMode getSupportedIOMode(FileIOMode io_mode)
+    {
+#ifdef _WIN32
+        // positional I/O not supported, fall back to buffered mode
+        return FileIOMode::BUFFERED;
+#else
+        return io_mode;
+#endif
+    }
+    
+    FILE *openFile(const char *file_name, AccessType access_type, FileIOMode io_mode)
+    {
+        if (io_mode != FileIOMode::BUFFERED) {
+            return nullptr;
+        }
         auto file = fopen(file_name, (access_type == AccessType::READ_ONLY)?"rb":"r+b");
         if (!file) {
             THROWF(db0::IOException) << "Unable to open file: " << file_name;
@@ -51,6 +76,22 @@ namespace db0
 
         return file;
     }
+
+    int openFD(const char *file_name, AccessType access_type, FileIOMode io_mode)
+    {
+        if (io_mode != FileIOMode::POSITIONAL) {
+            return -1;
+        }
+#ifdef _WIN32
+        THROWF(db0::IOException) << "Positional I/O not supported on this platform";
+#else
+        auto fd = ::open(file_name, ((access_type == AccessType::READ_ONLY) ? O_RDONLY : O_RDWR) | O_CLOEXEC);
+        if (fd < 0) {
+            THROWF(db0::IOException) << "Unable to open file: " << file_name;
+        }
+        return fd;
+#endif
+    }
     
     std::uint64_t getLastModifiedTime(const char *file_name)
     {
@@ -76,11 +117,13 @@ namespace db0
     {
     }
     
-    CFile::CFile(const std::string &file_name, AccessType access_type, LockFlags lock_flags)
+    CFile::CFile(const std::string &file_name, AccessType access_type, LockFlags lock_flags, FileIOMode io_mode)
         : m_path(file_name)
         , m_access_type(access_type)
-        , m_file(openFile(m_path.c_str(), access_type))
-        , m_file_size(getFileSize(m_file, m_file_pos))
+        , m_io_mode(getSupportedIOMode(io_mode))
+        , m_file(openFile(m_path.c_str(), access_type, m_io_mode))
+        , m_fd(openFD(m_path.c_str(), access_type, m_io_mode))
+        , m_file_size(m_file ? getFileSize(m_file, m_file_pos) : getFileSize(m_fd))
     {
         if (access_type == AccessType::READ_WRITE && lock_flags.m_no_lock == false) {
             std::string lock_path = m_path + ".lock";
@@ -96,6 +139,11 @@ namespace db0
             }         
             fclose(m_file);
         }
+#ifndef _WIN32
+        if (m_fd >= 0) {
+            ::close(m_fd);
+        }
+#endif
         assert(!m_dirty);
     }
     
@@ -109,12 +157,23 @@ namespace db0
 
     void CFile::fsync() const
     {
-        std::unique_lock<std::mutex> lock(m_mutex);
-        flush(lock);
         if (m_access_type == AccessType::READ_ONLY) {
             THROWF(db0::IOException) << "Commit failed! errno=" << errno
                   << " (" << strerror(errno) << ")\n";
         }
+#ifndef _WIN32
+        if (m_io_mode == FileIOMode::POSITIONAL) {
+            // NOTE: pwrite is unbuffered, nothing to flush
+            if (::fsync(m_fd) == -1) {
+                THROWF(db0::IOException) << "CFile::fsync: failed to sync file " << m_path;
+            }
+            return;
+        }
+#endif
+        std::unique_lock<std::mutex> lock(m_mutex);
+        flush(lock);
+        // NOTE: the lock is not held while syncing so that concurrent reads / writes are not blocked
+        lock.unlock();
 #ifdef _WIN32
         if (_commit(fileno(m_file)) == -1) {
             THROWF(db0::IOException) << "CFile::fsync: failed to sync file " << m_path;
@@ -128,6 +187,9 @@ namespace db0
 
     void CFile::flush() const
     {
+        if (m_io_mode == FileIOMode::POSITIONAL) {
+            return;
+        }
         std::unique_lock<std::mutex> lock(m_mutex);
         flush(lock);
     }
@@ -140,14 +202,30 @@ namespace db0
             }
             m_file = nullptr;
         }
+#ifndef _WIN32
+        if (m_fd >= 0) {
+            if (::close(m_fd)) {
+                THROWF(db0::IOException) << "CFile::close: failed to close file " << m_path;
+            }
+            m_fd = -1;
+        }
+#endif
         //release the lock
         m_lock.reset();
     }
     
     bool CFile::refresh()
     {
+        if (m_io_mode == FileIOMode::POSITIONAL) {
+            if (m_access_type == AccessType::READ_ONLY && m_fd >= 0) {
+                auto file_size = getFileSize(m_fd);
+                return m_file_size.exchange(file_size) != file_size;
+            }
+            return false;
+        }
         std::unique_lock<std::mutex> lock(m_mutex);
         if (m_access_type == AccessType::READ_ONLY && m_file) {
+            reopenAfterFork(lock);
             auto file_size = getFileSize(m_file, m_file_pos);
             if (file_size != m_file_size) {
                 m_file_size = file_size;
@@ -202,10 +280,62 @@ namespace db0
         }
     }
     
+    void CFile::preadAll(std::uint64_t address, std::size_t size, void *buffer) const
+    {
+#ifndef _WIN32
+        auto ptr = static_cast<char *>(buffer);
+        while (size > 0) {
+            auto result = ::pread(m_fd, ptr, size, address);
+            if (result < 0 && errno == EINTR) {
+                continue;
+            }
+            if (result <= 0) {
+                THROWF(db0::IOException) << "CFile::read: pread failed";
+            }
+            ptr += result;
+            address += result;
+            size -= result;
+        }
+#endif
+    }
+
+    void CFile::pwriteAll(std::uint64_t address, std::size_t size, const void *buffer)
+    {
+#ifndef _WIN32
+        auto ptr = static_cast<const char *>(buffer);
+        while (size > 0) {
+            auto result = ::pwrite(m_fd, ptr, size, address);
+            if (result < 0 && errno == EINTR) {
+                continue;
+            }
+            if (result <= 0) {
+                THROWF(db0::IOException) << "CFile::write: pwrite failed";
+            }
+            ptr += result;
+            address += result;
+            size -= result;
+        }
+#endif
+    }
+    
     void CFile::write(std::uint64_t address, std::size_t size, const void *buffer)
-    {        
-        std::unique_lock<std::mutex> lock(m_mutex);
+    {
         assert(m_access_type != AccessType::READ_ONLY);
+        if (m_io_mode == FileIOMode::POSITIONAL) {
+            assert(!overlap(m_protected, { address, size }));
+            if (m_last_write_end.exchange(address + size) != address) {
+                ++m_rand_write_ops;
+            }
+            pwriteAll(address, size, buffer);
+            // update file size (concurrent writers possible)
+            auto end = address + size;
+            auto file_size = m_file_size.load();
+            while (file_size < end && !m_file_size.compare_exchange_weak(file_size, end));
+            m_bytes_written += size;
+            return;
+        }
+        
+        std::unique_lock<std::mutex> lock(m_mutex);
         if (address != m_file_pos) {
             setFilePos(address, lock);
             ++m_rand_write_ops;
@@ -216,7 +346,7 @@ namespace db0
             THROWF(db0::IOException) << "CFile::write: fwrite failed";
         }
         m_file_pos += size;
-        m_file_size = std::max(m_file_size, m_file_pos);
+        m_file_size = std::max(m_file_size.load(), m_file_pos);
         m_bytes_written += size;
         if (!m_dirty) {
             m_dirty = true;
@@ -225,7 +355,22 @@ namespace db0
     
     void CFile::read(std::uint64_t address, std::size_t size, void *buffer) const
     {
+        if (m_io_mode == FileIOMode::POSITIONAL) {
+            if (m_last_read_end.exchange(address + size) != address) {
+                ++m_rand_read_ops;
+            }
+            preadAll(address, size, buffer);
+            m_bytes_read += size;
+            return;
+        }
+        
         std::unique_lock<std::mutex> lock(m_mutex);
+        read(address, size, buffer, lock);
+    }
+    
+    void CFile::read(std::uint64_t address, std::size_t size, void *buffer, std::unique_lock<std::mutex> &lock) const
+    {
+        reopenAfterFork(lock);
         // need to flush data from buffer before reading
         if (m_dirty) {
             flush(lock);
@@ -242,6 +387,62 @@ namespace db0
         m_bytes_read += size;
     }
     
+    void CFile::readBatch(const std::vector<ReadRequest> &requests) const
+    {
+        if (requests.size() == 1) {
+            read(requests.front().m_address, requests.front().m_size, requests.front().m_buffer);
+            return;
+        }
+        if (requests.empty()) {
+            return;
+        }
+        
+        // NOTE: adjacent requests are merged to reduce the number of I/O operations
+        auto groups = groupReadRequests(requests);
+        if (m_io_mode == FileIOMode::POSITIONAL) {
+            std::size_t total_bytes = 0;
+            for (auto &group: groups) {
+                total_bytes += group.m_size;
+            }
+            m_rand_read_ops += groups.size();
+            m_bytes_read += total_bytes;
+            if (groups.size() == 1) {
+                preadGroup(m_fd, groups.front());
+            } else if (auto io_uring = IOUring::tryGetThreadInstance()) {
+                io_uring->read(m_fd, groups);
+            } else {
+                WorkerPool::getIOPool().run(groups.size(), [&](std::size_t index) {
+                    preadGroup(m_fd, groups[index]);
+                });
+            }
+            return;
+        }
+        
+        // buffered mode, read groups sequentially (by ascending address)
+        std::unique_lock<std::mutex> lock(m_mutex);
+        for (auto &group: groups) {
+            for (auto &request: group.m_requests) {
+                read(request.m_address, request.m_size, request.m_buffer, lock);
+            }
+        }
+    }
+    
+    void CFile::reopenAfterFork(std::unique_lock<std::mutex> &) const
+    {
+#ifndef _WIN32
+        if (m_pid == ::getpid() || m_access_type != AccessType::READ_ONLY) {
+            return;
+        }
+        // the inherited stream shares its file offset with the parent process (which may keep reading),
+        // the child needs its own file description
+        auto file = openFile(m_path.c_str(), m_access_type, m_io_mode);
+        fclose(m_file);
+        m_file = file;
+        m_file_pos = 0;
+        m_pid = ::getpid();
+#endif
+    }
+    
     std::uint64_t CFile::getLastModifiedTime() const {
         return db0::getLastModifiedTime(m_path.c_str());
     }
@@ -260,11 +461,11 @@ namespace db0
     }
 
     std::pair<std::uint64_t, std::uint64_t> CFile::getRandOps() const {
-        return { m_rand_read_ops, m_rand_write_ops };
+        return { m_rand_read_ops.load(), m_rand_write_ops.load() };
     }
 
     std::pair<std::uint64_t, std::uint64_t> CFile::getIOBytes() const {
-        return { m_bytes_read, m_bytes_written };
+        return { m_bytes_read.load(), m_bytes_written.load() };
     }
     
 #ifndef NDEBUG    
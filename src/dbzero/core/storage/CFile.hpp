@@ -7,15 +7,29 @@
 #include <vector>
 #include <atomic>
 #include <memory>
+#include <mutex>
 #include <dbzero/core/memory/AccessOptions.hpp>
+#include "ReadRequest.hpp"
 #include <dbzero/core/utils/InterProcessLock.hpp>
 #include <dbzero/workspace/LockFlags.hpp>
+#ifndef _WIN32
+#  include <unistd.h>
+#endif
 
 namespace db0
 
 {
 
-    // CFile is a wrapper around std::FILE
+    enum class FileIOMode: std::uint8_t
+    {
+        // std::FILE based buffered I/O, all operations serialized by a single mutex
+        BUFFERED = 0,
+        // pread / pwrite over a raw file descriptor, no shared file position & no global mutex
+        // NOTE: on platforms without positional I/O support the BUFFERED mode is used instead
+        POSITIONAL = 1
+    };
+    
+    // CFile is a wrapper around std::FILE (or a raw file descriptor in the POSITIONAL mode)
     class CFile
     {
     public:
@@ -23,7 +37,8 @@ namespace db0
          * Open existing binary file for read/write
          */
         CFile(const std::string &file_name, AccessType access_type);
-        CFile(const std::string &file_name, AccessType access_type, LockFlags lock_flags);
+        CFile(const std::string &file_name, AccessType access_type, LockFlags lock_flags,
+            FileIOMode io_mode = FileIOMode::BUFFERED);
         ~CFile();
 
         /**
@@ -42,6 +57,10 @@ namespace db0
         void write(std::uint64_t address, std::size_t size, const void *buffer);
         
         void read(std::uint64_t address, std::size_t size, void *buffer) const;
+        
+        // Execute multiple reads as a single batch (in no particular order)
+        // in the POSITIONAL mode requests are submitted with io_uring (if supported) or executed by the I/O thread pool
+        void readBatch(const std::vector<ReadRequest> &) const;
 
         std::string getName() const {
             return m_path;
@@ -66,12 +85,16 @@ namespace db0
         }
         
         bool operator()() const {
-            return m_file != nullptr;
+            return m_file != nullptr || m_fd >= 0;
         }
 
         AccessType getAccessType() const {
             return m_access_type;
         }
+        
+        FileIOMode getIOMode() const {
+            return m_io_mode;
+        }
 
         /**
          * Get last modification timestamp
@@ -93,14 +116,24 @@ namespace db0
     private:
         const std::string m_path;
         const AccessType m_access_type;
-        FILE *m_file = nullptr;
+        const FileIOMode m_io_mode;
+        // NOTE: only one of m_file / m_fd is used depending on the I/O mode
+        mutable FILE *m_file = nullptr;
+        int m_fd = -1;
+#ifndef _WIN32
+        // the process which opened m_file (re-opened by a forked child)
+        mutable pid_t m_pid = ::getpid();
+#endif
         mutable std::uint64_t m_file_pos = 0;
-        mutable std::uint64_t m_file_size = 0;
-        mutable std::uint64_t m_rand_read_ops = 0;
-        mutable std::uint64_t m_rand_write_ops = 0;
+        mutable std::atomic<std::uint64_t> m_file_size = 0;
+        // POSITIONAL mode only: end of the last read / write operation (to detect random ops)
+        mutable std::atomic<std::uint64_t> m_last_read_end = 0;
+        mutable std::atomic<std::uint64_t> m_last_write_end = 0;
+        mutable std::atomic<std::uint64_t> m_rand_read_ops = 0;
+        mutable std::atomic<std::uint64_t> m_rand_write_ops = 0;
         // total bytes read / written
-        mutable std::uint64_t m_bytes_read = 0;
-        mutable std::uint64_t m_bytes_written = 0;
+        mutable std::atomic<std::uint64_t> m_bytes_read = 0;
+        mutable std::atomic<std::uint64_t> m_bytes_written = 0;
         std::unique_ptr<InterProcessLock> m_lock;        
         mutable std::mutex m_mutex;
         mutable bool m_dirty = false;
@@ -110,6 +143,12 @@ namespace db0
         
         void flush(std::unique_lock<std::mutex> &) const;
         void setFilePos(std::uint64_t address, std::unique_lock<std::mutex> &) const;
+        void read(std::uint64_t address, std::size_t size, void *buffer, std::unique_lock<std::mutex> &) const;
+        // BUFFERED / READ_ONLY mode only: open a separate stream in the forked child process
+        void reopenAfterFork(std::unique_lock<std::mutex> &) const;
+        
+        void preadAll(std::uint64_t address, std::size_t size, void *buffer) const;
+        void pwriteAll(std::uint64_t address, std::size_t size, const void *buffer);
     };
     
     std::uint64_t getLastModifiedTime(const char *file_name);
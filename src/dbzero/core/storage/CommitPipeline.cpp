@@ -0,0 +1,111 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#include "CommitPipeline.hpp"
+#include <cassert>
+#include <dbzero/core/exception/Exceptions.hpp>
+
+namespace db0
+
+{
+
+    CommitPipeline::CommitPipeline(StateNumType durable_state_num)
+        : m_pending_state_num(durable_state_num)
+        , m_durable_state_num(durable_state_num)
+        , m_thread(&CommitPipeline::run, this)
+    {
+    }
+
+    CommitPipeline::~CommitPipeline()
+    {
+        try {
+            stop();
+        } catch (...) {
+        }
+    }
+
+    void CommitPipeline::submit(StateNumType state_num, std::function<void()> finalize)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        waitDurable(lock, {});
+        assert(!m_stopped);
+        assert(state_num > m_durable_state_num);
+        m_task = std::move(finalize);
+        m_pending_state_num = state_num;
+        lock.unlock();
+        m_cv.notify_all();
+    }
+
+    void CommitPipeline::waitDurable(std::optional<StateNumType> state_num)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        waitDurable(lock, state_num);
+    }
+
+    void CommitPipeline::waitDurable(std::unique_lock<std::mutex> &lock, std::optional<StateNumType> state_num)
+    {
+        if (state_num && *state_num > m_pending_state_num) {
+            THROWF(db0::InputException) << "CommitPipeline::waitDurable: state " << *state_num
+                << " has not been submitted yet (last submitted: " << m_pending_state_num << ")" << THROWF_END;
+        }
+        m_cv.wait(lock, [&]() {
+            return m_error || !m_task || (state_num && *state_num <= m_durable_state_num);
+        });
+        if (m_error) {
+            // NOTE: the error is sticky, i.e. reported to all subsequent callers since the state was lost
+            std::rethrow_exception(m_error);
+        }
+    }
+
+    StateNumType CommitPipeline::getDurableStateNum() const
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_durable_state_num;
+    }
+
+    void CommitPipeline::stop()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_stopped) {
+            return;
+        }
+        m_stopped = true;
+        lock.unlock();
+        m_cv.notify_all();
+        // the flusher thread completes the pending task before exiting
+        m_thread.join();
+        lock.lock();
+        if (m_error) {
+            std::rethrow_exception(m_error);
+        }
+    }
+
+    void CommitPipeline::run()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        for (;;) {
+            m_cv.wait(lock, [&]() { return m_stopped || m_task; });
+            if (!m_task) {
+                assert(m_stopped);
+                break;
+            }
+            auto task = m_task;
+            lock.unlock();
+            std::exception_ptr error;
+            try {
+                task();
+            } catch (...) {
+                error = std::current_exception();
+            }
+            lock.lock();
+            if (error) {
+                m_error = error;
+            } else {
+                m_durable_state_num = m_pending_state_num;
+            }
+            m_task = nullptr;
+            m_cv.notify_all();
+        }
+    }
+
+}
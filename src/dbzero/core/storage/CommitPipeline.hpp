@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#pragma once
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+#include <optional>
+#include <dbzero/core/memory/config.hpp>
+
+namespace db0
+
+{
+
+    /**
+     * A dedicated flusher thread which finalizes (i.e. makes durable) sealed transactions
+     * while the writer proceeds with the next one.
+     * The pipeline depth is 1 - i.e. a new state can only be submitted once the previous one is durable
+    */
+    class CommitPipeline
+    {
+    public:
+        // @param durable_state_num the last state already persisted (before the pipeline was started)
+        CommitPipeline(StateNumType durable_state_num = 0);
+        ~CommitPipeline();
+
+        // Hand over finalization of a specific state to the flusher thread
+        // NOTE: blocks while the previously submitted state is still being finalized
+        void submit(StateNumType, std::function<void()> finalize);
+
+        // Block until the specific state (or all submitted states if not specified) is durable
+        // rethrows an exception raised by the flusher thread (if any), the error is reported until the pipeline is re-created
+        // throws InputException if the state has not been submitted yet
+        void waitDurable(std::optional<StateNumType> state_num = {});
+
+        // @return the most recent state number known to be durable
+        StateNumType getDurableStateNum() const;
+
+        // Complete pending work and stop the flusher thread
+        void stop();
+
+    private:
+        mutable std::mutex m_mutex;
+        std::condition_variable m_cv;
+        std::function<void()> m_task;
+        StateNumType m_pending_state_num = 0;
+        StateNumType m_durable_state_num = 0;
+        std::exception_ptr m_error;
+        bool m_stopped = false;
+        std::thread m_thread;
+
+        void run();
+        void waitDurable(std::unique_lock<std::mutex> &, std::optional<StateNumType>);
+    };
+
+}
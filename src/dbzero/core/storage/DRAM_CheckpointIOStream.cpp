@@ -0,0 +1,153 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#include "DRAM_CheckpointIOStream.hpp"
+#include "CFile.hpp"
+#include <array>
+#include <cassert>
+#include <cstring>
+#include <algorithm>
+#include <dbzero/core/utils/hash_func.hpp>
+#include <dbzero/core/exception/Exceptions.hpp>
+
+namespace db0
+
+{
+
+    std::uint64_t o_dram_checkpoint::calculateChecksum(const void *payload, std::size_t size) const
+    {
+        std::array<std::uint64_t, 7> fields {
+            m_state_num, m_page_count, m_reusable_count, m_dram_io_address, m_dram_io_pos,
+            m_changelog_address, m_changelog_pos
+        };
+        auto seed = db0::murmurhash64A(fields.data(), sizeof(fields));
+        return db0::murmurhash64A(payload, size, seed);
+    }
+
+    DRAM_CheckpointIOStream::DRAM_CheckpointIOStream(CFile &m_file, std::uint64_t begin, std::uint32_t block_size,
+        std::function<std::uint64_t()> tail_function, AccessType access_type)
+        : BlockIOStream(m_file, begin, block_size, tail_function, access_type, DRAM_CheckpointIOStream::ENABLE_CHECKSUMS)
+        , m_chunk_size(block_size - BlockIOStream::sizeOfHeaders(DRAM_CheckpointIOStream::ENABLE_CHECKSUMS))
+    {
+        prepareChunk(m_chunk_size, m_header_chunk);
+    }
+
+    o_dram_checkpoint &DRAM_CheckpointIOStream::header() {
+        return o_dram_checkpoint::__ref(m_header_chunk.data() + o_block_io_chunk_header::sizeOf());
+    }
+
+    bool DRAM_CheckpointIOStream::tryRead(DRAM_Checkpoint &checkpoint)
+    {
+        m_chunk_addresses.clear();
+        std::vector<char> buffer(m_chunk_size);
+        std::vector<char> payload;
+        std::uint64_t address;
+        // NOTE: the entire stream is read to position it for append
+        while (readChunk(buffer, m_chunk_size, &address)) {
+            if (m_chunk_addresses.empty()) {
+                std::memcpy(m_header_chunk.data() + o_block_io_chunk_header::sizeOf(), buffer.data(), m_chunk_size);
+            } else {
+                payload.insert(payload.end(), buffer.begin(), buffer.end());
+            }
+            m_chunk_addresses.push_back(address);
+        }
+
+        if (m_chunk_addresses.empty()) {
+            return false;
+        }
+        auto &header = this->header();
+        if (!header.m_state_num) {
+            return false;
+        }
+        auto page_words = header.m_page_count * 3;
+        auto payload_size = (page_words + header.m_reusable_count) * sizeof(std::uint64_t);
+        // NOTE: the trailing chunks may remain from a larger, previous checkpoint
+        if (payload.size() < payload_size || header.calculateChecksum(payload.data(), payload_size) != header.m_checksum) {
+            return false;
+        }
+
+        auto words = reinterpret_cast<const std::uint64_t*>(payload.data());
+        checkpoint.m_state_num = header.m_state_num;
+        checkpoint.m_clean = header.m_clean != 0;
+        checkpoint.m_dram_io_pos = { (std::uint64_t)header.m_dram_io_address, (std::uint64_t)header.m_dram_io_pos };
+        checkpoint.m_changelog_pos = {
+            (std::uint64_t)header.m_changelog_address, (std::uint64_t)header.m_changelog_pos
+        };
+        checkpoint.m_pages.assign(words, words + page_words);
+        checkpoint.m_reusable.assign(words + page_words, words + page_words + header.m_reusable_count);
+        return true;
+    }
+
+    void DRAM_CheckpointIOStream::writeChunk(std::size_t index, std::vector<char> &raw_chunk)
+    {
+        if (index < m_chunk_addresses.size()) {
+            writeToChunk(m_chunk_addresses[index], raw_chunk.data(), raw_chunk.size());
+        } else {
+            assert(index == m_chunk_addresses.size());
+            std::uint64_t address;
+            addChunk(m_chunk_size, &address);
+            appendToChunk(raw_chunk.data() + o_block_io_chunk_header::sizeOf(), m_chunk_size);
+            m_chunk_addresses.push_back(address);
+        }
+    }
+
+    void DRAM_CheckpointIOStream::write(const DRAM_Checkpoint &checkpoint)
+    {
+        if (m_access_type == AccessType::READ_ONLY) {
+            THROWF(db0::IOException) << "DRAM_CheckpointIOStream::write error: read-only stream";
+        }
+
+        // invalidate the existing checkpoint first
+        auto &header = o_dram_checkpoint::__new(m_header_chunk.data() + o_block_io_chunk_header::sizeOf());
+        writeChunk(0, m_header_chunk);
+
+        std::vector<char> payload((checkpoint.m_pages.size() + checkpoint.m_reusable.size()) * sizeof(std::uint64_t));
+        auto words = reinterpret_cast<std::uint64_t*>(payload.data());
+        std::copy(checkpoint.m_pages.begin(), checkpoint.m_pages.end(), words);
+        std::copy(checkpoint.m_reusable.begin(), checkpoint.m_reusable.end(), words + checkpoint.m_pages.size());
+
+        std::vector<char> raw_chunk;
+        auto chunk_data = prepareChunk(m_chunk_size, raw_chunk);
+        std::size_t index = 1;
+        for (std::size_t offset = 0; offset < payload.size(); offset += m_chunk_size, ++index) {
+            auto size = std::min(m_chunk_size, payload.size() - offset);
+            std::memcpy(chunk_data, payload.data() + offset, size);
+            std::memset(chunk_data + size, 0, m_chunk_size - size);
+            writeChunk(index, raw_chunk);
+        }
+
+        // contents must be persisted before the valid header
+        BlockIOStream::flush();
+        m_file.fsync();
+
+        header.m_state_num = checkpoint.m_state_num;
+        header.m_page_count = checkpoint.size();
+        header.m_reusable_count = checkpoint.m_reusable.size();
+        header.m_dram_io_address = checkpoint.m_dram_io_pos.first;
+        header.m_dram_io_pos = checkpoint.m_dram_io_pos.second;
+        header.m_changelog_address = checkpoint.m_changelog_pos.first;
+        header.m_changelog_pos = checkpoint.m_changelog_pos.second;
+        header.m_checksum = header.calculateChecksum(payload.data(), payload.size());
+        header.m_clean = checkpoint.m_clean ? 1 : 0;
+        writeChunk(0, m_header_chunk);
+        BlockIOStream::flush();
+        m_file.flush();
+    }
+
+    void DRAM_CheckpointIOStream::setClean(bool clean)
+    {
+        auto &header = this->header();
+        if (m_chunk_addresses.empty() || !header.m_state_num || (header.m_clean != 0) == clean) {
+            return;
+        }
+        if (m_access_type == AccessType::READ_ONLY) {
+            THROWF(db0::IOException) << "DRAM_CheckpointIOStream::setClean error: read-only stream";
+        }
+        header.m_clean = clean ? 1 : 0;
+        writeChunk(0, m_header_chunk);
+        // NOTE: the flag must be durable before any subsequent DRAM writes
+        BlockIOStream::flush();
+        m_file.fsync();
+    }
+
+}
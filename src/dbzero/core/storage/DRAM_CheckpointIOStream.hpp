@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#pragma once
+
+#include "BlockIOStream.hpp"
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <dbzero/core/memory/config.hpp>
+#include <dbzero/core/serialization/Types.hpp>
+#include <dbzero/core/compiler_attributes.hpp>
+
+namespace db0
+
+{
+
+DB0_PACKED_BEGIN
+    struct DB0_PACKED_ATTR o_dram_checkpoint: public o_fixed<o_dram_checkpoint>
+    {
+        // state number the checkpoint was taken at (0 = invalid / being written)
+        StateNumType m_state_num = 0;
+        std::uint64_t m_page_count = 0;
+        std::uint64_t m_reusable_count = 0;
+        // DRAM stream position (address / relative) following the checkpointed chunks
+        std::uint64_t m_dram_io_address = 0;
+        std::uint64_t m_dram_io_pos = 0;
+        // DRAM-changelog position of the chunk corresponding to m_state_num
+        std::uint64_t m_changelog_address = 0;
+        std::uint64_t m_changelog_pos = 0;
+        // checksum of the checkpoint's contents (excluding the flags)
+        std::uint64_t m_checksum = 0;
+        // set when written by a closing writer (i.e. no later, uncommitted DRAM writes possible)
+        std::uint32_t m_clean = 0;
+
+        std::uint64_t calculateChecksum(const void *payload, std::size_t size) const;
+    };
+DB0_PACKED_END
+
+    // The resolved DRAM space layout at a specific state number
+    struct DRAM_Checkpoint
+    {
+        StateNumType m_state_num = 0;
+        bool m_clean = false;
+        std::pair<std::uint64_t, std::uint64_t> m_dram_io_pos;
+        std::pair<std::uint64_t, std::uint64_t> m_changelog_pos;
+        // page_num / state_num / chunk address
+        std::vector<std::uint64_t> m_pages;
+        // addresses of the reusable DRAM chunks
+        std::vector<std::uint64_t> m_reusable;
+
+        std::size_t size() const {
+            return m_pages.size() / 3;
+        }
+    };
+
+    /**
+     * The stream holding a single (most recent) DRAM_IOStream checkpoint,
+     * it allows loading DRAM space without scanning the entire DRAM stream & changelog
+     * The checkpoint is overwritten in place (the stream only grows with the DRAM space)
+     * The header chunk is written last, readers validate the contents with a checksum
+     * and fall back to a full DRAM_IOStream load if validation fails
+    */
+    class DRAM_CheckpointIOStream: public BlockIOStream
+    {
+    public:
+        // checksums disabled in this type of stream (chunks are overwritten)
+        static constexpr bool ENABLE_CHECKSUMS = false;
+
+        DRAM_CheckpointIOStream(CFile &m_file, std::uint64_t begin, std::uint32_t block_size,
+            std::function<std::uint64_t()> tail_function = {}, AccessType = AccessType::READ_WRITE);
+
+        /**
+         * Read the checkpoint from the stream
+         * NOTE: must be called before any write (to collect the existing chunk locations)
+         * @return false if no valid checkpoint is available
+        */
+        bool tryRead(DRAM_Checkpoint &);
+
+        // Overwrite the checkpoint (read/write mode only)
+        void write(const DRAM_Checkpoint &);
+
+        // Rewrite the clean flag of the existing checkpoint (if any)
+        void setClean(bool);
+
+    private:
+        // the fixed chunk size (one chunk per block)
+        const std::size_t m_chunk_size;
+        // locations of the existing chunks, the header chunk first
+        std::vector<std::uint64_t> m_chunk_addresses;
+        // the raw header chunk (as last read or written)
+        std::vector<char> m_header_chunk;
+
+        o_dram_checkpoint &header();
+        void writeChunk(std::size_t index, std::vector<char> &raw_chunk);
+    };
+
+}
@@ -36,6 +36,9 @@ namespace db0
         , m_page_map(std::move(other.m_page_map))
         , m_prefix(other.m_prefix)
         , m_allocator(other.m_allocator)        
+        , m_state_num(other.m_state_num)
+        , m_changelog_pos(other.m_changelog_pos)
+        , m_checkpoint_state_num(other.m_checkpoint_state_num)
     {
     }
     
@@ -116,11 +119,11 @@ namespace db0
     {
         // Exhaust the change-log stream first and retrieve the last valid state number
         // its position marks the synchronization point
-        while (changelog_io.readChangeLogChunk());
-
-        std::vector<char> buffer(m_chunk_size, 0);
-        const auto &header = o_dram_chunk_header::__ref(buffer.data());
-        auto bytes = buffer.data() + header.sizeOf();
+        auto stream_pos = changelog_io.getStreamPos();
+        while (changelog_io.readChangeLogChunk()) {
+            m_changelog_pos = stream_pos;
+            stream_pos = changelog_io.getStreamPos();
+        }
         
         auto last_chunk_ptr = changelog_io.getLastChangeLogChunk();
         if (!last_chunk_ptr) {
@@ -132,7 +135,115 @@ namespace db0
         if (!max_state_num) {
             max_state_num = last_chunk_ptr->m_state_num;
         }
+        m_state_num = *max_state_num;
+        std::unordered_set<std::size_t> allocs;
+        loadChunks(*max_state_num, allocs);
+        m_allocator->update(allocs);
+    }
+    
+    bool DRAM_IOStream::load(DRAM_ChangeLogStreamT &changelog_io, const DRAM_Checkpoint &checkpoint)
+    {
+        assert(m_page_map.empty());
+        try {
+            changelog_io.setStreamPos(checkpoint.m_changelog_pos);
+            setStreamPos(checkpoint.m_dram_io_pos);
+        } catch (db0::InternalException &) {
+            changelog_io.setStreamPosHead();
+            setStreamPosHead();
+            load(changelog_io);
+            return false;
+        }
+        
+        // collect chunks from the change-log tail (i.e. modified after the checkpoint)
+        std::vector<std::uint64_t> tail_chunks;
+        auto stream_pos = changelog_io.getStreamPos();
+        while (auto change_log_ptr = changelog_io.readChangeLogChunk()) {
+            m_changelog_pos = stream_pos;
+            stream_pos = changelog_io.getStreamPos();
+            if (change_log_ptr->m_state_num > checkpoint.m_state_num) {
+                for (auto address: *change_log_ptr) {
+                    tail_chunks.push_back(address);
+                }
+            }
+        }
+        
+        // The full load (the change-log is already exhausted)
+        auto reload = [&, this]() {
+            m_page_map.clear();
+            m_reusable_chunks.clear();
+            setStreamPosHead();
+            load(changelog_io);
+            return false;
+        };
+        
+        auto last_chunk_ptr = changelog_io.getLastChangeLogChunk();
+        if (!last_chunk_ptr || last_chunk_ptr->m_state_num < checkpoint.m_state_num) {
+            // checkpoint does not match the change-log
+            return reload();
+        }
+        
+        auto max_state_num = last_chunk_ptr->m_state_num;
+        m_state_num = max_state_num;
+        if (m_access_type == AccessType::READ_WRITE) {
+            m_reusable_chunks.insert(checkpoint.m_reusable.begin(), checkpoint.m_reusable.end());
+        }
+        
+        std::vector<char> raw_block;
+        auto buffer = prepareChunk(m_chunk_size, raw_block);
+        const auto &header = o_dram_chunk_header::__const_ref(buffer);
+        auto bytes = buffer + header.sizeOf();
         std::unordered_set<std::size_t> allocs;
+        auto update_from_chunk = [&, this](std::uint64_t address) {
+            readFromChunk(address, raw_block.data(), raw_block.size());
+            // NOTE: the chunk might've been reused (or partially written) after the checkpoint was taken
+            // in such case it's included in the change-log tail
+            if (!isDRAM_ChunkValid(m_dram_page_size, header, bytes, raw_block.data() + raw_block.size())) {
+                return false;
+            }
+            updateDRAMPage(address, &allocs, header, bytes, max_state_num);
+            return true;
+        };
+        
+        std::vector<std::uint64_t> invalid_chunks;
+        for (std::size_t i = 0; i < checkpoint.m_pages.size(); i += 3) {
+            if (!update_from_chunk(checkpoint.m_pages[i + 2])) {
+                invalid_chunks.push_back(checkpoint.m_pages[i + 2]);
+            }
+        }
+        for (auto address: tail_chunks) {
+            update_from_chunk(address);
+        }
+        // chunks appended after the checkpoint (not reflected in the change-log)
+        loadChunks(max_state_num, allocs);
+        
+        // all checkpointed pages must've been recovered
+        for (std::size_t i = 0; i < checkpoint.m_pages.size(); i += 3) {
+            if (m_page_map.find(checkpoint.m_pages[i]) == m_page_map.end()) {
+                return reload();
+            }
+        }
+        
+        if (m_access_type == AccessType::READ_WRITE && !invalid_chunks.empty()) {
+            std::unordered_set<std::uint64_t> live_chunks;
+            for (auto &item: m_page_map) {
+                live_chunks.insert(item.second.m_address);
+            }
+            for (auto address: invalid_chunks) {
+                if (live_chunks.find(address) == live_chunks.end()) {
+                    m_reusable_chunks.insert(address);
+                }
+            }
+        }
+        m_allocator->update(allocs);
+        m_checkpoint_state_num = checkpoint.m_state_num;
+        return true;
+    }
+    
+    void DRAM_IOStream::loadChunks(StateNumType max_state_num, std::unordered_set<std::size_t> &allocs)
+    {
+        std::vector<char> buffer(m_chunk_size, 0);
+        const auto &header = o_dram_chunk_header::__ref(buffer.data());
+        auto bytes = buffer.data() + header.sizeOf();
         for (;;) {
             auto block_id = tellBlock();
             std::uint64_t chunk_addr;
@@ -151,7 +262,7 @@ namespace db0
             // - this chunk might simply be too fresh to be included
             // NOTE: also pages from future (abruptly terminated) transactions are reverted
             if (!isDRAM_ChunkValid(m_dram_page_size, header, bytes, buffer.data() + buffer.size())
-                || header.m_state_num > *max_state_num)
+                || header.m_state_num > max_state_num)
             {
                 // overwrite the page to prevent from being included in the future
                 // this is only permitted in read/write mode !!
@@ -161,9 +272,31 @@ namespace db0
                 continue;
             }
 
-            updateDRAMPage(chunk_addr, &allocs, header, bytes, *max_state_num);
+            updateDRAMPage(chunk_addr, &allocs, header, bytes, max_state_num);
         }
-        m_allocator->update(allocs);
+    }
+    
+    void DRAM_IOStream::getCheckpoint(DRAM_Checkpoint &checkpoint) const
+    {
+        if (m_access_type == AccessType::READ_ONLY) {
+            THROWF(db0::IOException) << "DRAM_IOStream::getCheckpoint require read/write stream";
+        }
+        checkpoint.m_state_num = m_state_num;
+        checkpoint.m_dram_io_pos = getStreamPos();
+        checkpoint.m_changelog_pos = m_changelog_pos;
+        // pages ordered by the chunk address (for sequential reads on load)
+        std::vector<std::pair<std::uint32_t, DRAM_PageInfo> > pages(m_page_map.begin(), m_page_map.end());
+        std::sort(pages.begin(), pages.end(), [](const auto &a, const auto &b) {
+            return a.second.m_address < b.second.m_address;
+        });
+        checkpoint.m_pages.clear();
+        checkpoint.m_pages.reserve(pages.size() * 3);
+        for (auto &item: pages) {
+            checkpoint.m_pages.push_back(item.first);
+            checkpoint.m_pages.push_back(item.second.m_state_num);
+            checkpoint.m_pages.push_back(item.second.m_address);
+        }
+        checkpoint.m_reusable.assign(m_reusable_chunks.begin(), m_reusable_chunks.end());
     }
     
     std::ostream &DRAM_IOStream::dumpPageMap(std::ostream &os) const
@@ -269,6 +402,8 @@ namespace db0
         
         // flush all DRAM data updates before changelog updates
         BlockIOStream::flush();
+        m_state_num = state_num;
+        m_changelog_pos = dram_changelog_io.getStreamPos();
         // output changelog, no RLE encoding, no duplicates
         ChangeLogData cl_data(std::move(dram_changelog), false, false, false);
         dram_changelog_io.appendChangeLog(std::move(cl_data), state_num);
@@ -18,6 +18,7 @@
 #include <dbzero/core/compiler_attributes.hpp>
 #include "BaseStorage.hpp"
 #include "ChangeLogIOStream.hpp"
+#include "DRAM_CheckpointIOStream.hpp"
 
 namespace db0
 
@@ -161,6 +162,21 @@ DB0_PACKED_END
         */
         void load(DRAM_ChangeLogStreamT &, std::optional<StateNumType> max_state_num = std::nullopt);
         
+        /**
+         * Load contents from the checkpoint, then replay only the change-log (and stream) tail following it
+         * Falls back to the full load if the checkpoint is not consistent with the streams
+         * @return false if the checkpoint could not be used
+        */
+        bool load(DRAM_ChangeLogStreamT &, const DRAM_Checkpoint &);
+        
+        // Capture the current DRAM space layout (read/write mode only)
+        void getCheckpoint(DRAM_Checkpoint &) const;
+        
+        // @return state number of the checkpoint the contents were loaded from (0 if fully loaded)
+        StateNumType getCheckpointStateNum() const {
+            return m_checkpoint_state_num;
+        }
+        
         std::size_t getChunkSize() const {
             return m_chunk_size;
         }
@@ -180,6 +196,10 @@ DB0_PACKED_END
         std::shared_ptr<DRAM_Allocator> m_allocator;
         // chunks buffer for the beginApplyChanges / completeApplyChanges operations
         mutable std::unordered_map<std::uint64_t, std::vector<char> > m_read_ahead_chunks;
+        // the state number and the change-log position of the last loaded or flushed change-log chunk
+        StateNumType m_state_num = 0;
+        std::pair<std::uint64_t, std::uint64_t> m_changelog_pos;
+        StateNumType m_checkpoint_state_num = 0;
         
         // @param max_state_num the last known consistent state number
         // @param is_consistent flag set to false if the resulting state cannot be assumed consistent
@@ -192,6 +212,9 @@ DB0_PACKED_END
         // Overwrite invalid or corrupted DRAM page with null data
         void trashDRAMPage(std::uint64_t address);
         
+        // Load all remaining chunks from the stream (until its end)
+        void loadChunks(StateNumType max_state_num, std::unordered_set<std::size_t> &allocs);
+        
         // the number of random write operations performed while flushing updates
         std::uint64_t m_rand_ops = 0;
         
@@ -6,6 +6,8 @@
 #include <dbzero/core/exception/Exceptions.hpp>
 #include <dbzero/core/compiler_attributes.hpp>
 #include <dbzero/core/memory/config.hpp>
+#include <dbzero/core/serialization/Fixed.hpp>
+#include <algorithm>
 
 namespace db0
 
@@ -22,6 +24,22 @@ DB0_PACKED_BEGIN
     };
 DB0_PACKED_END    
     
+DB0_PACKED_BEGIN
+    // Compressed full data page stored as a variable-length block (in place of o_diff_buffer)
+    // NOTE: m_size must be the first member (blocks are skipped by size regardless of their type)
+    struct DB0_PACKED_ATTR o_compressed_page: public o_fixed<o_compressed_page>
+    {
+        // size of the entire block (including this header)
+        std::uint16_t m_size = 0;
+        // PageCodecType
+        std::uint8_t m_codec = 0;
+        
+        const std::byte *data() const {
+            return reinterpret_cast<const std::byte *>(this) + sizeof(o_compressed_page);
+        }
+    };
+DB0_PACKED_END
+    
     class DiffWriter
     {
     public:
@@ -34,6 +52,16 @@ DB0_PACKED_END
         bool append(const std::byte *dp_data, std::pair<std::uint64_t, std::uint32_t> page_and_state,
             const std::vector<std::uint16_t> &diff_data, bool &overflow);
         
+        // Append a generic block (see append)
+        // @param header_size the part of the block which must fit onto the current page
+        // @param write function to serialize the block at a specific location
+        template <typename WriteF>
+        bool appendBlock(std::pair<std::uint64_t, std::uint32_t> page_and_state, std::size_t header_size,
+            std::size_t size, WriteF &&write, bool &overflow);
+        
+        // Check if a block of a specific size can be appended without flushing
+        bool canFit(std::pair<std::uint64_t, std::uint32_t> page_and_state, std::size_t size) const;
+        
         // Flush all buffered contents
         // @return the number of bytes written
         std::size_t flush();
@@ -45,6 +73,9 @@ DB0_PACKED_END
 
         // Revert the last append operation
         void revert();
+        
+        // Check if a block of a specific page / state has already been appended to the current page
+        bool contains(std::pair<std::uint64_t, std::uint32_t> page_and_state) const;
 
         // check if a full-page worth of data has been written
         bool isFull() const;
@@ -60,24 +91,29 @@ DB0_PACKED_END
         // current page's header
         o_diff_header &m_header;
         std::uint32_t m_last_size = 0;
+        // page / state of the blocks appended to the current page
+        std::vector<std::pair<std::uint64_t, std::uint32_t> > m_page_keys;
     };
 
     class DiffReader
     {
     public:
         // buffer is 2 pages long
-        DiffReader(Page_IO &, std::uint64_t page_num, std::byte *begin, std::byte *end);
+        // @param page_data optional, already fetched contents of the page_num
+        DiffReader(const Diff_IO &, std::uint64_t page_num, std::byte *begin, std::byte *end,
+            const std::byte *page_data = nullptr);
         
         // appy diffs from a specific page / state number into a provided data buffer
         // if underflow occurs then next page needs to be fetched and apply repeated
+        // @param compressed flag indicating that a compressed full page (rather than diffs) is expected
         bool apply(std::byte *dp_data, std::pair<std::uint64_t, std::uint32_t> page_and_state, 
-            bool &underflow);
+            bool &underflow, bool compressed = false);
 
         // Load continued data from the next page
         void loadNext();
     
     private:
-        Page_IO &m_page_io;
+        const Diff_IO &m_diff_io;
         const std::uint32_t m_page_size;
         const std::uint64_t m_page_num;
         std::byte * const m_begin;
@@ -100,25 +136,43 @@ DB0_PACKED_END
     
     bool DiffWriter::append(const std::byte *dp_data, std::pair<std::uint64_t, std::uint32_t> page_and_state,
         const std::vector<std::uint16_t> &diff_data, bool &overflow)
+    {
+        return appendBlock(page_and_state, o_diff_buffer::sizeOfHeader(), o_diff_buffer::measure(dp_data, diff_data),
+            [&](std::byte *at) {
+                return o_diff_buffer::__new(at, dp_data, diff_data).sizeOf();
+            }, overflow
+        );
+    }
+    
+    template <typename WriteF>
+    bool DiffWriter::appendBlock(std::pair<std::uint64_t, std::uint32_t> page_and_state, std::size_t header_size,
+        std::size_t size, WriteF &&write, bool &overflow)
     {
         using PairT = o_packed_int_pair<std::uint64_t, std::uint32_t>;
-        assert(m_current + o_diff_buffer::measure(dp_data, diff_data) + PairT::measure(page_and_state) <= m_end);
+        assert(m_current + size + PairT::measure(page_and_state) <= m_end);
         auto begin = m_current;
         PairT::write(m_current, page_and_state);
-        if (m_current + o_diff_buffer::sizeOfHeader() > m_begin + m_page_size) {
+        if (m_current + header_size > m_begin + m_page_size) {
             // unable to fit headers onto current page, revert
             m_current = begin;
             return false;
         }
-        auto &diff_buf = o_diff_buffer::__new(m_current, dp_data, diff_data);
-        m_current += diff_buf.sizeOf();
+        m_current += write(m_current);
         assert(m_current <= m_end);
         m_last_size = m_current - begin;
         ++m_header.m_size;
+        m_page_keys.push_back(page_and_state);
         // overflows a single DP
         overflow = m_current > (m_begin + m_page_size);
         return true;
     }
+    
+    bool DiffWriter::canFit(std::pair<std::uint64_t, std::uint32_t> page_and_state, std::size_t size) const
+    {
+        using PairT = o_packed_int_pair<std::uint64_t, std::uint32_t>;
+        // NOTE: the reader needs extra room for the continuation page's header
+        return m_current + PairT::measure(page_and_state) + size + o_diff_header::sizeOf() <= m_end;
+    }
 
     std::size_t DiffWriter::flush()
     {
@@ -137,6 +191,7 @@ DB0_PACKED_END
         
         m_page_io.append(m_begin);
         m_header.m_size = 0;
+        m_page_keys.clear();
         // handle overflowed contents if such exists
         if (m_current > (m_begin + m_page_size)) {
             // offset is equal number of overflowed bytes
@@ -156,7 +211,12 @@ DB0_PACKED_END
         assert(m_header.m_size > 0);
         assert(m_current - m_last_size >= m_begin);
         --m_header.m_size;
-        m_current -= m_last_size;        
+        m_current -= m_last_size;
+        m_page_keys.pop_back();
+    }
+    
+    bool DiffWriter::contains(std::pair<std::uint64_t, std::uint32_t> page_and_state) const {
+        return std::find(m_page_keys.begin(), m_page_keys.end(), page_and_state) != m_page_keys.end();
     }
 
     bool DiffWriter::isFull() const {
@@ -167,15 +227,20 @@ DB0_PACKED_END
         return m_header.m_size == 0 && m_header.m_offset == 0;
     }
     
-    DiffReader::DiffReader(Page_IO &page_io, std::uint64_t page_num, std::byte *begin, std::byte *end)
-        : m_page_io(page_io)
-        , m_page_size(page_io.getPageSize())
+    DiffReader::DiffReader(const Diff_IO &diff_io, std::uint64_t page_num, std::byte *begin, std::byte *end,
+        const std::byte *page_data)
+        : m_diff_io(diff_io)
+        , m_page_size(diff_io.getPageSize())
         , m_page_num(page_num)
         , m_begin(begin)
         , m_current(begin + m_page_size)
         , m_end(end)        
     {
-        page_io.read(page_num, m_begin + m_page_size);
+        if (page_data) {
+            std::memcpy(m_begin + m_page_size, page_data, m_page_size);
+        } else {
+            diff_io.readBuffered(page_num, m_begin + m_page_size);
+        }
         m_size = o_diff_header::__const_ref(m_current).m_size;
         // position at the first diff block
         m_current += o_diff_header::sizeOf() + o_diff_header::__const_ref(m_current).m_offset;
@@ -185,7 +250,7 @@ DB0_PACKED_END
     }
     
     bool DiffReader::apply(std::byte *dp_data, std::pair<std::uint64_t, std::uint32_t> page_and_state,
-        bool &underflow)
+        bool &underflow, bool compressed)
     {
         using PairT = o_packed_int_pair<std::uint64_t, std::uint32_t>;
         while (m_size > 0) {
@@ -202,10 +267,22 @@ DB0_PACKED_END
                     return false;
                 }
                 
-                auto &diff_buf = o_diff_buffer::__safe_const_ref(
-                    const_bounded_buf_t(Settings::m_decode_error, m_current, m_end)
-                );
-                diff_buf.apply(dp_data, dp_data + m_page_size);
+                if (compressed) {
+                    auto &block = o_compressed_page::__safe_const_ref(
+                        const_bounded_buf_t(Settings::m_decode_error, m_current, m_end)
+                    );
+                    if (block.m_size < block.sizeOf() || !getPageCodec(static_cast<PageCodecType>(block.m_codec)).decompress(
+                        block.data(), block.m_size - block.sizeOf(), dp_data, m_page_size))
+                    {
+                        THROWF(db0::IOException) << "Corrupt compressed page: " << page_and_state.first;
+                    }
+                    // NOTE: the writer never stores the same page / state twice in a single storage page
+                } else {
+                    auto &diff_buf = o_diff_buffer::__safe_const_ref(
+                        const_bounded_buf_t(Settings::m_decode_error, m_current, m_end)
+                    );
+                    diff_buf.apply(dp_data, dp_data + m_page_size);
+                }
                 m_current += diff_buf_size;
                 --m_size;
                 return true;
@@ -226,12 +303,29 @@ DB0_PACKED_END
         std::memcpy(m_begin + offset, m_current, size);
         m_current = m_begin + offset;
         // read the next page
-        m_page_io.read(m_page_num + 1, m_begin + m_page_size);
+        m_diff_io.readBuffered(m_page_num + 1, m_begin + m_page_size);
         // and merge neighboring parts of the diff block (note that header gets overwritten)
         std::memmove((void*)(m_current + o_diff_header::sizeOf()), m_current, size);
         m_current += o_diff_header::sizeOf();
     }
     
+    void applyDiffs(DiffReader &reader, void *buffer, std::pair<std::uint64_t, std::uint32_t> page_and_state,
+        bool compressed = false)
+    {
+        for (;;) {
+            bool underflow = false;
+            if (reader.apply((std::byte*)buffer, page_and_state, underflow, compressed)) {
+                return;
+            }
+            if (underflow) {
+                // repeat after fetching the next page
+                reader.loadNext();
+                continue;
+            }
+            THROWF(db0::InternalException) << (compressed ? "Compressed page not found" : "Diff block not found");
+        }
+    }
+    
     Diff_IO::Diff_IO(std::size_t header_size, CFile &file, std::uint32_t page_size, 
         std::uint32_t block_size, std::uint64_t address, std::uint32_t page_count, std::uint32_t step_size, 
         std::function<std::uint64_t()> tail_function, std::optional<std::uint32_t> block_num)
@@ -260,6 +354,54 @@ DB0_PACKED_END
     {
         // must lock because the write-buffer is shared
         std::unique_lock<std::mutex> lock(m_mx_write);
+        return appendBlock(page_and_state, is_first_page, [&](bool &overflow) {
+            return m_writer->append((const std::byte*)dp_data, page_and_state, diff_data, overflow);
+        });
+    }
+    
+    std::pair<std::uint64_t, bool> Diff_IO::appendCompressed(const void *dp_data,
+        std::pair<std::uint64_t, std::uint32_t> page_and_state, const PageCodec &codec, bool *is_first_page)
+    {
+        std::unique_lock<std::mutex> lock(m_mx_write);
+        assert(m_writer);
+        auto header_size = o_compressed_page::sizeOf();
+        if (m_compress_buf.size() < header_size + codec.compressBound(m_page_size)) {
+            m_compress_buf.resize(header_size + codec.compressBound(m_page_size));
+        }
+        auto &block = o_compressed_page::__new(m_compress_buf.data());
+        block.m_codec = static_cast<std::uint8_t>(codec.m_type);
+        // NOTE: pages which don't compress are stored as raw (uncompressed) blocks
+        auto size = codec.compress(dp_data, m_page_size, m_compress_buf.data() + header_size, m_page_size - 1);
+        if (!size) {
+            block.m_codec = static_cast<std::uint8_t>(PageCodecType::NONE);
+            size = getPageCodec(PageCodecType::NONE).compress(dp_data, m_page_size, m_compress_buf.data() + header_size,
+                m_compress_buf.size() - header_size);
+        }
+        assert(header_size + size <= std::numeric_limits<std::uint16_t>::max());
+        block.m_size = header_size + size;
+        // a page overwritten within the same transaction is moved to the next storage page
+        // so that the reader can stop at the first matching block
+        if (m_writer->contains(page_and_state)) {
+            m_diff_bytes_written += m_writer->flushDP();
+        }
+        // make sure the block can be written in its entirety (possibly overflowing onto the next page)
+        while (!m_writer->canFit(page_and_state, block.m_size)) {
+            m_diff_bytes_written += m_writer->flushDP();
+        }
+        auto result = appendBlock(page_and_state, is_first_page, [&](bool &overflow) {
+            return m_writer->appendBlock(page_and_state, header_size, block.m_size, [&](std::byte *at) {
+                std::memcpy(at, m_compress_buf.data(), block.m_size);
+                return block.m_size;
+            }, overflow);
+        });
+        m_compressed_bytes_written += block.m_size;
+        return result;
+    }
+    
+    template <typename AppendF>
+    std::pair<std::uint64_t, bool> Diff_IO::appendBlock(std::pair<std::uint64_t, std::uint32_t>, bool *is_first_page,
+        AppendF &&append)
+    {
         assert(m_writer);
         for (;;) {
             if (m_writer->isFull()) {
@@ -273,7 +415,7 @@ DB0_PACKED_END
                 // to report result as the is_first_page = true
                 *is_first_page &= m_writer->empty();
             }
-            if (m_writer->append((const std::byte*)dp_data, page_and_state, diff_data, overflow)) {
+            if (append(overflow)) {
                 if (overflow) {
                     // on overflow we can either append remnants to the next storage page (+1)
                     // if such is available or revert the append and try again with a fresh buffer
@@ -287,6 +429,8 @@ DB0_PACKED_END
                         continue;
                     }
                 }
+                // on overflow the first page got flushed, the remnants are buffered as the next one
+                m_pending_page_num = next_page_num.first + (overflow ? 1 : 0);
                 return { next_page_num.first, overflow };
             } else {
                 // continue with a fresh buffer                
@@ -301,18 +445,46 @@ DB0_PACKED_END
     {
         // must lock because the read-buffer is shared
         std::unique_lock<std::mutex> lock(m_mx_read);
-        DiffReader reader((Page_IO&)*this, page_num, m_read_buf.data(), m_read_buf.data() + m_read_buf.size());
-        for (;;) {
-            bool underflow = false;
-            if (reader.apply((std::byte*)buffer, page_and_state, underflow)) {
-                return;
-            }
-            if (underflow) {
-                // repeat after fetching the next page
-                reader.loadNext();
-                continue;
-            }
-            THROWF(db0::InternalException) << "Diff block not found";
+        DiffReader reader(*this, page_num, m_read_buf.data(), m_read_buf.data() + m_read_buf.size());
+        applyDiffs(reader, buffer, page_and_state);
+    }
+    
+    void Diff_IO::applyFrom(std::uint64_t page_num, const void *page_data, void *buffer,
+        std::pair<std::uint64_t, std::uint32_t> page_and_state, std::vector<std::byte> &work_buf) const
+    {
+        if (work_buf.size() < m_page_size * 2) {
+            work_buf.resize(m_page_size * 2);
+        }
+        DiffReader reader(*this, page_num, work_buf.data(), work_buf.data() + m_page_size * 2,
+            static_cast<const std::byte *>(page_data));
+        applyDiffs(reader, buffer, page_and_state);
+    }
+    
+    void Diff_IO::readCompressed(std::uint64_t page_num, const void *page_data, void *buffer,
+        std::pair<std::uint64_t, std::uint32_t> page_and_state, std::vector<std::byte> &work_buf) const
+    {
+        if (work_buf.size() < m_page_size * 2) {
+            work_buf.resize(m_page_size * 2);
+        }
+        DiffReader reader(*this, page_num, work_buf.data(), work_buf.data() + m_page_size * 2,
+            static_cast<const std::byte *>(page_data));
+        applyDiffs(reader, buffer, page_and_state, true);
+    }
+    
+    bool Diff_IO::tryReadPending(std::uint64_t page_num, void *buffer) const
+    {
+        std::unique_lock<std::mutex> lock(m_mx_write);
+        if (!m_writer || m_writer->empty() || page_num != m_pending_page_num) {
+            return false;
+        }
+        std::memcpy(buffer, m_write_buf.data(), m_page_size);
+        return true;
+    }
+    
+    void Diff_IO::readBuffered(std::uint64_t page_num, void *buffer) const
+    {
+        if (!tryReadPending(page_num, buffer)) {
+            Page_IO::read(page_num, buffer);
         }
     }
     
@@ -354,5 +526,9 @@ DB0_PACKED_END
     std::pair<std::size_t, std::size_t> Diff_IO::getStats() const {
         return { m_full_dp_bytes_written + m_diff_bytes_written, m_diff_bytes_written };
     }
+    
+    std::size_t Diff_IO::getCompressedBytes() const {
+        return m_compressed_bytes_written;
+    }
 
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 
 #include "Page_IO.hpp"
 #include "diff_buffer.hpp"
+#include "PageCodec.hpp"
 #include <memory>
 
 namespace db0
@@ -35,6 +36,25 @@ namespace db0
         std::pair<std::uint64_t, bool> appendDiff(const void *dp_data, std::pair<std::uint64_t, std::uint32_t> page_and_state,
             const std::vector<std::uint16_t> &diff_data, bool *is_first_page = nullptr);
         
+        // Appends a compressed full data page as a variable-length block (stored along with the diff-blocks)
+        // NOTE: pages which don't compress are stored as raw blocks
+        // @return page number + overflow flag (see appendDiff)
+        std::pair<std::uint64_t, bool> appendCompressed(const void *dp_data, std::pair<std::uint64_t, std::uint32_t> page_and_state,
+            const PageCodec &, bool *is_first_page = nullptr);
+        
+        // Decode a compressed full data page from an already fetched storage page
+        // NOTE: the continuation page (if needed) is read synchronously
+        void readCompressed(std::uint64_t page_num, const void *page_data, void *buffer,
+            std::pair<std::uint64_t, std::uint32_t> page_and_state, std::vector<std::byte> &work_buf) const;
+        
+        // Copy contents of a storage page which has not been flushed by the diff-writer yet
+        // (e.g. a compressed page written and then read within the same transaction)
+        // @return false if the page is not buffered
+        bool tryReadPending(std::uint64_t page_num, void *buffer) const;
+        
+        // Read a single storage page, either buffered or from the file
+        void readBuffered(std::uint64_t page_num, void *buffer) const;
+        
         // Read diff stream and apply changes to the DP-buffer (must be already populated with the base data)
         // @param page_num the storage page number to read from
         // @param buffer the buffer to hold the resulting data page
@@ -42,6 +62,13 @@ namespace db0
         // Exception raised if the diff block is not found
         void applyFrom(std::uint64_t page_num, void *buffer, std::pair<std::uint64_t, std::uint32_t> page_and_state) const;
         
+        // Apply diffs from an already fetched storage page (e.g. retrieved as a part of the read batch)
+        // NOTE: the continuation page (if needed) is read synchronously
+        // @param page_data contents of the storage page "page_num"
+        // @param work_buf the working buffer of at least 2 pages (no locking required since the buffer is not shared)
+        void applyFrom(std::uint64_t page_num, const void *page_data, void *buffer,
+            std::pair<std::uint64_t, std::uint32_t> page_and_state, std::vector<std::byte> &work_buf) const;
+        
         // Flush needs to be called before closing the stream
         // and after each transaction
         void flush();
@@ -55,6 +82,9 @@ namespace db0
         
         // @return total bytes written/ diff bytes written
         std::pair<std::size_t, std::size_t> getStats() const;
+        
+        // @return total size of the compressed page blocks written
+        std::size_t getCompressedBytes() const;
 
     protected:
         mutable std::mutex m_mx_write;
@@ -67,6 +97,14 @@ namespace db0
         std::size_t m_full_dp_bytes_written = 0;
         // total bytes written using the diff mechanism
         std::size_t m_diff_bytes_written = 0;
+        std::vector<std::byte> m_compress_buf;
+        std::size_t m_compressed_bytes_written = 0;
+        // storage page number of the diff-writer's buffered (not yet flushed) page
+        std::uint64_t m_pending_page_num = 0;
+        
+        template <typename AppendF>
+        std::pair<std::uint64_t, bool> appendBlock(std::pair<std::uint64_t, std::uint32_t> page_and_state,
+            bool *is_first_page, AppendF &&);
     };
     
 }
\ No newline at end of file
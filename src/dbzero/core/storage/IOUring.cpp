@@ -0,0 +1,298 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#include "IOUring.hpp"
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <cerrno>
+#include <algorithm>
+#include <dbzero/core/exception/Exceptions.hpp>
+#ifdef __linux__
+#  include <linux/io_uring.h>
+#  include <sys/syscall.h>
+#  include <sys/mman.h>
+#  include <sys/uio.h>
+#  include <unistd.h>
+#endif
+
+namespace db0
+
+{
+
+#ifdef __linux__
+    
+    struct IOUring::Ring
+    {
+        const pid_t m_pid;
+        int m_fd = -1;
+        unsigned int m_sq_entries = 0;
+        unsigned int m_cq_entries = 0;
+        void *m_sq_ptr = MAP_FAILED;
+        std::size_t m_sq_size = 0;
+        void *m_cq_ptr = MAP_FAILED;
+        std::size_t m_cq_size = 0;
+        void *m_sqes_ptr = MAP_FAILED;
+        std::size_t m_sqes_size = 0;
+        unsigned *m_sq_head = nullptr;
+        unsigned *m_sq_tail = nullptr;
+        unsigned *m_sq_mask = nullptr;
+        unsigned *m_sq_array = nullptr;
+        unsigned *m_cq_head = nullptr;
+        unsigned *m_cq_tail = nullptr;
+        unsigned *m_cq_mask = nullptr;
+        struct io_uring_sqe *m_sqes = nullptr;
+        struct io_uring_cqe *m_cqes = nullptr;
+        // the ring needs to be re-created after a failed submission
+        bool m_failed = false;
+        // max number of consecutive EAGAIN / EBUSY failures
+        static constexpr unsigned int MAX_RETRIES = 1000;
+        
+        Ring(unsigned int queue_depth)
+            : m_pid(getpid())
+        {
+            struct io_uring_params params;
+            std::memset(&params, 0, sizeof(params));
+            int fd = syscall(__NR_io_uring_setup, queue_depth, &params);
+            if (fd < 0) {
+                // io_uring not supported
+                return;
+            }
+            
+            m_sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+            m_cq_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+            bool single_mmap = false;
+#ifdef IORING_FEAT_SINGLE_MMAP
+            single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+#endif
+            if (single_mmap) {
+                m_sq_size = m_cq_size = std::max(m_sq_size, m_cq_size);
+            }
+            m_sq_ptr = mmap(nullptr, m_sq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+            if (m_sq_ptr != MAP_FAILED) {
+                m_cq_ptr = single_mmap ? m_sq_ptr : mmap(nullptr, m_cq_size, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+            }
+            if (m_cq_ptr != MAP_FAILED) {
+                m_sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+                m_sqes_ptr = mmap(nullptr, m_sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                    fd, IORING_OFF_SQES);
+            }
+            if (m_sqes_ptr == MAP_FAILED) {
+                release();
+                ::close(fd);
+                return;
+            }
+            
+            auto sq_ptr = static_cast<char *>(m_sq_ptr);
+            auto cq_ptr = static_cast<char *>(m_cq_ptr);
+            m_sq_entries = params.sq_entries;
+            m_cq_entries = params.cq_entries;
+            m_sq_head = reinterpret_cast<unsigned *>(sq_ptr + params.sq_off.head);
+            m_sq_tail = reinterpret_cast<unsigned *>(sq_ptr + params.sq_off.tail);
+            m_sq_mask = reinterpret_cast<unsigned *>(sq_ptr + params.sq_off.ring_mask);
+            m_sq_array = reinterpret_cast<unsigned *>(sq_ptr + params.sq_off.array);
+            m_cq_head = reinterpret_cast<unsigned *>(cq_ptr + params.cq_off.head);
+            m_cq_tail = reinterpret_cast<unsigned *>(cq_ptr + params.cq_off.tail);
+            m_cq_mask = reinterpret_cast<unsigned *>(cq_ptr + params.cq_off.ring_mask);
+            m_cqes = reinterpret_cast<struct io_uring_cqe *>(cq_ptr + params.cq_off.cqes);
+            m_sqes = static_cast<struct io_uring_sqe *>(m_sqes_ptr);
+            m_fd = fd;
+        }
+        
+        ~Ring()
+        {
+            release();
+            if (m_fd >= 0) {
+                ::close(m_fd);
+            }
+        }
+        
+        void release()
+        {
+            if (m_sqes_ptr != MAP_FAILED) {
+                munmap(m_sqes_ptr, m_sqes_size);
+                m_sqes_ptr = MAP_FAILED;
+            }
+            if (m_cq_ptr != MAP_FAILED && m_cq_ptr != m_sq_ptr) {
+                munmap(m_cq_ptr, m_cq_size);
+            }
+            m_cq_ptr = MAP_FAILED;
+            if (m_sq_ptr != MAP_FAILED) {
+                munmap(m_sq_ptr, m_sq_size);
+                m_sq_ptr = MAP_FAILED;
+            }
+        }
+        
+        // Remove the submitted entries not yet consumed by the kernel
+        // @return the number of entries removed
+        std::size_t rollback()
+        {
+            auto head = __atomic_load_n(m_sq_head, __ATOMIC_ACQUIRE);
+            auto unconsumed = *m_sq_tail - head;
+            __atomic_store_n(m_sq_tail, head, __ATOMIC_RELEASE);
+            return unconsumed;
+        }
+        
+        // Wait for & discard the completions of all requests in flight
+        void drain(std::size_t in_flight)
+        {
+            while (in_flight > 0) {
+                unsigned head = *m_cq_head;
+                unsigned cq_tail = __atomic_load_n(m_cq_tail, __ATOMIC_ACQUIRE);
+                while (head != cq_tail && in_flight > 0) {
+                    ++head;
+                    --in_flight;
+                }
+                __atomic_store_n(m_cq_head, head, __ATOMIC_RELEASE);
+                if (in_flight > 0 && syscall(__NR_io_uring_enter, m_fd, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0) < 0
+                    && errno != EINTR && errno != EAGAIN && errno != EBUSY)
+                {
+                    // unable to wait for the completions
+                    break;
+                }
+            }
+        }
+        
+        void read(int fd, const std::vector<ReadGroup> &groups)
+        {
+            // NOTE: iovec arrays must remain valid until the corresponding request is completed
+            std::vector<std::vector<struct iovec> > iovs(groups.size());
+            for (std::size_t i = 0; i < groups.size(); ++i) {
+                for (auto &request: groups[i].m_requests) {
+                    iovs[i].push_back({ request.m_buffer, request.m_size });
+                }
+            }
+            
+            // short reads to be completed synchronously (index, bytes read)
+            std::vector<std::pair<std::size_t, std::size_t> > short_reads;
+            int error = 0;
+            unsigned int retries = 0;
+            std::size_t next = 0, in_flight = 0, completed = 0;
+            while (completed < groups.size()) {
+                // fill the submission queue
+                unsigned tail = *m_sq_tail;
+                while (next < groups.size() && in_flight < m_cq_entries
+                    && (tail - __atomic_load_n(m_sq_head, __ATOMIC_ACQUIRE)) < m_sq_entries)
+                {
+                    auto index = tail & *m_sq_mask;
+                    auto &sqe = m_sqes[index];
+                    std::memset(&sqe, 0, sizeof(sqe));
+                    sqe.opcode = IORING_OP_READV;
+                    sqe.fd = fd;
+                    sqe.off = groups[next].m_address;
+                    sqe.addr = reinterpret_cast<std::uint64_t>(iovs[next].data());
+                    sqe.len = iovs[next].size();
+                    sqe.user_data = next;
+                    m_sq_array[index] = index;
+                    ++tail;
+                    ++next;
+                    ++in_flight;
+                }
+                __atomic_store_n(m_sq_tail, tail, __ATOMIC_RELEASE);
+                
+                // submit all pending entries & wait for at least one completion
+                auto to_submit = tail - __atomic_load_n(m_sq_head, __ATOMIC_ACQUIRE);
+                if (syscall(__NR_io_uring_enter, m_fd, to_submit, 1, IORING_ENTER_GETEVENTS, nullptr, 0) < 0) {
+                    auto enter_error = errno;
+                    if (enter_error != EINTR && ((enter_error != EAGAIN && enter_error != EBUSY) || ++retries > MAX_RETRIES)) {
+                        // withdraw the entries not consumed by the kernel & wait for the ones in flight
+                        // so that no request refers to the iovecs (or buffers) after the exception is thrown
+                        drain(in_flight - rollback());
+                        m_failed = true;
+                        THROWF(db0::IOException) << "IOUring::read: io_uring_enter failed with " << strerror(enter_error);
+                    }
+                    // NOTE: on EAGAIN / EBUSY the completion queue needs to be reaped before retrying
+                } else {
+                    retries = 0;
+                }
+                
+                // reap completions
+                unsigned head = *m_cq_head;
+                unsigned cq_tail = __atomic_load_n(m_cq_tail, __ATOMIC_ACQUIRE);
+                while (head != cq_tail) {
+                    auto &cqe = m_cqes[head & *m_cq_mask];
+                    auto index = static_cast<std::size_t>(cqe.user_data);
+                    if (cqe.res < 0) {
+                        error = -cqe.res;
+                    } else if (static_cast<std::size_t>(cqe.res) < groups[index].m_size) {
+                        short_reads.emplace_back(index, cqe.res);
+                    }
+                    ++head;
+                    --in_flight;
+                    ++completed;
+                }
+                __atomic_store_n(m_cq_head, head, __ATOMIC_RELEASE);
+            }
+            
+            if (error) {
+                THROWF(db0::IOException) << "IOUring::read: read failed with " << strerror(error);
+            }
+            for (auto &short_read: short_reads) {
+                preadGroup(fd, groups[short_read.first], short_read.second);
+            }
+        }
+    };
+    
+    IOUring::IOUring(unsigned int queue_depth)
+        : m_ring(std::make_unique<Ring>(queue_depth))
+    {
+    }
+    
+    bool IOUring::operator!() const {
+        return m_ring->m_fd < 0;
+    }
+    
+    void IOUring::read(int fd, const std::vector<ReadGroup> &groups)
+    {
+        assert(m_ring->m_fd >= 0);
+        m_ring->read(fd, groups);
+    }
+    
+    IOUring *IOUring::tryGetThreadInstance()
+    {
+        static std::atomic<bool> not_supported = false;
+        if (not_supported) {
+            return nullptr;
+        }
+        thread_local std::unique_ptr<IOUring> instance;
+        // NOTE: the ring must not be shared with the parent process (after fork) or reused after a failure
+        if (!instance || instance->m_ring->m_pid != getpid() || instance->m_ring->m_failed) {
+            instance = std::make_unique<IOUring>();
+            if (!*instance) {
+                not_supported = true;
+                instance = nullptr;
+            }
+        }
+        return instance.get();
+    }
+    
+#else
+
+    struct IOUring::Ring
+    {
+    };
+    
+    IOUring::IOUring(unsigned int)
+    {
+    }
+    
+    bool IOUring::operator!() const {
+        return true;
+    }
+    
+    void IOUring::read(int, const std::vector<ReadGroup> &) {
+        THROWF(db0::IOException) << "IOUring::read: io_uring not supported on this platform";
+    }
+    
+    IOUring *IOUring::tryGetThreadInstance() {
+        return nullptr;
+    }
+    
+#endif
+    
+    IOUring::~IOUring()
+    {
+    }
+    
+}
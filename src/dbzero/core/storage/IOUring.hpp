@@ -0,0 +1,40 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <memory>
+#include "ReadRequest.hpp"
+
+namespace db0
+
+{
+    
+    // Minimal io_uring wrapper (raw syscalls, no liburing dependency) for batched file reads
+    // NOTE: only available on Linux (kernel >= 5.1), use tryGetThreadInstance to check availability
+    class IOUring
+    {
+    public:
+        static constexpr unsigned int DEFAULT_QUEUE_DEPTH = 64;
+        
+        IOUring(unsigned int queue_depth = DEFAULT_QUEUE_DEPTH);
+        ~IOUring();
+        
+        // Check if the ring has NOT been initialized (e.g. io_uring not supported by the kernel)
+        bool operator!() const;
+        
+        // Read all groups from a specific file descriptor, block until all completed
+        // throws IOException on any I/O error (only after all submitted requests are completed)
+        void read(int fd, const std::vector<ReadGroup> &);
+        
+        // Get the thread-local ring instance or nullptr if io_uring is not supported
+        static IOUring *tryGetThreadInstance();
+        
+    private:
+        struct Ring;
+        std::unique_ptr<Ring> m_ring;
+    };
+    
+}
@@ -0,0 +1,156 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#include "PageCodec.hpp"
+#include <cstring>
+#include <limits>
+#include <dbzero/core/exception/Exceptions.hpp>
+
+// codecs are optional build dependencies (see meson.build)
+#if defined(DB0_WITH_LZ4)
+    #include <lz4.h>
+#endif
+
+#if defined(DB0_WITH_ZSTD)
+    #include <zstd.h>
+#endif
+
+namespace db0
+
+{
+
+    namespace
+    {
+
+        std::size_t rawBound(std::size_t size) {
+            return size;
+        }
+
+        std::size_t rawCompress(const void *src, std::size_t size, void *dst, std::size_t capacity)
+        {
+            if (size > capacity) {
+                return 0;
+            }
+            std::memcpy(dst, src, size);
+            return size;
+        }
+
+        bool rawDecompress(const void *src, std::size_t size, void *dst, std::size_t dst_size)
+        {
+            if (size != dst_size) {
+                return false;
+            }
+            std::memcpy(dst, src, size);
+            return true;
+        }
+
+        const PageCodec raw_codec = { PageCodecType::NONE, rawBound, rawCompress, rawDecompress };
+
+#if defined(DB0_WITH_LZ4)
+        std::size_t lz4Bound(std::size_t size) {
+            return LZ4_compressBound(static_cast<int>(size));
+        }
+
+        std::size_t lz4Compress(const void *src, std::size_t size, void *dst, std::size_t capacity)
+        {
+            auto result = LZ4_compress_default(static_cast<const char *>(src), static_cast<char *>(dst),
+                static_cast<int>(size), static_cast<int>(std::min<std::size_t>(capacity, std::numeric_limits<int>::max())));
+            return result > 0 ? result : 0;
+        }
+
+        bool lz4Decompress(const void *src, std::size_t size, void *dst, std::size_t dst_size)
+        {
+            auto result = LZ4_decompress_safe(static_cast<const char *>(src), static_cast<char *>(dst),
+                static_cast<int>(size), static_cast<int>(dst_size));
+            return result >= 0 && static_cast<std::size_t>(result) == dst_size;
+        }
+
+        const PageCodec lz4_codec = { PageCodecType::LZ4, lz4Bound, lz4Compress, lz4Decompress };
+#endif
+
+#if defined(DB0_WITH_ZSTD)
+        // favor speed, pages are compressed one at a time on the commit path
+        static constexpr int ZSTD_LEVEL = 1;
+
+        std::size_t zstdBound(std::size_t size) {
+            return ZSTD_compressBound(size);
+        }
+
+        std::size_t zstdCompress(const void *src, std::size_t size, void *dst, std::size_t capacity)
+        {
+            auto result = ZSTD_compress(dst, capacity, src, size, ZSTD_LEVEL);
+            return ZSTD_isError(result) ? 0 : result;
+        }
+
+        bool zstdDecompress(const void *src, std::size_t size, void *dst, std::size_t dst_size)
+        {
+            auto result = ZSTD_decompress(dst, dst_size, src, size);
+            return !ZSTD_isError(result) && result == dst_size;
+        }
+
+        const PageCodec zstd_codec = { PageCodecType::ZSTD, zstdBound, zstdCompress, zstdDecompress };
+#endif
+
+        const PageCodec *findPageCodec(PageCodecType type)
+        {
+            switch (type) {
+                case PageCodecType::NONE:
+                    return &raw_codec;
+#if defined(DB0_WITH_LZ4)
+                case PageCodecType::LZ4:
+                    return &lz4_codec;
+#endif
+#if defined(DB0_WITH_ZSTD)
+                case PageCodecType::ZSTD:
+                    return &zstd_codec;
+#endif
+                default:
+                    return nullptr;
+            }
+        }
+
+    }
+
+    bool isSupported(PageCodecType type) {
+        return findPageCodec(type) != nullptr;
+    }
+
+    const PageCodec &getPageCodec(PageCodecType type)
+    {
+        auto result = findPageCodec(type);
+        if (!result) {
+            THROWF(db0::IOException) << "Page compression codec not available in this build: "
+                << getPageCodecName(type);
+        }
+        return *result;
+    }
+
+    PageCodecType getPageCodecType(StorageFlags flags)
+    {
+        if (flags[StorageOptions::COMPRESS_LZ4] && flags[StorageOptions::COMPRESS_ZSTD]) {
+            THROWF(db0::InputException) << "Only one page compression codec can be selected";
+        }
+        if (flags[StorageOptions::COMPRESS_LZ4]) {
+            return PageCodecType::LZ4;
+        }
+        if (flags[StorageOptions::COMPRESS_ZSTD]) {
+            return PageCodecType::ZSTD;
+        }
+        return PageCodecType::NONE;
+    }
+
+    const char *getPageCodecName(PageCodecType type)
+    {
+        switch (type) {
+            case PageCodecType::NONE:
+                return "none";
+            case PageCodecType::LZ4:
+                return "lz4";
+            case PageCodecType::ZSTD:
+                return "zstd";
+            default:
+                return "unknown";
+        }
+    }
+
+}
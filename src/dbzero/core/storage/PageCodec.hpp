@@ -0,0 +1,46 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include "StorageFlags.hpp"
+
+namespace db0
+
+{
+
+    // NOTE: values are persisted in the prefix configuration, do not change
+    enum class PageCodecType: std::uint8_t
+    {
+        // uncompressed (raw) data pages
+        NONE = 0,
+        LZ4 = 1,
+        ZSTD = 2
+    };
+
+    // Block compression codec for full data pages
+    struct PageCodec
+    {
+        PageCodecType m_type;
+        // @return the maximum compressed size for the given input size
+        std::size_t (*compressBound)(std::size_t size);
+        // @return the compressed size or 0 if unable to compress into the provided capacity
+        std::size_t (*compress)(const void *src, std::size_t size, void *dst, std::size_t capacity);
+        // @return false if the input is corrupt or does not decompress to exactly dst_size bytes
+        bool (*decompress)(const void *src, std::size_t size, void *dst, std::size_t dst_size);
+    };
+
+    // Check if a specific codec was compiled in
+    bool isSupported(PageCodecType);
+
+    // Retrieve a specific codec (must be supported)
+    const PageCodec &getPageCodec(PageCodecType);
+
+    // Retrieve the codec requested with the storage flags (NONE if not requested)
+    PageCodecType getPageCodecType(StorageFlags);
+
+    const char *getPageCodecName(PageCodecType);
+
+}
@@ -111,6 +111,16 @@ namespace db0
         m_file.read(m_header_size + page_num * m_page_size, page_count * m_page_size, buffer);
     }
 
+    void Page_IO::readBatch(const std::vector<std::pair<std::uint64_t, void *> > &pages) const
+    {
+        std::vector<ReadRequest> requests;
+        requests.reserve(pages.size());
+        for (auto &page: pages) {
+            requests.push_back({ m_header_size + page.first * m_page_size, m_page_size, page.second });
+        }
+        m_file.readBatch(requests);
+    }
+
     void Page_IO::write(std::uint64_t page_num, void *buffer) {
         m_file.write(m_header_size + page_num * m_page_size, m_page_size, buffer);
     }
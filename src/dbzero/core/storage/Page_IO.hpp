@@ -52,6 +52,10 @@ namespace db0
         // Read multiple consecutive pages
         void read(std::uint64_t page_num, void *buffer, std::uint32_t page_count) const;
         
+        // Read multiple (not necessarily consecutive) pages as a single batch
+        // @param pages pairs of: storage page number / destination buffer
+        void readBatch(const std::vector<std::pair<std::uint64_t, void *> > &pages) const;
+        
         /**
          * Overwrite existing page
         */
@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#include "ReadRequest.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <dbzero/core/exception/Exceptions.hpp>
+#ifndef _WIN32
+#  include <unistd.h>
+#  include <sys/uio.h>
+#endif
+
+namespace db0
+
+{
+    
+    std::vector<ReadGroup> groupReadRequests(std::vector<ReadRequest> requests, unsigned int max_group_size)
+    {
+        std::sort(requests.begin(), requests.end(), [](const ReadRequest &lhs, const ReadRequest &rhs) {
+            return lhs.m_address < rhs.m_address;
+        });
+        
+        std::vector<ReadGroup> result;
+        for (auto &request: requests) {
+            if (result.empty() || result.back().m_address + result.back().m_size != request.m_address
+                || result.back().m_requests.size() >= max_group_size)
+            {
+                result.emplace_back();
+                result.back().m_address = request.m_address;
+            }
+            result.back().m_size += request.m_size;
+            result.back().m_requests.push_back(request);
+        }
+        return result;
+    }
+    
+    void preadGroup(int fd, const ReadGroup &group, std::size_t offset)
+    {
+#ifdef _WIN32
+        THROWF(db0::IOException) << "Positional I/O not supported on this platform";
+#else
+        std::vector<struct iovec> iov;
+        iov.reserve(group.m_requests.size());
+        // file address to start reading from
+        auto address = group.m_address + offset;
+        for (auto &request: group.m_requests) {
+            if (offset >= request.m_size) {
+                offset -= request.m_size;
+                continue;
+            }
+            iov.push_back({ static_cast<char *>(request.m_buffer) + offset, request.m_size - offset });
+            offset = 0;
+        }
+        
+        auto it = iov.begin();
+        while (it != iov.end()) {
+            auto result = ::preadv(fd, &*it, static_cast<int>(iov.end() - it), address);
+            if (result < 0 && errno == EINTR) {
+                continue;
+            }
+            if (result <= 0) {
+                THROWF(db0::IOException) << "preadGroup: preadv failed";
+            }
+            address += result;
+            // skip fully read buffers
+            std::size_t bytes = result;
+            while (it != iov.end() && bytes >= it->iov_len) {
+                bytes -= it->iov_len;
+                ++it;
+            }
+            if (it != iov.end() && bytes > 0) {
+                it->iov_base = static_cast<char *>(it->iov_base) + bytes;
+                it->iov_len -= bytes;
+            }
+        }
+#endif
+    }
+    
+}
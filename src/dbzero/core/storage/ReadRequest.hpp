@@ -0,0 +1,38 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace db0
+
+{
+
+    // A single file read operation, a part of the read batch
+    struct ReadRequest
+    {
+        std::uint64_t m_address;
+        std::size_t m_size;
+        void *m_buffer;
+    };
+    
+    // A sequence of read requests covering a contiguous file range
+    struct ReadGroup
+    {
+        std::uint64_t m_address = 0;
+        std::size_t m_size = 0;
+        std::vector<ReadRequest> m_requests;
+    };
+    
+    // Sort requests by address and merge the adjacent ones into contiguous groups
+    // @param max_group_size the maximum number of requests in a single group
+    std::vector<ReadGroup> groupReadRequests(std::vector<ReadRequest> requests, unsigned int max_group_size = 64);
+    
+    // Synchronously read the group's contents (or its part) with positional I/O
+    // @param offset the number of bytes (from the group's beginning) to skip
+    void preadGroup(int fd, const ReadGroup &, std::size_t offset = 0);
+    
+}
@@ -71,6 +71,10 @@ namespace db0
             insert(ItemT(std::forward<Args>(args)...));
         }
         
+        // Insert a new item or replace the existing one (i.e. with the same page & state numbers)
+        // @param overflow flag indicating that the item occupies 2 consecutive storage pages
+        void replace(const ItemT &item, bool overflow = false);
+        
         /**
          * Note that 'lookup' may fail in presence of duplicate items, the behavior is undefined
          * @return false item if not found
@@ -265,6 +269,25 @@ DB0_PACKED_END
         this->update(item.m_page_num, item.m_state_num, item.m_storage_page_num);
     }
     
+    template <typename ItemT, typename CompressedItemT>
+    void SparseIndexBase<ItemT, CompressedItemT>::replace(const ItemT &item, bool overflow)
+    {
+        ConstNodeIterator node;
+        auto item_ptr = lowerEqualBound(item.m_page_num, item.m_state_num, node);
+        if (item_ptr && node->header().getPageNum(*item_ptr) == item.m_page_num 
+            && item_ptr->getStateNum() == item.m_state_num) 
+        {
+            // NOTE: the key remains unchanged therefore the item can be updated in place
+            db0::modifyMember(node, *item_ptr) = node->header().compress(item);
+            this->update(item.m_page_num, item.m_state_num, item.m_storage_page_num);
+        } else {
+            insert(item);
+        }
+        if (overflow) {
+            this->update(item.m_storage_page_num + 1);
+        }
+    }
+    
     template <typename ItemT, typename CompressedItemT>
     typename SparseIndexBase<ItemT, CompressedItemT>::IndexT
     SparseIndexBase<ItemT, CompressedItemT>::openIndex(Address address, AccessType access_type, StorageFlags flags)
@@ -13,6 +13,17 @@ namespace db0
     {
         // Prevents loading any data into memory (e.g. when opening for copying)
         NO_LOAD = 0x0001,
+        // Use positional (pread / pwrite) file I/O which allows concurrent reads
+        POSITIONAL_IO = 0x0002,
+        // Finalize commits (fsync) on a background flusher thread, see BaseStorage::waitDurable
+        PIPELINED_COMMIT = 0x0004,
+        // Compress full data pages of a newly created prefix (LZ4 or Zstd), see PageCodec
+        COMPRESS_LZ4 = 0x0008,
+        COMPRESS_ZSTD = 0x0010,
+        // Record created / modified / deleted objects of each transaction, see ObjectChangeLog
+        CHANGE_LOG = 0x0020,
+        // Prefetch pages ahead of sequential scans on a background thread, see ReadAhead
+        READ_AHEAD = 0x0040,
     };
     
     using StorageFlags = FlagSet<StorageOptions>;
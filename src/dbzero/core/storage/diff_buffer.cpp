@@ -3,6 +3,7 @@
 
 #include "diff_buffer.hpp"
 #include <dbzero/core/serialization/packed_int.hpp>
+#include <dbzero/core/memory/diff_kernels.hpp>
 #include <cstring>
 #include <cassert>
 #include <limits>
@@ -65,7 +66,7 @@ namespace db0
                 if (dp_result + diff_size > dp_end) {
                     THROWF(db0::IOException) << "o_diff_buffer::apply: corrupt diff data";
                 }
-                std::memcpy(dp_result, at, diff_size);
+                diffCopy(dp_result, at, diff_size);
                 dp_result += diff_size;
                 at += diff_size;
             }
@@ -2,11 +2,29 @@
 // Copyright (c) 2025 DBZero Software sp. z o.o.
 
 #include "SafeRMutex.hpp"
+#include <cassert>
+#include <unordered_map>
 
 namespace db0
 
 {
     
+    namespace
+    {
+        
+        // the shared hold count of the current thread by mutex
+        int &getSharedCount(const SafeRMutex *mutex)
+        {
+            thread_local std::unordered_map<const SafeRMutex*, int> shared_counts;
+            return shared_counts[mutex];
+        }
+        
+    }
+    
+    bool SafeRMutex::isSharedByThisThread() const {
+        return getSharedCount(this) > 0;
+    }
+    
     void SafeRMutex::lock()
     {
         std::thread::id this_id = std::this_thread::get_id();        
@@ -16,20 +34,119 @@ namespace db0
             return;
         }
         
-        m_mutex.lock();        
+        std::unique_lock<std::mutex> lock(m_mutex);
+        // NOTE: the shared hold of this thread is suspended (otherwise two upgrading threads would deadlock)
+        bool upgrade = getSharedCount(this) > 0;
+        if (upgrade) {
+            --m_readers;
+        }
+        ++m_writers_waiting;
+        m_cv.wait(lock, [&]() {
+            return m_owner.load(std::memory_order_relaxed) == std::thread::id() && !m_readers;
+        });
+        --m_writers_waiting;
         m_owner.store(this_id, std::memory_order_relaxed);
         m_recursion_count = 1;
+        m_upgraded = upgrade;
     }
     
+    bool SafeRMutex::try_lock()
+    {
+        std::thread::id this_id = std::this_thread::get_id();
+        if (m_owner.load(std::memory_order_relaxed) == this_id) {
+            ++m_recursion_count;
+            return true;
+        }
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        bool upgrade = getSharedCount(this) > 0;
+        if (m_owner.load(std::memory_order_relaxed) != std::thread::id() || m_readers != (upgrade ? 1u : 0u)) {
+            return false;
+        }
+        if (upgrade) {
+            --m_readers;
+        }
+        m_owner.store(this_id, std::memory_order_relaxed);
+        m_recursion_count = 1;
+        m_upgraded = upgrade;
+        return true;
+    }
+
     void SafeRMutex::unlock()
     {        
         --m_recursion_count;
 
         if (m_recursion_count == 0) {
-            // Clear ownership BEFORE unlocking to avoid race conditions with future lockers
-            m_owner.store(std::thread::id(), std::memory_order_relaxed);
-            m_mutex.unlock();
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                // Clear ownership BEFORE unlocking to avoid race conditions with future lockers
+                m_owner.store(std::thread::id(), std::memory_order_relaxed);
+                // restore the suspended shared hold (without waiting)
+                if (m_upgraded) {
+                    ++m_readers;
+                    m_upgraded = false;
+                }
+            }
+            m_cv.notify_all();
         }
     }
-
-}
\ No newline at end of file
+    
+    void SafeRMutex::lock_shared()
+    {
+        assert(!isOwnedByThisThread());
+        auto &count = getSharedCount(this);
+        if (count) {
+            ++count;
+            return;
+        }
+        
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [&]() {
+            return m_owner.load(std::memory_order_relaxed) == std::thread::id() && !m_writers_waiting;
+        });
+        ++m_readers;
+        count = 1;
+    }
+    
+    bool SafeRMutex::try_lock_shared()
+    {
+        assert(!isOwnedByThisThread());
+        auto &count = getSharedCount(this);
+        if (count) {
+            ++count;
+            return true;
+        }
+        
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_owner.load(std::memory_order_relaxed) != std::thread::id() || m_writers_waiting) {
+            return false;
+        }
+        ++m_readers;
+        count = 1;
+        return true;
+    }
+    
+    void SafeRMutex::unlock_shared()
+    {
+        auto &count = getSharedCount(this);
+        assert(count > 0);
+        if (--count) {
+            return;
+        }
+        
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            if (isOwnedByThisThread() && m_upgraded) {
+                // the suspended hold is dropped
+                m_upgraded = false;
+                return;
+            }
+            --m_readers;
+            if (m_readers) {
+                return;
+            }
+        }
+        m_cv.notify_all();
+    }
+    
+}
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <mutex>
+#include <condition_variable>
 #include <atomic>
 #include <thread>
 #include <iostream>
@@ -14,19 +15,38 @@ namespace db0
     
     // Safe recursive mutex with thread tracking
     // allowing additional checks (e.g. for proper integration with Python GIL)
+    // The mutex can also be locked in shared (reader) mode, waiting exclusive lockers take precedence over new readers
+    // NOTE: a thread holding the shared lock may lock exclusively (upgrade), its shared hold is then suspended 
+    // until the exclusive lock is released (i.e. other threads may modify the state in between)
     class SafeRMutex
     {
         std::mutex m_mutex;
+        std::condition_variable m_cv;
         std::atomic<std::thread::id> m_owner =  {};
         int m_recursion_count = 0;
+        // number of threads holding the shared lock
+        unsigned int m_readers = 0;
+        unsigned int m_writers_waiting = 0;
+        // the owner's shared hold suspended for the exclusive lock's duration
+        bool m_upgraded = false;
     
     public:
         bool isOwnedByThisThread() const {
             return m_owner.load(std::memory_order_relaxed) == std::this_thread::get_id();
         }
 
+        bool isSharedByThisThread() const;
+
         void lock();
+        // @return false if the mutex is owned (or shared) by another thread
+        bool try_lock();
         void unlock();
+
+        // NOTE: shared locks are recursive, must not be requested by the exclusive owner
+        void lock_shared();
+        // @return false if the mutex is owned by another thread or an exclusive locker is waiting
+        bool try_lock_shared();
+        void unlock_shared();
     };
     
     class SafeRLock
@@ -46,6 +66,19 @@ namespace db0
         {            
             m_mutex_ptr->lock();
         }
+
+        struct tag_try_lock {};
+        // Non-blocking variant, check with owns_lock
+        SafeRLock(tag_try_lock, SafeRMutex &mutex)
+        {
+            if (mutex.try_lock()) {
+                m_mutex_ptr = &mutex;
+            }
+        }
+
+        bool owns_lock() const {
+            return m_mutex_ptr != nullptr;
+        }
         
         ~SafeRLock() {
             unlock();
@@ -74,4 +107,64 @@ namespace db0
         SafeRMutex *m_mutex_ptr = nullptr;
     };
 
+    // Shared (reader) lock of the SafeRMutex
+    class SafeRSharedLock
+    {
+    public:
+        SafeRSharedLock() = default;
+        SafeRSharedLock(const SafeRSharedLock &) = delete;
+
+        SafeRSharedLock(SafeRSharedLock &&other) noexcept
+            : m_mutex_ptr(other.m_mutex_ptr)
+        {
+            other.m_mutex_ptr = nullptr;
+        }
+
+        SafeRSharedLock(SafeRMutex &mutex)
+            : m_mutex_ptr(&mutex)
+        {
+            m_mutex_ptr->lock_shared();
+        }
+
+        struct tag_try_lock {};
+        // Non-blocking variant, check with owns_lock
+        SafeRSharedLock(tag_try_lock, SafeRMutex &mutex)
+        {
+            if (mutex.try_lock_shared()) {
+                m_mutex_ptr = &mutex;
+            }
+        }
+
+        bool owns_lock() const {
+            return m_mutex_ptr != nullptr;
+        }
+
+        ~SafeRSharedLock() {
+            unlock();
+        }
+
+        void unlock()
+        {
+            if (m_mutex_ptr) {
+                m_mutex_ptr->unlock_shared();
+                m_mutex_ptr = nullptr;
+            }
+        }
+
+        SafeRSharedLock &operator=(const SafeRSharedLock &) = delete;
+
+        SafeRSharedLock &operator=(SafeRSharedLock &&other) noexcept
+        {
+            if (this != &other) {
+                unlock();
+                m_mutex_ptr = other.m_mutex_ptr;
+                other.m_mutex_ptr = nullptr;
+            }
+            return *this;
+        }
+
+    private:
+        SafeRMutex *m_mutex_ptr = nullptr;
+    };
+
 }
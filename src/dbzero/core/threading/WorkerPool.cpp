@@ -0,0 +1,153 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#include "WorkerPool.hpp"
+#include <atomic>
+#include <algorithm>
+
+namespace db0
+
+{
+    
+    struct WorkerPool::Job
+    {
+        std::function<void(std::size_t)> m_task;
+        const std::size_t m_count;
+        std::atomic<std::size_t> m_next = 0;
+        std::size_t m_done = 0;
+        std::exception_ptr m_error;
+        std::mutex m_mutex;
+        std::condition_variable m_cv;
+        
+        Job(std::function<void(std::size_t)> task, std::size_t count)
+            : m_task(task)
+            , m_count(count)
+        {
+        }
+        
+        bool exhausted() const {
+            return m_next.load() >= m_count;
+        }
+        
+        // Execute pending tasks until none left
+        void work()
+        {
+            for (;;) {
+                auto index = m_next.fetch_add(1);
+                if (index >= m_count) {
+                    return;
+                }
+                std::exception_ptr error;
+                try {
+                    m_task(index);
+                } catch (...) {
+                    error = std::current_exception();
+                }
+                std::unique_lock<std::mutex> lock(m_mutex);
+                if (error && !m_error) {
+                    m_error = error;
+                }
+                if (++m_done == m_count) {
+                    m_cv.notify_all();
+                }
+            }
+        }
+        
+        void wait()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [this]() { return m_done == m_count; });
+        }
+    };
+    
+    WorkerPool::WorkerPool(unsigned int size)
+    {
+        for (unsigned int i = 0; i < size; ++i) {
+            m_threads.emplace_back([this]() {
+                this->workerLoop();
+            });
+        }
+    }
+    
+    WorkerPool::~WorkerPool()
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_stopped = true;
+        }
+        m_cv.notify_all();
+        for (auto &thread: m_threads) {
+            thread.join();
+        }
+    }
+    
+    void WorkerPool::workerLoop()
+    {
+        for (;;) {
+            std::shared_ptr<Job> job;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cv.wait(lock, [this]() { return m_stopped || !m_jobs.empty(); });
+                if (m_stopped) {
+                    return;
+                }
+                job = m_jobs.front();
+                if (job->exhausted()) {
+                    // all tasks already taken, remove from the queue
+                    m_jobs.pop_front();
+                    continue;
+                }
+            }
+            job->work();
+        }
+    }
+    
+    void WorkerPool::run(std::size_t task_count, std::function<void(std::size_t)> task)
+    {
+        if (task_count == 0) {
+            return;
+        }
+        if (task_count == 1 || m_threads.empty()) {
+            // execute inline
+            for (std::size_t i = 0; i < task_count; ++i) {
+                task(i);
+            }
+            return;
+        }
+        
+        auto job = std::make_shared<Job>(task, task_count);
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_jobs.push_back(job);
+        }
+        m_cv.notify_all();
+        // the calling thread participates in execution
+        job->work();
+        job->wait();
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            auto it = std::find(m_jobs.begin(), m_jobs.end(), job);
+            if (it != m_jobs.end()) {
+                m_jobs.erase(it);
+            }
+        }
+        if (job->m_error) {
+            std::rethrow_exception(job->m_error);
+        }
+    }
+    
+    WorkerPool &WorkerPool::getIOPool()
+    {
+        // NOTE: I/O-bound tasks benefit from more threads than available cores
+        static WorkerPool io_pool(std::max(4u, std::thread::hardware_concurrency()));
+        return io_pool;
+    }
+    
+    WorkerPool &WorkerPool::getCPUPool()
+    {
+        // NOTE: the calling thread is counted in since it participates in the execution
+        static WorkerPool cpu_pool(std::max(1u, std::thread::hardware_concurrency()) - 1);
+        return cpu_pool;
+    }
+    
+}
@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#pragma once
+
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <functional>
+
+namespace db0
+
+{
+    
+    // A fixed-size pool of worker threads executing indexed "parallel-for" jobs
+    // NOTE: the calling thread also participates in the job execution, therefore
+    // a pool of size 0 is valid (all tasks are executed inline)
+    class WorkerPool
+    {
+    public:
+        WorkerPool(unsigned int size);
+        ~WorkerPool();
+        
+        // Execute tasks [0, task_count) possibly in parallel and wait until all of them complete
+        // NOTE: the first exception thrown by any of the tasks is re-thrown in the calling thread
+        void run(std::size_t task_count, std::function<void(std::size_t)> task);
+        
+        unsigned int size() const {
+            return m_threads.size();
+        }
+        
+        // The shared pool dedicated for blocking I/O operations
+        static WorkerPool &getIOPool();
+        
+        // The shared pool for CPU-bound tasks (sized to the number of cores)
+        static WorkerPool &getCPUPool();
+        
+    private:
+        struct Job;
+        std::mutex m_mutex;
+        std::condition_variable m_cv;
+        std::deque<std::shared_ptr<Job> > m_jobs;
+        bool m_stopped = false;
+        std::vector<std::thread> m_threads;
+        
+        void workerLoop();
+    };
+    
+}
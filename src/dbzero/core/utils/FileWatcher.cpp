@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#include "FileWatcher.hpp"
+#include <cstdint>
+#include <cstddef>
+#ifdef __linux__
+#  include <sys/inotify.h>
+#  include <sys/eventfd.h>
+#  include <sys/vfs.h>
+#  include <poll.h>
+#  include <unistd.h>
+#endif
+
+namespace db0
+
+{
+
+#ifdef __linux__
+
+    // Modifications by remote hosts are not reported by inotify on network file systems
+    static bool isNetworkFS(const std::string &file_name)
+    {
+        struct statfs info;
+        if (::statfs(file_name.c_str(), &info) != 0) {
+            return true;
+        }
+        switch (static_cast<std::uint32_t>(info.f_type)) {
+            case 0x6969:        // NFS
+            case 0x517B:        // SMB
+            case 0xFF534D42:    // CIFS
+            case 0xFE534D42:    // SMB2
+            case 0x65735546:    // FUSE
+            case 0x00C36400:    // CEPH
+            case 0x5346414F:    // AFS
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    FileWatcher::FileWatcher()
+        : m_fd(inotify_init1(IN_NONBLOCK | IN_CLOEXEC))
+    {
+        if (m_fd < 0) {
+            return;
+        }
+        m_wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (m_wake_fd < 0) {
+            ::close(m_fd);
+            m_fd = -1;
+        }
+    }
+
+    FileWatcher::~FileWatcher()
+    {
+        if (m_fd >= 0) {
+            ::close(m_fd);
+            ::close(m_wake_fd);
+        }
+    }
+
+    int FileWatcher::add(const std::string &file_name)
+    {
+        if (m_fd < 0 || isNetworkFS(file_name)) {
+            return -1;
+        }
+        // NOTE: the same watch id is returned when the file is already being watched
+        return inotify_add_watch(m_fd, file_name.c_str(), IN_MODIFY);
+    }
+
+    void FileWatcher::remove(int watch_id)
+    {
+        if (m_fd >= 0 && watch_id >= 0) {
+            inotify_rm_watch(m_fd, watch_id);
+        }
+    }
+
+    bool FileWatcher::wait(std::chrono::milliseconds timeout, std::vector<int> &watch_ids)
+    {
+        if (m_fd < 0) {
+            return false;
+        }
+        struct pollfd fds[2] = { { m_fd, POLLIN, 0 }, { m_wake_fd, POLLIN, 0 } };
+        if (::poll(fds, 2, static_cast<int>(timeout.count())) <= 0) {
+            return false;
+        }
+        if (fds[1].revents & POLLIN) {
+            std::uint64_t value;
+            [[maybe_unused]] auto result = ::read(m_wake_fd, &value, sizeof(value));
+        }
+        if (fds[0].revents & POLLIN) {
+            // drain all pending events (consecutive writes are reported as a burst)
+            alignas(struct inotify_event) char buffer[4096];
+            for (;;) {
+                auto size = ::read(m_fd, buffer, sizeof(buffer));
+                if (size <= 0) {
+                    break;
+                }
+                for (auto ptr = buffer; ptr < buffer + size; ) {
+                    auto event = reinterpret_cast<const struct inotify_event *>(ptr);
+                    watch_ids.push_back(event->wd);
+                    ptr += sizeof(struct inotify_event) + event->len;
+                }
+            }
+        }
+        return true;
+    }
+
+    void FileWatcher::wakeUp()
+    {
+        if (m_wake_fd >= 0) {
+            std::uint64_t value = 1;
+            [[maybe_unused]] auto result = ::write(m_wake_fd, &value, sizeof(value));
+        }
+    }
+
+#else
+
+    FileWatcher::FileWatcher()
+    {
+    }
+
+    FileWatcher::~FileWatcher()
+    {
+    }
+
+    int FileWatcher::add(const std::string &) {
+        return -1;
+    }
+
+    void FileWatcher::remove(int) {
+    }
+
+    bool FileWatcher::wait(std::chrono::milliseconds, std::vector<int> &) {
+        return false;
+    }
+
+    void FileWatcher::wakeUp() {
+    }
+
+#endif
+
+    bool FileWatcher::operator!() const {
+        return m_fd < 0;
+    }
+
+}
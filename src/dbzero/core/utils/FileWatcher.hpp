@@ -0,0 +1,48 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <chrono>
+
+namespace db0
+
+{
+
+    // Minimal inotify wrapper to receive notifications on file modifications (e.g. by other processes)
+    // NOTE: only available on Linux, use operator! to check availability
+    class FileWatcher
+    {
+    public:
+        FileWatcher();
+        ~FileWatcher();
+
+        FileWatcher(const FileWatcher &) = delete;
+
+        // Check if the watcher has NOT been initialized (e.g. inotify not supported)
+        bool operator!() const;
+
+        // Start watching the file for modifications
+        // @return the watch id or -1 if unable to watch the file (e.g. located on a network file system)
+        int add(const std::string &file_name);
+
+        void remove(int watch_id);
+
+        /**
+         * Block until any of the watched files is modified, the timeout elapses or wakeUp gets called
+         * @param watch_ids receives ids of the modified files (possibly with duplicates)
+         * @return false on timeout
+        */
+        bool wait(std::chrono::milliseconds timeout, std::vector<int> &watch_ids);
+
+        // Interrupt the pending (or the next) wait call
+        void wakeUp();
+
+    private:
+        int m_fd = -1;
+        int m_wake_fd = -1;
+    };
+
+}
@@ -0,0 +1,171 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#include "Tracer.hpp"
+#include <mutex>
+#include <chrono>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#ifdef __linux__
+#  include <unistd.h>
+#endif
+
+namespace db0
+
+{
+
+    std::atomic<bool> Tracer::m_enabled = false;
+
+    // registry of all trace buffers (including the ones of exited threads)
+    static std::mutex trace_registry_mutex;
+    static std::vector<std::shared_ptr<TraceBuffer> > trace_registry;
+    // buffers of exited threads, available for reuse (still collected until reused or cleared)
+    static std::vector<std::shared_ptr<TraceBuffer> > trace_free_list;
+    static std::uint32_t next_thread_id = 1;
+    // events started before this timestamp are considered cleared
+    static std::atomic<std::uint64_t> trace_cleared_ns = 0;
+
+    // Returns the thread's buffer to the free list on thread exit
+    struct ThreadBufferHolder
+    {
+        std::shared_ptr<TraceBuffer> m_buffer;
+
+        ~ThreadBufferHolder()
+        {
+            if (m_buffer) {
+                std::unique_lock<std::mutex> lock(trace_registry_mutex);
+                trace_free_list.push_back(std::move(m_buffer));
+            }
+        }
+    };
+
+    static TraceBuffer &getThreadBuffer()
+    {
+        // buffers are only allocated by threads which actually record events
+        thread_local ThreadBufferHolder holder;
+        if (!holder.m_buffer) {
+            std::unique_lock<std::mutex> lock(trace_registry_mutex);
+            if (!trace_free_list.empty()) {
+                holder.m_buffer = std::move(trace_free_list.back());
+                trace_free_list.pop_back();
+                holder.m_buffer->reset(next_thread_id++);
+            } else {
+                holder.m_buffer = std::make_shared<TraceBuffer>(next_thread_id++);
+                trace_registry.push_back(holder.m_buffer);
+            }
+        }
+        return *holder.m_buffer;
+    }
+
+    TraceBuffer::TraceBuffer(std::uint32_t thread_id)
+        : m_thread_id(thread_id)
+        , m_events(new TraceEvent[CAPACITY])
+    {
+    }
+
+    void TraceBuffer::reset(std::uint32_t thread_id)
+    {
+        m_thread_id = thread_id;
+        m_head.store(0, std::memory_order_release);
+    }
+
+    void TraceBuffer::collect(std::vector<TraceEvent> &result) const
+    {
+        auto head = m_head.load(std::memory_order_acquire);
+        auto begin = head > CAPACITY ? head - CAPACITY : 0;
+        auto offset = result.size();
+        for (auto i = begin; i < head; ++i) {
+            result.push_back(m_events[i % CAPACITY]);
+        }
+        // discard events which might have been overwritten by the owner thread while copying
+        // (including the one possibly being written to at the moment)
+        std::atomic_thread_fence(std::memory_order_acquire);
+        auto new_head = m_head.load(std::memory_order_relaxed) + 1;
+        if (new_head > begin + CAPACITY) {
+            auto count = std::min<std::uint64_t>(new_head - begin - CAPACITY, head - begin);
+            result.erase(result.begin() + offset, result.begin() + offset + count);
+        }
+    }
+
+    void Tracer::enable(bool enabled) {
+        m_enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    void Tracer::clear()
+    {
+        trace_cleared_ns.store(now(), std::memory_order_relaxed);
+        // release buffers of threads which no longer exist
+        std::unique_lock<std::mutex> lock(trace_registry_mutex);
+        for (auto &buffer: trace_free_list) {
+            trace_registry.erase(std::find(trace_registry.begin(), trace_registry.end(), buffer));
+        }
+        trace_free_list.clear();
+    }
+
+    std::uint64_t Tracer::now()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void Tracer::record(const char *name, std::uint64_t start_ns, std::uint64_t arg) {
+        getThreadBuffer().push({ name, start_ns, now() - start_ns, arg });
+    }
+
+    std::vector<std::pair<std::uint32_t, TraceEvent> > Tracer::collect()
+    {
+        std::vector<std::pair<std::uint32_t, TraceEvent> > result;
+        std::vector<TraceEvent> events;
+        auto cleared_ns = trace_cleared_ns.load(std::memory_order_relaxed);
+        std::unique_lock<std::mutex> lock(trace_registry_mutex);
+        for (auto &buffer: trace_registry) {
+            events.clear();
+            buffer->collect(events);
+            for (auto &event: events) {
+                if (event.m_start_ns >= cleared_ns) {
+                    result.emplace_back(buffer->getThreadId(), event);
+                }
+            }
+        }
+        lock.unlock();
+        std::stable_sort(result.begin(), result.end(), [](const auto &lhs, const auto &rhs) {
+            return lhs.second.m_start_ns < rhs.second.m_start_ns;
+        });
+        return result;
+    }
+
+    std::size_t Tracer::getBufferCount()
+    {
+        std::unique_lock<std::mutex> lock(trace_registry_mutex);
+        return trace_registry.size();
+    }
+
+    std::string Tracer::exportChromeTrace()
+    {
+#ifdef __linux__
+        auto pid = static_cast<long>(::getpid());
+#else
+        long pid = 0;
+#endif
+        std::stringstream str;
+        str << std::fixed << std::setprecision(3);
+        str << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+        bool is_first = true;
+        for (auto &[thread_id, event]: collect()) {
+            if (!is_first) {
+                str << ",";
+            }
+            is_first = false;
+            // NOTE: Chrome trace timestamps are in microseconds
+            str << "{\"name\":\"" << event.m_name << "\",\"cat\":\"dbzero\",\"ph\":\"X\""
+                << ",\"ts\":" << (event.m_start_ns / 1000.0)
+                << ",\"dur\":" << (event.m_duration_ns / 1000.0)
+                << ",\"pid\":" << pid << ",\"tid\":" << thread_id
+                << ",\"args\":{\"arg\":" << event.m_arg << "}}";
+        }
+        str << "]}";
+        return str.str();
+    }
+
+}
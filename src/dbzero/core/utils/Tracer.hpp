@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace db0
+
+{
+
+    // A single completed span (Chrome trace "complete" event)
+    struct TraceEvent
+    {
+        // NOTE: must be a string literal (or otherwise have static storage duration)
+        const char *m_name = nullptr;
+        std::uint64_t m_start_ns = 0;
+        std::uint64_t m_duration_ns = 0;
+        // optional event specific argument (e.g. size in bytes)
+        std::uint64_t m_arg = 0;
+    };
+
+    /**
+     * Fixed-capacity ring buffer of trace events, written to by a single (owner) thread only
+     * Readers take lock-free snapshots, events overwritten while being copied are discarded
+    */
+    class TraceBuffer
+    {
+    public:
+        static constexpr std::size_t CAPACITY = 4096;
+
+        TraceBuffer(std::uint32_t thread_id);
+
+        inline void push(const TraceEvent &event)
+        {
+            auto head = m_head.load(std::memory_order_relaxed);
+            m_events[head % CAPACITY] = event;
+            m_head.store(head + 1, std::memory_order_release);
+        }
+
+        // Append the most recent events (up to CAPACITY - 1 once the buffer wraps around) to the result
+        void collect(std::vector<TraceEvent> &) const;
+
+        std::uint32_t getThreadId() const {
+            return m_thread_id;
+        }
+
+        // Prepare the buffer of an exited thread for reuse by a new one (discards events)
+        void reset(std::uint32_t thread_id);
+
+    private:
+        std::uint32_t m_thread_id;
+        std::unique_ptr<TraceEvent[]> m_events;
+        std::atomic<std::uint64_t> m_head = 0;
+    };
+
+    /**
+     * Process-wide tracing switch and collector of the per-thread trace buffers
+     * When disabled, trace points cost a single relaxed atomic load
+    */
+    class Tracer
+    {
+    public:
+        static inline bool isEnabled() {
+            return m_enabled.load(std::memory_order_relaxed);
+        }
+
+        static void enable(bool);
+
+        // Discard all events recorded so far
+        static void clear();
+
+        // Monotonic clock in nanoseconds
+        static std::uint64_t now();
+
+        // Record a completed span in the calling thread's buffer
+        static void record(const char *name, std::uint64_t start_ns, std::uint64_t arg);
+
+        // Retrieve (thread id, event) pairs of all threads, ordered by start time
+        static std::vector<std::pair<std::uint32_t, TraceEvent> > collect();
+
+        // Export recorded events as Chrome trace / Perfetto JSON
+        static std::string exportChromeTrace();
+
+        // Number of allocated trace buffers (including idle ones of exited threads)
+        static std::size_t getBufferCount();
+
+    private:
+        static std::atomic<bool> m_enabled;
+    };
+
+    // RAII trace point, records the span from construction to destruction (if tracing is enabled)
+    class TraceScope
+    {
+    public:
+        inline TraceScope(const char *name, std::uint64_t arg = 0)
+            : m_name(Tracer::isEnabled() ? name : nullptr)
+            , m_start_ns(m_name ? Tracer::now() : 0)
+            , m_arg(arg)
+        {
+        }
+
+        inline ~TraceScope()
+        {
+            if (m_name) {
+                Tracer::record(m_name, m_start_ns, m_arg);
+            }
+        }
+
+        TraceScope(const TraceScope &) = delete;
+
+    private:
+        const char *m_name;
+        const std::uint64_t m_start_ns;
+        const std::uint64_t m_arg;
+    };
+
+}
+
+#define DB0_TRACE_CONCAT_(a, b) a##b
+#define DB0_TRACE_CONCAT(a, b) DB0_TRACE_CONCAT_(a, b)
+// Trace the enclosing scope, e.g. DB0_TRACE("BDevStorage::flush") or DB0_TRACE("BDevStorage::read", size)
+#define DB0_TRACE(...) db0::TraceScope DB0_TRACE_CONCAT(_db0_trace_scope_, __LINE__)(__VA_ARGS__)
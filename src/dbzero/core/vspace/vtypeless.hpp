@@ -133,6 +133,13 @@ namespace db0
         */
         bool isAttached() const;
 
+        /**
+         * Check if the instance has been modified (i.e. locked for write) since the last commit / detach
+        */
+        inline bool isModified() const {
+            return m_resource_flags.load() & db0::RESOURCE_AVAILABLE_FOR_WRITE;
+        }
+
         /**
          * Detach underlying resource lock (i.e. mark resource as not available in local memory)
         */
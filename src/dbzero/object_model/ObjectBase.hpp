@@ -6,6 +6,7 @@
 #include "has_fixture.hpp"
 #include <dbzero/workspace/Fixture.hpp>
 #include <dbzero/workspace/GC0.hpp>
+#include <dbzero/workspace/ObjectChangeLog.hpp>
 #include <dbzero/object_model/value/StorageClass.hpp>
 #include <dbzero/object_model/LangConfig.hpp>
 #include <dbzero/workspace/AtomicContext.hpp>
@@ -81,7 +82,13 @@ namespace db0
         {
             m_gc_registered = tryAddToGC0<T>(*fixture, this);
         }
-        
+
+        // Move existing stem (no garbage collection, e.g. for transient read-only access)
+        ObjectBase(tag_no_gc, tag_from_stem, db0::swine_ptr<Fixture> &fixture, BaseT &&stem)
+            : has_fixture<BaseT>(typename has_fixture<BaseT>::tag_from_stem(), fixture, std::move(stem))
+        {
+        }
+
         ~ObjectBase()
         {      
         }
@@ -220,6 +227,9 @@ namespace db0
             if constexpr (Unique) {
                auto instance_id = has_fixture<BaseT>::initUnique(fixture, std::forward<Args>(args)...);
                this->modify().m_header.m_instance_id = instance_id;
+               if (auto change_log_ptr = fixture->tryGetChangeLog()) {
+                   change_log_ptr->onCreated(getUniqueAddress(), _CLS);
+               }
             } else {
                has_fixture<BaseT>::init(fixture, std::forward<Args>(args)...);
             }
@@ -9,6 +9,7 @@
 #include <cstdlib>
 #include <memory>
 #endif
+#include <optional>
 
 #include <dbzero/core/serialization/string.hpp>
 #include <dbzero/core/collections/map/v_map.hpp>
@@ -62,6 +63,9 @@ namespace db0::object_model
 
         // Find existing unique instance by name
         template <typename T> const_iterator findUnique() const;
+
+        // Find address of the unique instance, which may not exist (e.g. optional resource)
+        template <typename T> std::optional<Address> tryFindUnique() const;
     };
 
     template <typename T> void ObjectCatalogue::addUnique(T &object)
@@ -83,5 +87,14 @@ namespace db0::object_model
         }
         return result;
     }
+    
+    template <typename T> std::optional<Address> ObjectCatalogue::tryFindUnique() const
+    {
+        auto result = this->find(get_type_name<T>());
+        if (result == this->end()) {
+            return std::nullopt;
+        }
+        return result->second();
+    }
 
 }
\ No newline at end of file
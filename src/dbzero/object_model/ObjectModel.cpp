@@ -4,11 +4,14 @@
 #include "ObjectModel.hpp"
 #include <dbzero/workspace/Fixture.hpp>
 #include <dbzero/workspace/Config.hpp>
+#include <dbzero/workspace/ObjectChangeLog.hpp>
+#include <dbzero/core/storage/BaseStorage.hpp>
 #include <dbzero/object_model/class/ClassFactory.hpp>
 #include <dbzero/object_model/object/Object.hpp>
 #include <dbzero/object_model/list/List.hpp>
 #include <dbzero/object_model/set/Set.hpp>
 #include <dbzero/object_model/set/WeakSet.hpp>
+#include <dbzero/object_model/array/Array.hpp>
 #include <dbzero/object_model/dict/Dict.hpp>
 #include <dbzero/object_model/tuple/Tuple.hpp>
 #include <dbzero/object_model/class/Class.hpp>
@@ -38,7 +41,7 @@ namespace db0::object_model
         return [](db0::swine_ptr<Fixture> &fixture, bool is_new, bool read_only, bool is_snapshot)
         {
             // static GC0 bindings initialization
-            GC0::registerTypes<Class, Object, List, Set, WeakSet, Dict, Tuple, Index, Enum, ByteArray>();
+            GC0::registerTypes<Class, Object, List, Set, WeakSet, Dict, Tuple, Index, Enum, ByteArray, Array>();
             auto &oc = fixture->getObjectCatalogue();
             if (is_new) {
                 assert(!is_snapshot);
@@ -91,6 +94,9 @@ namespace db0::object_model
                 oc.addUnique(class_factory);
                 oc.addUnique(enum_factory);
                 oc.addUnique(gc0);
+                if (fixture->getPrefix().getStorage().getFlags()[StorageOptions::CHANGE_LOG]) {
+                    oc.addUnique(fixture->createChangeLog(fixture));
+                }
             } else {
                 // initialize GC0
                 // FIXME: optimization possible - we can skip creating GC0 after implementing LangCacheView::detach
@@ -138,6 +144,14 @@ namespace db0::object_model
                     tag_index.flush();
                 });
                 if (fixture->getAccessType() == db0::AccessType::READ_WRITE) {
+                    // NOTE: the change log is created on first open with the change log enabled
+                    // and maintained from then on (regardless of the flag)
+                    auto change_log_addr = oc.tryFindUnique<db0::ObjectChangeLog>();
+                    if (change_log_addr) {
+                        fixture->createChangeLog(fixture, *change_log_addr);
+                    } else if (fixture->getPrefix().getStorage().getFlags()[StorageOptions::CHANGE_LOG]) {
+                        oc.addUnique(fixture->createChangeLog(fixture));
+                    }
                     // execute GC0::collect when opening an existing fixture as read-write
                     fixture->getGC0().collect();
                 }
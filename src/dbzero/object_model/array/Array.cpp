@@ -0,0 +1,236 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#include "Array.hpp"
+#include <cstring>
+#include <dbzero/workspace/Fixture.hpp>
+#include <dbzero/core/exception/Exceptions.hpp>
+
+namespace db0::object_model
+
+{
+
+    GC0_Define(Array)
+
+    struct ArrayTypeInfo
+    {
+        ArrayType m_type;
+        std::size_t m_item_size;
+        const char *m_format;
+        const char *m_type_name;
+        const char *m_long_name;
+    };
+
+    static const ArrayTypeInfo array_type_info[] = {
+        { ArrayType::INVALID, 0, "", "", "" },
+        { ArrayType::INT8, 1, "b", "i1", "int8" },
+        { ArrayType::INT16, 2, "h", "i2", "int16" },
+        { ArrayType::INT32, 4, "i", "i4", "int32" },
+        { ArrayType::INT64, 8, "q", "i8", "int64" },
+        { ArrayType::UINT8, 1, "B", "u1", "uint8" },
+        { ArrayType::UINT16, 2, "H", "u2", "uint16" },
+        { ArrayType::UINT32, 4, "I", "u4", "uint32" },
+        { ArrayType::UINT64, 8, "Q", "u8", "uint64" },
+        { ArrayType::FLOAT32, 4, "f", "f4", "float32" },
+        { ArrayType::FLOAT64, 8, "d", "f8", "float64" }
+    };
+
+    static const ArrayTypeInfo &getInfo(ArrayType type)
+    {
+        auto index = static_cast<std::size_t>(type);
+        if (index == 0 || index >= sizeof(array_type_info) / sizeof(ArrayTypeInfo)) {
+            THROWF(db0::InputException) << "Invalid array type: " << (int)index << THROWF_END;
+        }
+        return array_type_info[index];
+    }
+
+    std::size_t getItemSize(ArrayType type) {
+        return getInfo(type).m_item_size;
+    }
+
+    const char *getFormat(ArrayType type) {
+        return getInfo(type).m_format;
+    }
+
+    const char *getTypeName(ArrayType type) {
+        return getInfo(type).m_type_name;
+    }
+
+    bool isFloatingPoint(ArrayType type) {
+        return type == ArrayType::FLOAT32 || type == ArrayType::FLOAT64;
+    }
+
+    bool isSigned(ArrayType type) {
+        return isFloatingPoint(type) || (type >= ArrayType::INT8 && type <= ArrayType::INT64);
+    }
+
+    ArrayType parseArrayType(const std::string &str)
+    {
+        // skip the native byte order / size prefix (e.g. "@d" or "=i")
+        auto name = (str.size() == 2 && (str[0] == '@' || str[0] == '=')) ? str.substr(1) : str;
+        for (const auto &info: array_type_info) {
+            if (info.m_type == ArrayType::INVALID) {
+                continue;
+            }
+            if (name == info.m_format || name == info.m_type_name || name == info.m_long_name) {
+                return info.m_type;
+            }
+        }
+        // platform-dependent aliases of the struct module
+        if (name == "l") {
+            return sizeof(long) == 8 ? ArrayType::INT64 : ArrayType::INT32;
+        }
+        if (name == "L") {
+            return sizeof(long) == 8 ? ArrayType::UINT64 : ArrayType::UINT32;
+        }
+        THROWF(db0::InputException) << "Unsupported array type: " << str << THROWF_END;
+    }
+
+    o_array::o_array(ArrayType type)
+        : m_type(type)
+    {
+    }
+
+    Array::Array(db0::swine_ptr<Fixture> &fixture, ArrayType type, AccessFlags access_mode)
+        : super_t(fixture, type, access_mode)
+        , m_data(*fixture, BVectorFlags{ BVectorOptions::FIXED_BLOCK })
+    {
+        // validate type
+        getInfo(type);
+        modify().m_data_ptr = m_data.getAddress();
+    }
+
+    Array::Array(tag_no_gc, db0::swine_ptr<Fixture> &fixture, const Array &other)
+        : super_t(tag_no_gc(), fixture, other.getType())
+        , m_data(*fixture, BVectorFlags{ BVectorOptions::FIXED_BLOCK })
+    {
+        modify().m_data_ptr = m_data.getAddress();
+        // copy contents block by block
+        for (std::size_t index = 0, count = other.size(); index < count; ) {
+            auto block = other.getBlock(index);
+            setItems(index, block.m_size, block.m_data);
+            index += block.m_size;
+        }
+    }
+
+    Array::Array(db0::swine_ptr<Fixture> &fixture, Address address, AccessFlags access_mode)
+        : super_t(super_t::tag_from_address(), fixture, address, access_mode)
+        , m_data(myPtr((*this)->m_data_ptr))
+    {
+    }
+
+    Array::~Array()
+    {
+        // unregister needs to be called before destruction of members
+        unregister();
+    }
+
+    void Array::operator=(Array &&other)
+    {
+        super_t::operator=(std::move(other));
+        m_data = std::move(other.m_data);
+        assert(!other.hasInstance());
+    }
+
+    ArrayType Array::getType() const {
+        return (*this)->m_type;
+    }
+
+    std::size_t Array::getItemSize() const {
+        return db0::object_model::getItemSize(getType());
+    }
+
+    std::size_t Array::size() const {
+        return m_data.size() / getItemSize();
+    }
+
+    void Array::getItems(std::size_t index, std::size_t count, void *buffer) const
+    {
+        if (index + count > size()) {
+            THROWF(db0::InputException) << "Index out of range: " << (index + count) << THROWF_END;
+        }
+        auto out = static_cast<std::byte*>(buffer);
+        while (count > 0) {
+            auto block = getBlock(index);
+            auto diff = std::min(count, block.m_size);
+            std::memcpy(out, block.m_data, diff * getItemSize());
+            out += diff * getItemSize();
+            index += diff;
+            count -= diff;
+        }
+    }
+
+    void Array::setItems(std::size_t index, std::size_t count, const void *buffer)
+    {
+        if (index > size()) {
+            THROWF(db0::InputException) << "Index out of range: " << index << THROWF_END;
+        }
+        auto item_size = getItemSize();
+        m_data.setItems(index * item_size, static_cast<const std::byte*>(buffer), count * item_size);
+    }
+
+    void Array::append(const void *buffer, std::size_t count) {
+        setItems(size(), count, buffer);
+    }
+
+    Array::Block Array::getBlock(std::size_t i) const
+    {
+        if (i >= size()) {
+            THROWF(db0::InputException) << "Index out of range: " << i << THROWF_END;
+        }
+        auto item_size = getItemSize();
+        auto [block, byte_count] = m_data.fetchBlockOf(i * item_size);
+        auto data = m_data.getItemPtr(*block, i * item_size);
+        return { block, data, byte_count / item_size };
+    }
+
+    void Array::clear() {
+        m_data.clear();
+    }
+
+    void Array::moveTo(db0::swine_ptr<Fixture> &fixture)
+    {
+        if (this->size() > 0) {
+            THROWF(db0::InputException) << "Array with items cannot be moved to another fixture";
+        }
+        assert(hasInstance());
+        super_t::moveTo(fixture);
+    }
+
+    void Array::commit() const
+    {
+        m_data.commit();
+        super_t::commit();
+    }
+
+    void Array::detach() const
+    {
+        m_data.detach();
+        super_t::detach();
+    }
+
+    void Array::destroy()
+    {
+        m_data.destroy();
+        super_t::destroy();
+    }
+
+    bool Array::operator==(const Array &other) const
+    {
+        if (getType() != other.getType() || size() != other.size()) {
+            return false;
+        }
+        auto item_size = getItemSize();
+        for (std::size_t index = 0, count = size(); index < count; ) {
+            auto block = getBlock(index);
+            auto other_block = other.getBlock(index);
+            auto diff = std::min(block.m_size, other_block.m_size);
+            if (std::memcmp(block.m_data, other_block.m_data, diff * item_size) != 0) {
+                return false;
+            }
+            index += diff;
+        }
+        return true;
+    }
+
+}
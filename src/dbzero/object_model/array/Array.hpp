@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <dbzero/core/serialization/FixedVersioned.hpp>
+#include <dbzero/core/collections/vector/v_bvector.hpp>
+#include <dbzero/object_model/value/StorageClass.hpp>
+#include <dbzero/object_model/ObjectBase.hpp>
+#include <dbzero/workspace/GC0.hpp>
+#include <dbzero/core/compiler_attributes.hpp>
+
+namespace db0 {
+
+    class Fixture;
+
+}
+
+namespace db0::object_model
+
+{
+
+    using Fixture = db0::Fixture;
+
+    // Element types of the homogeneous numeric array
+    enum class ArrayType: std::uint8_t
+    {
+        INVALID = 0,
+        INT8 = 1,
+        INT16 = 2,
+        INT32 = 3,
+        INT64 = 4,
+        UINT8 = 5,
+        UINT16 = 6,
+        UINT32 = 7,
+        UINT64 = 8,
+        FLOAT32 = 9,
+        FLOAT64 = 10
+    };
+
+    std::size_t getItemSize(ArrayType);
+    // struct module / buffer protocol format character (e.g. "d")
+    const char *getFormat(ArrayType);
+    // NumPy-style type name (e.g. "f8")
+    const char *getTypeName(ArrayType);
+    bool isFloatingPoint(ArrayType);
+    bool isSigned(ArrayType);
+    // Parse NumPy-style type name (e.g. "f8", "i4") or a struct format character (e.g. "d", "i")
+    ArrayType parseArrayType(const std::string &);
+
+DB0_PACKED_BEGIN
+    struct DB0_PACKED_ATTR o_array: public db0::o_fixed_versioned<o_array>
+    {
+        // common object header
+        o_unique_header m_header;
+        // raw (byte) contents
+        Address m_data_ptr = {};
+        ArrayType m_type = ArrayType::INVALID;
+        std::uint8_t m_reserved_8[7] = {0};
+        std::uint64_t m_reserved[2] = {0, 0};
+
+        o_array(ArrayType type);
+
+        bool hasRefs() const {
+            return m_header.hasRefs();
+        }
+    };
+DB0_PACKED_END
+
+    /**
+     * Persistent typed array of numbers (e.g. float64 or int32)
+     * Items are stored as raw bytes in a v_bvector of page-sized (FIXED_BLOCK) data blocks,
+     * since item sizes are powers of 2, items never span 2 blocks and each block is a contiguous range of items
+    */
+    class Array: public db0::ObjectBase<Array, db0::v_object<o_array>, StorageClass::DB0_ARRAY>
+    {
+        GC0_Declare
+    public:
+        using super_t = db0::ObjectBase<Array, db0::v_object<o_array>, StorageClass::DB0_ARRAY>;
+        friend super_t;
+        using DataBlock = typename db0::v_bvector<std::byte>::DataBlockType;
+
+        // A contiguous range of items, mapped for as long as the instance exists
+        struct Block
+        {
+            std::shared_ptr<const DataBlock> m_block;
+            const std::byte *m_data = nullptr;
+            // number of items
+            std::size_t m_size = 0;
+        };
+
+        // as null placeholder
+        Array() = default;
+
+        explicit Array(db0::swine_ptr<Fixture> &, ArrayType, AccessFlags = {});
+        explicit Array(tag_no_gc, db0::swine_ptr<Fixture> &, const Array &);
+        Array(db0::swine_ptr<Fixture> &, Address, AccessFlags = {});
+        ~Array();
+
+        void operator=(Array &&);
+
+        ArrayType getType() const;
+        std::size_t getItemSize() const;
+        // number of items
+        std::size_t size() const;
+
+        // Copy raw items into the buffer
+        void getItems(std::size_t index, std::size_t count, void *buffer) const;
+        // Overwrite raw items (the array is extended if necessary)
+        void setItems(std::size_t index, std::size_t count, const void *buffer);
+        void append(const void *buffer, std::size_t count);
+
+        // Retrieve the block containing the i-th item (zero-copy access)
+        Block getBlock(std::size_t i) const;
+
+        void clear();
+        void moveTo(db0::swine_ptr<Fixture> &);
+
+        void commit() const;
+        void detach() const;
+        void destroy();
+
+        bool operator==(const Array &) const;
+
+    private:
+        db0::v_bvector<std::byte> m_data;
+    };
+
+}
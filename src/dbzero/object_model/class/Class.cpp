@@ -135,7 +135,13 @@ namespace db0::object_model
     Class::~Class()
     {
         // unregister needs to be called before the destruction of members
-        unregister();        
+        unregister();
+        if (!LangToolkit::isValid()) {
+            // discard unreachable language objects
+            for (auto &item: m_field_cache) {
+                item.second.m_lang_key.steal();
+            }
+        }
     }
 
     std::unordered_set<std::string> Class::makeInitVars(const std::vector<std::string> &init_vars) const
@@ -209,6 +215,21 @@ namespace db0::object_model
         return it->second;
     }
     
+    std::pair<MemberID, bool> Class::findField(const char *name, ObjectPtr lang_key) const
+    {
+        // NOTE: refresh may update the index (and its version)
+        m_member_cache.fastRefresh();
+        auto &item = m_field_cache[lang_key];
+        if (!item.m_lang_key || item.m_version != m_index_version) {
+            item.m_field = findField(name);
+            item.m_version = m_index_version;
+            if (!item.m_lang_key) {
+                item.m_lang_key = ObjectSharedPtr(lang_key);
+            }
+        }
+        return item.m_field;
+    }
+    
     std::optional<Class::Member> Class::tryGetMember(FieldID field_id) const
     {
         // NOTE: cache might be refreshed if not found at first attempt
@@ -307,6 +328,7 @@ namespace db0::object_model
         return [this](const Member &member) {
             // this is required before accessing members to prevent segfaults on a defunct object
             auto fixture = getFixture();
+            ++m_index_version;
             auto it = m_index.find(member.m_name);
             if (it == m_index.end()) {
                 bool is_init_var = m_init_vars.find(member.m_name) != m_init_vars.end();
@@ -420,6 +442,7 @@ namespace db0::object_model
         auto &string_pool = getFixture()->getLimitedStringPool();
         // 2. Update in the in-memory index
         m_index.erase(from_name);
+        ++m_index_version;
         // unreference old name in the string pool
         for (auto &field_info: member_id) {
             auto loc = field_info.first.getIndexAndOffset();
@@ -559,6 +582,7 @@ namespace db0::object_model
     {
         assert(m_init_vars.empty());        
         std::copy(init_vars.begin(), init_vars.end(), std::inserter(m_init_vars, m_init_vars.end()));        
+        ++m_index_version;
         // update the field index
         for (auto &name: m_init_vars) {
             auto it = m_index.find(name);
@@ -140,6 +140,9 @@ DB0_PACKED_END
         
         // @return member ID / init var flag assigned on initialization flag (see Schema Extensions)
         std::pair<MemberID, bool> findField(const char *name) const;
+        // Find field with the result cached by the language specific name object
+        // @param lang_key must be an immutable (e.g. interned) string object matching the name
+        std::pair<MemberID, bool> findField(const char *name, ObjectPtr lang_key) const;
         
         // Get the total number of unique members declared in this class
         std::size_t size() const {            
@@ -303,6 +306,15 @@ DB0_PACKED_END
         };
         
         using MemberCacheT = LimitedMatrixCache<VFieldMatrix, Member, MemberAdapter>;
+        using ObjectSharedPtr = LangToolkit::ObjectSharedPtr;
+        
+        struct FieldCacheItem
+        {
+            // NOTE: the key object is retained to prevent its address from being reused
+            ObjectSharedPtr m_lang_key;
+            std::uint32_t m_version = 0;
+            std::pair<MemberID, bool> m_field;
+        };
         
         // member field definitions
         VFieldMatrix m_members;
@@ -320,6 +332,10 @@ DB0_PACKED_END
         std::unordered_set<std::string> m_init_vars;
         const std::uint32_t m_uid = 0;
         mutable MemberCacheT m_member_cache;
+        // findField results by the language specific name object (see m_index_version)
+        mutable std::unordered_map<ObjectPtr, FieldCacheItem> m_field_cache;
+        // incremented on each m_index / m_init_vars update to invalidate m_field_cache
+        mutable std::uint32_t m_index_version = 0;
         // runtime flags
         bool m_no_cache = false;
         
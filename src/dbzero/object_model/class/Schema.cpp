@@ -628,6 +628,7 @@ namespace db0::object_model
             case SchemaTypeId::ENUM: return "Enum";
             case SchemaTypeId::BOOLEAN: return "bool";
             case SchemaTypeId::WEAK_REF: return "WeakProxy";
+            case SchemaTypeId::ARRAY: return "Array";
             default:
                 return "!INVALID";
         }
@@ -51,6 +51,7 @@ DB0_PACKED_BEGIN
         ENUM = static_cast<int>(StorageClass::DB0_ENUM_VALUE),        
         BOOLEAN = static_cast<int>(StorageClass::BOOLEAN),        
         WEAK_REF = static_cast<int>(StorageClass::OBJECT_WEAK_REF),
+        ARRAY = static_cast<int>(StorageClass::DB0_ARRAY),
     };
     
     // NOTE: this version is only capable of handling full types (e.g. PACK_2 will raise an exception)
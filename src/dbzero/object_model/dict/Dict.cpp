@@ -135,8 +135,7 @@ namespace db0::object_model
             auto it_join = bindex.beginJoin(1);
             while (!it_join.is_end()) {
                 auto [storage_class, value] = (*it_join).m_first;
-                auto member = unloadMember<LangToolkit>(*fixture, storage_class, value, 0, member_flags);
-                if (LangToolkit::compare(key, member.get())) {
+                if (compareMember<LangToolkit>(*fixture, storage_class, value, key, member_flags)) {
                     bindex.erase(*it_join);
                     unrefMember<LangToolkit>(*fixture, storage_class, value);
                     --modify().m_size;
@@ -165,10 +164,7 @@ namespace db0::object_model
             auto it = bindex.beginJoin(1);
             while (!it.is_end()) {
                 auto [storage_class, value] = (*it).m_first;
-                auto member = unloadMember<LangToolkit>(
-                    fixture, storage_class, value, 0, this->getMemberFlags()
-                );
-                if (LangToolkit::compare(key_value, member.get())) {
+                if (compareMember<LangToolkit>(fixture, storage_class, value, key_value, this->getMemberFlags())) {
                     auto [storage_class, value] = (*it).m_second;
                     return unloadMember<LangToolkit>(
                         fixture, storage_class, value, 0, this->getMemberFlags()
@@ -190,8 +186,7 @@ namespace db0::object_model
             auto it = bindex.beginJoin(1);
             while (!it.is_end()) {
                 auto [storage_class, value] = (*it).m_first;
-                auto member = unloadMember<LangToolkit>(fixture, storage_class, value, 0, this->getMemberFlags());
-                if (LangToolkit::compare(key_value, member.get())) {
+                if (compareMember<LangToolkit>(fixture, storage_class, value, key_value, this->getMemberFlags())) {
                     // a matching key was found
                     return true;
                 }
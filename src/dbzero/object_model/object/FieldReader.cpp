@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#include "FieldReader.hpp"
+#include "Object.hpp"
+#include <dbzero/workspace/Fixture.hpp>
+#include <dbzero/object_model/class/Class.hpp>
+#include <dbzero/object_model/class/ClassFactory.hpp>
+
+namespace db0::object_model
+
+{
+
+    FieldReader::FieldReader(const std::vector<std::string> &field_names)
+        : m_field_names(field_names)
+    {
+    }
+
+    FieldReader::~FieldReader()
+    {
+    }
+
+    const FieldReader::ClassFields &FieldReader::getClassFields(Fixture &fixture, std::uint32_t class_ref)
+    {
+        auto it = m_class_fields.find(class_ref);
+        if (it == m_class_fields.end()) {
+            // NOTE: objects of different (e.g. derived) types may be read with the same reader
+            ClassFields class_fields;
+            class_fields.m_type = getClassFactory(fixture).getTypeByClassRef(class_ref).m_class;
+            for (auto &field_name: m_field_names) {
+                class_fields.m_fields.push_back(class_fields.m_type->findField(field_name.c_str()));
+            }
+            it = m_class_fields.emplace(class_ref, std::move(class_fields)).first;
+        }
+        return it->second;
+    }
+
+    bool FieldReader::read(db0::swine_ptr<Fixture> &fixture, Address address, std::vector<std::pair<StorageClass, Value> > &values)
+    {
+        assert(values.size() == m_field_names.size());
+        auto stem = Object::tryUnloadStem(fixture, address);
+        if (!stem) {
+            return false;
+        }
+        auto &class_fields = getClassFields(*fixture, stem->getClassRef());
+        // NOTE: transient instance, not registered with GC0
+        Object object(Object::tag_no_gc(), fixture, std::move(stem), class_fields.m_type);
+        for (unsigned int i = 0; i < values.size(); ++i) {
+            if (!object.tryGetRaw(class_fields.m_fields[i], values[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+}
@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+#include <dbzero/object_model/class/MemberID.hpp>
+#include <dbzero/object_model/value/StorageClass.hpp>
+#include <dbzero/object_model/value/Value.hpp>
+#include <dbzero/core/memory/Address.hpp>
+#include <dbzero/core/memory/swine_ptr.hpp>
+
+namespace db0
+
+{
+
+    class Fixture;
+
+}
+
+namespace db0::object_model
+
+{
+
+    class Class;
+
+    /**
+     * Reads raw values of the selected members directly from the object's value tables
+     * (i.e. without creating language objects), members are resolved once per type
+    */
+    class FieldReader
+    {
+    public:
+        // NOTE: a single reader must only be used with objects from the same fixture
+        FieldReader(const std::vector<std::string> &field_names);
+        ~FieldReader();
+
+        /**
+         * Read all selected members of the object
+         * @param values receives (storage class, value) for each of the members, in order
+         * @return false if not a regular memo object or any of the members does not exist
+        */
+        bool read(db0::swine_ptr<Fixture> &, Address, std::vector<std::pair<StorageClass, Value> > &values);
+
+    private:
+        // type and its resolved fields
+        struct ClassFields
+        {
+            std::shared_ptr<Class> m_type;
+            std::vector<std::pair<MemberID, bool> > m_fields;
+        };
+
+        std::vector<std::string> m_field_names;
+        std::unordered_map<std::uint32_t, ClassFields> m_class_fields;
+
+        const ClassFields &getClassFields(Fixture &, std::uint32_t class_ref);
+    };
+
+}
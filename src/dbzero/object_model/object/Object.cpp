@@ -125,7 +125,8 @@ namespace db0::object_model
         return false;
     }
 
-    void Object::set(FixtureLock &fixture, const char *field_name, TypeId type_id, ObjectPtr lang_value)
+    void Object::set(FixtureLock &fixture, const char *field_name, TypeId type_id, ObjectPtr lang_value,
+        ObjectPtr lang_key)
     {        
         assert(hasInstance());
         // attribute delete operation
@@ -144,7 +145,8 @@ namespace db0::object_model
         
         assert(m_type);
         // find already existing field index
-        auto [member_id, is_init_var] = m_type->findField(field_name);
+        auto [member_id, is_init_var] = lang_key ? m_type->findField(field_name, lang_key)
+            : m_type->findField(field_name);
         auto storage_fidelity = getStorageFidelity(storage_class);
         // get field ID matching the required storage fidelity
         FieldID field_id;
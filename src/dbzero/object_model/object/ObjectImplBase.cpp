@@ -75,6 +75,15 @@ namespace db0::object_model
         assert(hasValidClassRef());
     }
 
+    template <typename T, typename ImplT>
+    ObjectImplBase<T, ImplT>::ObjectImplBase(tag_no_gc, db0::swine_ptr<Fixture> &fixture, ObjectStem &&stem,
+        std::shared_ptr<Class> type)
+        : super_t(tag_no_gc(), typename super_t::tag_from_stem(), fixture, std::move(stem))
+    {
+        this->m_type = type;
+        assert(hasValidClassRef());
+    }
+    
     template <typename T, typename ImplT>
     ObjectImplBase<T, ImplT>::ObjectImplBase(db0::swine_ptr<Fixture> &fixture, Address address, std::shared_ptr<Class> type_hint,
         with_type_hint, AccessFlags access_mode, bool *type_hit_ptr)
@@ -421,7 +430,7 @@ namespace db0::object_model
     }
     
     template <typename T, typename ImplT>
-    std::pair<MemberID, bool> ObjectImplBase<T, ImplT>::findField(const char *name) const
+    std::pair<MemberID, bool> ObjectImplBase<T, ImplT>::findField(const char *name, ObjectPtr lang_key) const
     {
         if (this->isDropped()) {
             // defunct objects should not be accessed
@@ -436,15 +445,23 @@ namespace db0::object_model
         }
 
         assert(class_ptr);
-        return class_ptr->findField(name);
+        return lang_key ? class_ptr->findField(name, lang_key) : class_ptr->findField(name);
     }
     
     template <typename T, typename ImplT>
     FieldID ObjectImplBase<T, ImplT>::tryGetMember(const char *field_name, std::pair<StorageClass, Value> &member,
-        bool &is_init_var, bool *is_auto_generated) const
+        bool &is_init_var, bool *is_auto_generated, ObjectPtr lang_key) const
+    {
+        auto field = this->findField(field_name, lang_key);
+        is_init_var = field.second;
+        return tryGetMember(field, member, is_auto_generated);
+    }
+    
+    template <typename T, typename ImplT>
+    FieldID ObjectImplBase<T, ImplT>::tryGetMember(const std::pair<MemberID, bool> &field,
+        std::pair<StorageClass, Value> &member, bool *is_auto_generated) const
     {
-        MemberID member_id;
-        std::tie(member_id, is_init_var) = this->findField(field_name);
+        auto &[member_id, is_init_var] = field;
         bool exists, deleted = false;
         if (is_auto_generated) {
             *is_auto_generated = false;
@@ -480,6 +497,26 @@ namespace db0::object_model
         return {};        
     }
     
+    template <typename T, typename ImplT>
+    bool ObjectImplBase<T, ImplT>::tryGetRaw(const std::pair<MemberID, bool> &field,
+        std::pair<StorageClass, Value> &member) const
+    {
+        auto field_id = tryGetMember(field, member);
+        if (!field_id && !(field.second && member.first != StorageClass::DELETED)) {
+            return false;
+        }
+        if (member.first == StorageClass::PACK_2) {
+            auto val_code = lofi_store<2>::fromValue(member.second).get(field_id.maybeOffset());
+            if (val_code == Value::NONE) {
+                member = { StorageClass::NONE, Value() };
+            } else {
+                // NOTE: common constant encoding is shared with BOOLEAN
+                member = { StorageClass::BOOLEAN, Value(val_code) };
+            }
+        }
+        return true;
+    }
+    
     template <typename T, typename ImplT>
     std::optional<XValue> ObjectImplBase<T, ImplT>::tryGetX(const char *field_name) const
     {        
@@ -515,11 +552,11 @@ namespace db0::object_model
 
     template <typename T, typename ImplT>
     typename ObjectImplBase<T, ImplT>::ObjectSharedPtr 
-    ObjectImplBase<T, ImplT>::tryGet(const char *field_name, bool *is_auto_generated) const
+    ObjectImplBase<T, ImplT>::tryGet(const char *field_name, bool *is_auto_generated, ObjectPtr lang_key) const
     {
         std::pair<StorageClass, Value> member;
         bool is_init_var = false;
-        auto field_id = tryGetMember(field_name, member, is_init_var, is_auto_generated);
+        auto field_id = tryGetMember(field_name, member, is_init_var, is_auto_generated, lang_key);
         // NOTE: init vars are always reported as None if not explicitly set nor explicitly deleted
         if (field_id || (is_init_var && member.first != StorageClass::DELETED)) {
             auto fixture = this->getFixture();
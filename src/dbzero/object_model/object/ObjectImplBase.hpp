@@ -48,6 +48,7 @@ namespace db0::object_model
         using ObjectStem = ObjectVType<T>;
         using TypeInitializer = ObjectInitializer::TypeInitializer;
         using tag_as_dropped = typename super_t::tag_as_dropped;
+        using tag_no_gc = typename super_t::tag_no_gc;
         
         // Construct as null / dropped object
         ObjectImplBase(tag_as_dropped, UniqueAddress, unsigned int ext_refs);
@@ -75,6 +76,8 @@ namespace db0::object_model
         ObjectImplBase(db0::swine_ptr<Fixture> &, std::shared_ptr<Class>, std::pair<std::uint32_t, 
             std::uint32_t> ref_counts, const PosVT::Data &, unsigned int pos_vt_offset);
         ObjectImplBase(db0::swine_ptr<Fixture> &, ObjectStem &&, std::shared_ptr<Class>);
+        // Unload from stem with the exact type, without registering in GC0 (for transient read-only access)
+        ObjectImplBase(tag_no_gc, db0::swine_ptr<Fixture> &, ObjectStem &&, std::shared_ptr<Class>);
         
         ~ObjectImplBase();
         
@@ -96,7 +99,9 @@ namespace db0::object_model
         void setPreInit(const char *field_name, ObjectPtr lang_value) const;
         void removePreInit(const char *field_name) const;
         
-        ObjectSharedPtr tryGet(const char *field_name, bool *is_auto_generated = nullptr) const;
+        // @param lang_key optional immutable (e.g. interned) name object to speed up the field lookup
+        ObjectSharedPtr tryGet(const char *field_name, bool *is_auto_generated = nullptr,
+            ObjectPtr lang_key = nullptr) const;
         ObjectSharedPtr tryGetAs(const char *field_name, TypeObjectPtr) const;
         ObjectSharedPtr get(const char *field_name) const;
                 
@@ -127,7 +132,15 @@ namespace db0::object_model
         void commit() const;
         
         // FieldID, is_init_var, fidelity
-        std::pair<MemberID, bool> findField(const char *name) const;
+        std::pair<MemberID, bool> findField(const char *name, ObjectPtr lang_key = nullptr) const;
+        
+        /**
+         * Retrieve the member's value without unloading it (e.g. for native aggregations)
+         * NOTE: lo-fi members are decoded (as NONE or BOOLEAN)
+         * @param field the field as resolved by findField
+         * @return false if the member does not exist or was deleted
+        */
+        bool tryGetRaw(const std::pair<MemberID, bool> &field, std::pair<StorageClass, Value> &) const;
         
         // NOTE: hasRefs is NOT available in ObjectAnyBase bacause
         // of the use of num_type_tags property
@@ -157,7 +170,9 @@ namespace db0::object_model
         std::pair<bool, bool> tryGetMemberAt(std::pair<FieldID, unsigned int>, 
             std::pair<StorageClass, Value> &) const;
         FieldID tryGetMember(const char *field_name, std::pair<StorageClass, Value> &,
-            bool &is_init_var, bool *is_auto_generated = nullptr) const;
+            bool &is_init_var, bool *is_auto_generated = nullptr, ObjectPtr lang_key = nullptr) const;
+        FieldID tryGetMember(const std::pair<MemberID, bool> &field, std::pair<StorageClass, Value> &,
+            bool *is_auto_generated = nullptr) const;
         
         // Try resolving field ID of an existing (or deleted) member and also its storage location
         // @param pos the member's position in the containing collection
@@ -133,8 +133,7 @@ namespace db0::object_model
             m_index.insert(set_it);
             is_modified = true;
         } else {
-            auto item = getItem(key, lang_value);
-            if (item == nullptr) {                
+            if (!hasItem(key, lang_value)) {
                 ++modify().m_size;
                 auto [key, address] = *iter;
                 auto bindex = address.getIndex(*fixture);
@@ -169,8 +168,7 @@ namespace db0::object_model
         auto fixture = this->getFixture();        
         while (!it.is_end()) {
             auto [storage_class, value] = *it;
-            auto member = unloadMember<LangToolkit>(fixture, storage_class, value, 0, getMemberFlags());
-            if (LangToolkit::compare(key_value, member.get())) {
+            if (compareMember<LangToolkit>(fixture, storage_class, value, key_value, getMemberFlags())) {
                 if (bindex.size() == 1) {
                     m_index.erase(iter);
                     unrefMember<LangToolkit>(fixture, storage_class, value);
@@ -208,9 +206,8 @@ namespace db0::object_model
         auto it = bindex.beginJoin(1);        
         while (!it.is_end()) {
             auto [storage_class, value] = *it;
-            auto member = unloadMember<LangToolkit>(fixture, storage_class, value, 0, getMemberFlags());
-            if (LangToolkit::compare(key_value, member.get())) {
-                return member;
+            if (compareMember<LangToolkit>(fixture, storage_class, value, key_value, getMemberFlags())) {
+                return unloadMember<LangToolkit>(fixture, storage_class, value, 0, getMemberFlags());
             }
             ++it;
         }
@@ -267,8 +264,7 @@ namespace db0::object_model
         auto it = bindex.beginJoin(1);        
         while (!it.is_end()) {
             auto [storage_class, value] = *it;
-            auto member = unloadMember<LangToolkit>(fixture, storage_class, value, 0, getMemberFlags());
-            if (LangToolkit::compare(key_value, member.get())) {
+            if (compareMember<LangToolkit>(fixture, storage_class, value, key_value, getMemberFlags())) {
                 return true;
             }
             ++it;
@@ -0,0 +1,397 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#include "GroupBy.hpp"
+#include <dbzero/core/collections/full_text/FT_ANDIterator.hpp>
+#include <dbzero/core/collections/full_text/FT_ANDNOTIterator.hpp>
+#include <dbzero/core/serialization/string.hpp>
+#include <dbzero/core/vspace/v_object.hpp>
+#include <dbzero/core/utils/hash_combine.hpp>
+#include <dbzero/core/exception/Exceptions.hpp>
+#include <dbzero/workspace/Fixture.hpp>
+#include <dbzero/object_model/object/FieldReader.hpp>
+
+namespace db0::object_model
+
+{
+
+    // value types which can be used as group keys (compared by value)
+    static bool isGroupable(StorageClass storage_class)
+    {
+        switch (storage_class) {
+            case StorageClass::NONE:
+            case StorageClass::STRING_REF:
+            case StorageClass::INT64:
+            case StorageClass::PTIME64:
+            case StorageClass::FP_NUMERIC64:
+            case StorageClass::DATE:
+            case StorageClass::DATETIME:
+            case StorageClass::DATETIME_TZ:
+            case StorageClass::TIME:
+            case StorageClass::TIME_TZ:
+            case StorageClass::DECIMAL:
+            case StorageClass::OBJECT_REF:
+            case StorageClass::DB0_ENUM_VALUE:
+            case StorageClass::BOOLEAN:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    static bool isLess(bool lhs_is_real, std::int64_t lhs_int, double lhs_real,
+        bool rhs_is_real, std::int64_t rhs_int, double rhs_real)
+    {
+        if (!lhs_is_real && !rhs_is_real) {
+            return lhs_int < rhs_int;
+        }
+        return (lhs_is_real ? lhs_real : (double)lhs_int) < (rhs_is_real ? rhs_real : (double)rhs_int);
+    }
+
+    void AggregateState::add(AggregateOp op, bool is_real, std::int64_t int_value, double real_value)
+    {
+        switch (op) {
+            case AggregateOp::SUM:
+            case AggregateOp::AVG: {
+                if (is_real) {
+                    m_real += real_value;
+                    m_is_real = true;
+                } else {
+                    m_int += int_value;
+                }
+            }
+            break;
+
+            case AggregateOp::MIN:
+            case AggregateOp::MAX: {
+                bool assign = !m_count;
+                if (!assign) {
+                    assign = (op == AggregateOp::MIN) ?
+                        isLess(is_real, int_value, real_value, m_is_real, m_int, m_real) :
+                        isLess(m_is_real, m_int, m_real, is_real, int_value, real_value);
+                }
+                if (assign) {
+                    m_int = int_value;
+                    m_real = real_value;
+                    m_is_real = is_real;
+                }
+            }
+            break;
+
+            default:
+                break;
+        }
+        ++m_count;
+    }
+
+    void AggregateState::merge(AggregateOp op, const AggregateState &other)
+    {
+        if (!other.m_count) {
+            return;
+        }
+        if (op == AggregateOp::MIN || op == AggregateOp::MAX) {
+            auto count = m_count + other.m_count;
+            add(op, other.m_is_real, other.m_int, other.m_real);
+            m_count = count;
+            return;
+        }
+        m_int += other.m_int;
+        m_real += other.m_real;
+        m_is_real |= other.m_is_real;
+        m_count += other.m_count;
+    }
+
+    double AggregateState::getReal() const {
+        return (double)m_int + m_real;
+    }
+
+    std::size_t GroupKeyHash::operator()(const GroupKey &key) const
+    {
+        std::size_t result = key.size();
+        for (auto &item: key) {
+            db0::hash_combine(result, static_cast<std::uint8_t>(item.m_storage_class));
+            std::uint64_t value = item.m_value.m_store;
+            db0::hash_combine(result, value);
+        }
+        return result;
+    }
+
+    GroupBy::GroupBy(db0::swine_ptr<Fixture> &fixture, std::unique_ptr<QueryIterator> &&query)
+        : m_fixture(fixture)
+        , m_query(std::move(query))
+    {
+    }
+
+    GroupBy::~GroupBy()
+    {
+    }
+
+    void GroupBy::addTagGroups(std::vector<std::unique_ptr<QueryIterator> > &&tags)
+    {
+        Criteria criteria;
+        criteria.m_tags = std::move(tags);
+        m_criteria.push_back(std::move(criteria));
+    }
+
+    void GroupBy::addFieldGroup(const std::string &field_name)
+    {
+        Criteria criteria;
+        criteria.m_field = addField(field_name);
+        m_criteria.push_back(std::move(criteria));
+    }
+
+    void GroupBy::addOp(AggregateOp op, const std::string &field_name)
+    {
+        if (op != AggregateOp::COUNT && field_name.empty()) {
+            THROWF(db0::InputException) << "Aggregate op requires a field name" << THROWF_END;
+        }
+        m_ops.push_back(op);
+        m_op_fields.push_back(op == AggregateOp::COUNT ? -1 : addField(field_name));
+    }
+
+    bool GroupBy::isTagGroup(unsigned int index) const
+    {
+        assert(index < m_criteria.size());
+        return m_criteria[index].m_field < 0;
+    }
+
+    int GroupBy::addField(const std::string &field_name)
+    {
+        for (unsigned int i = 0; i < m_field_names.size(); ++i) {
+            if (m_field_names[i] == field_name) {
+                return i;
+            }
+        }
+        m_field_names.push_back(field_name);
+        return m_field_names.size() - 1;
+    }
+
+    bool GroupBy::isCountByTags() const
+    {
+        for (auto &criteria: m_criteria) {
+            if (criteria.m_field >= 0) {
+                return false;
+            }
+        }
+        for (auto op: m_ops) {
+            if (op != AggregateOp::COUNT) {
+                return false;
+            }
+        }
+        return !m_criteria.empty();
+    }
+
+    GroupState &GroupBy::getGroup(const GroupKey &key)
+    {
+        auto &result = m_groups[key];
+        if (result.m_states.empty()) {
+            result.m_states.resize(m_ops.size());
+        }
+        return result;
+    }
+
+    bool GroupBy::evaluate()
+    {
+        if (!m_query) {
+            // empty query
+            return true;
+        }
+        if (isCountByTags()) {
+            countByTags();
+            return true;
+        }
+        return scan();
+    }
+
+    void GroupBy::countByTags()
+    {
+        for (auto &criteria: m_criteria) {
+            if (criteria.m_tags.empty()) {
+                return;
+            }
+        }
+
+        // the group's count is the cardinality of the query & tags intersection
+        std::vector<unsigned int> ords(m_criteria.size(), 0);
+        for (;;) {
+            db0::FT_ANDIteratorFactory<UniqueAddress, true> factory;
+            factory.add(m_query->beginTyped(-1));
+            GroupKey key;
+            for (unsigned int i = 0; i < m_criteria.size(); ++i) {
+                auto &tag = m_criteria[i].m_tags[ords[i]];
+                factory.add(tag ? tag->beginTyped(-1) : nullptr);
+                key.push_back({ StorageClass::UNDEFINED, Value(ords[i]) });
+            }
+
+            auto it = factory.release(-1);
+            // exclude objects matching any of the preceding tags of each group (like the exclusive split_by)
+            std::vector<std::unique_ptr<QueryIterator> > not_iterators;
+            for (unsigned int i = 0; i < m_criteria.size() && it; ++i) {
+                for (unsigned int j = 0; j < ords[i]; ++j) {
+                    auto &tag = m_criteria[i].m_tags[j];
+                    if (tag) {
+                        if (not_iterators.empty()) {
+                            not_iterators.push_back(std::move(it));
+                        }
+                        not_iterators.push_back(tag->beginTyped(-1));
+                    }
+                }
+            }
+            if (!not_iterators.empty()) {
+                it = std::make_unique<FT_ANDNOTIterator<UniqueAddress> >(std::move(not_iterators), -1);
+            }
+            std::uint64_t count = 0;
+            UniqueAddress last_key;
+            while (it && !it->isEnd()) {
+                UniqueAddress addr;
+                it->next(&addr);
+                if (addr != last_key) {
+                    ++count;
+                    last_key = addr;
+                }
+            }
+            if (count) {
+                getGroup(key).m_count += count;
+            }
+
+            // next combination of tags
+            unsigned int i = 0;
+            while (i < ords.size() && ++ords[i] == m_criteria[i].m_tags.size()) {
+                ords[i] = 0;
+                ++i;
+            }
+            if (i == ords.size()) {
+                break;
+            }
+        }
+    }
+
+    bool GroupBy::readFields(FieldReader &reader, UniqueAddress addr, std::vector<std::pair<StorageClass, Value> > &values)
+    {
+        if (!reader.read(m_fixture, addr.getAddress(), values)) {
+            // e.g. not a regular memo object or a missing member
+            return false;
+        }
+        for (unsigned int i = 0; i < values.size(); ++i) {
+            if (values[i].first == StorageClass::STRING_REF) {
+                // equal strings may be stored under different addresses
+                db0::v_object<db0::o_string> string_ref(m_fixture->myPtr(values[i].second.asAddress()));
+                auto str_ptr = string_ref->get();
+                std::uint64_t addr_value = values[i].second.m_store;
+                auto result = m_strings.emplace(std::string(str_ptr.get_raw(), str_ptr.size()), addr_value);
+                values[i].second = Value(result.first->second);
+            }
+        }
+        return true;
+    }
+
+    bool GroupBy::scan()
+    {
+        // tag iterators to test membership with (following the query's direction)
+        std::vector<std::vector<std::unique_ptr<QueryIterator> > > tags(m_criteria.size());
+        for (unsigned int i = 0; i < m_criteria.size(); ++i) {
+            for (auto &tag: m_criteria[i].m_tags) {
+                tags[i].push_back(tag ? tag->beginTyped(-1) : nullptr);
+            }
+        }
+
+        struct NumericValue
+        {
+            bool m_exists = false;
+            bool m_is_real = false;
+            std::int64_t m_int = 0;
+            double m_real = 0;
+        };
+
+        std::vector<std::pair<StorageClass, Value> > values(m_field_names.size());
+        FieldReader reader(m_field_names);
+        std::vector<NumericValue> op_values(m_ops.size());
+        GroupKey key(m_criteria.size());
+        UniqueAddress last_key;
+        auto query = m_query->beginTyped(-1);
+        while (!query->isEnd()) {
+            UniqueAddress addr;
+            query->next(&addr);
+            if (addr == last_key) {
+                continue;
+            }
+            last_key = addr;
+
+            // find the first matching tag from each of the tag groups (same as the exclusive split_by)
+            bool is_match = true;
+            for (unsigned int i = 0; i < m_criteria.size() && is_match; ++i) {
+                if (m_criteria[i].m_field >= 0) {
+                    continue;
+                }
+                is_match = false;
+                for (unsigned int j = 0; j < tags[i].size(); ++j) {
+                    auto &tag = tags[i][j];
+                    if (!tag) {
+                        continue;
+                    }
+                    if (!tag->join(addr, -1)) {
+                        // no more matches possible
+                        tag = nullptr;
+                        continue;
+                    }
+                    if (tag->getKey() == addr) {
+                        key[i] = { StorageClass::UNDEFINED, Value(j) };
+                        is_match = true;
+                        break;
+                    }
+                }
+            }
+            if (!is_match) {
+                continue;
+            }
+
+            if (!values.empty() && !readFields(reader, addr, values)) {
+                return false;
+            }
+
+            for (unsigned int i = 0; i < m_criteria.size(); ++i) {
+                if (m_criteria[i].m_field >= 0) {
+                    auto &value = values[m_criteria[i].m_field];
+                    if (!isGroupable(value.first)) {
+                        return false;
+                    }
+                    key[i] = { value.first, value.second };
+                }
+            }
+
+            for (unsigned int i = 0; i < m_ops.size(); ++i) {
+                auto &op_value = op_values[i];
+                op_value.m_exists = false;
+                if (m_op_fields[i] < 0) {
+                    continue;
+                }
+                auto &value = values[m_op_fields[i]];
+                switch (value.first) {
+                    case StorageClass::INT64:
+                        op_value = { true, false, value.second.cast<std::int64_t>(), 0 };
+                        break;
+                    case StorageClass::FP_NUMERIC64:
+                        op_value = { true, true, 0, value.second.cast<double>() };
+                        break;
+                    case StorageClass::BOOLEAN:
+                        op_value = { true, false, value.second == Value::TRUE ? 1 : 0, 0 };
+                        break;
+                    default:
+                        // None or non-numeric value
+                        return false;
+                }
+            }
+
+            auto &group = getGroup(key);
+            ++group.m_count;
+            for (unsigned int i = 0; i < m_ops.size(); ++i) {
+                auto &op_value = op_values[i];
+                if (op_value.m_exists) {
+                    group.m_states[i].add(m_ops[i], op_value.m_is_real, op_value.m_int, op_value.m_real);
+                }
+            }
+        }
+        return true;
+    }
+
+}
@@ -0,0 +1,157 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+#include <dbzero/core/collections/full_text/FT_Iterator.hpp>
+#include <dbzero/object_model/value/StorageClass.hpp>
+#include <dbzero/object_model/value/Value.hpp>
+#include <dbzero/core/memory/swine_ptr.hpp>
+
+namespace db0
+
+{
+
+    class Fixture;
+
+}
+
+namespace db0::object_model
+
+{
+
+    class FieldReader;
+
+    enum class AggregateOp: std::uint8_t
+    {
+        COUNT = 0,
+        SUM = 1,
+        MIN = 2,
+        MAX = 3,
+        AVG = 4
+    };
+
+    // Aggregation state of a single op within a group
+    struct AggregateState
+    {
+        // number of the aggregated (numeric) values
+        std::uint64_t m_count = 0;
+        // integer and floating-point components of the result
+        std::int64_t m_int = 0;
+        double m_real = 0;
+        // the floating-point component is in use
+        bool m_is_real = false;
+
+        void add(AggregateOp, bool is_real, std::int64_t int_value, double real_value);
+        void merge(AggregateOp, const AggregateState &);
+
+        // get the sum of components as floating-point
+        double getReal() const;
+    };
+
+    // Single component of the group key, tag groups are identified by the tag's ordinal (as UNDEFINED)
+    struct GroupKeyItem
+    {
+        StorageClass m_storage_class = StorageClass::UNDEFINED;
+        Value m_value;
+
+        bool operator==(const GroupKeyItem &other) const {
+            return m_storage_class == other.m_storage_class && m_value == other.m_value;
+        }
+    };
+
+    using GroupKey = std::vector<GroupKeyItem>;
+
+    struct GroupKeyHash
+    {
+        std::size_t operator()(const GroupKey &) const;
+    };
+
+    struct GroupState
+    {
+        // number of objects in the group
+        std::uint64_t m_count = 0;
+        // one per aggregate op
+        std::vector<AggregateState> m_states;
+    };
+
+    /**
+     * Native group-by / aggregation over a full-text query
+     * Grouping fields and aggregated values are read directly from the object's value tables
+     * (without creating language objects), tags groups are resolved from the inverted lists
+     * NOTE: objects tagged with multiple tags from the same group are assigned to the first matching tag
+     * NOTE: None values of the aggregated members are not supported (evaluate returns false)
+    */
+    class GroupBy
+    {
+    public:
+        using QueryIterator = db0::FT_Iterator<UniqueAddress>;
+        using GroupMap = std::unordered_map<GroupKey, GroupState, GroupKeyHash>;
+
+        GroupBy(db0::swine_ptr<Fixture> &, std::unique_ptr<QueryIterator> &&query);
+        ~GroupBy();
+
+        // Add grouping criteria, tag iterators may be nullptr (for non-existing tags)
+        void addTagGroups(std::vector<std::unique_ptr<QueryIterator> > &&);
+        void addFieldGroup(const std::string &field_name);
+
+        void addOp(AggregateOp, const std::string &field_name = {});
+
+        /**
+         * Compute all groups, the tags-only count is resolved from the inverted list intersections
+         * @return false if unable to evaluate (e.g. non-scalar or missing member encountered)
+        */
+        bool evaluate();
+
+        const GroupMap &getGroups() const {
+            return m_groups;
+        }
+
+        GroupMap &getGroups() {
+            return m_groups;
+        }
+
+        const std::vector<AggregateOp> &getOps() const {
+            return m_ops;
+        }
+
+        // Check if the criteria at a specific position is a tag group
+        bool isTagGroup(unsigned int index) const;
+
+    private:
+        struct Criteria
+        {
+            // field index or -1 for tag groups
+            int m_field = -1;
+            std::vector<std::unique_ptr<QueryIterator> > m_tags;
+        };
+
+        db0::swine_ptr<Fixture> m_fixture;
+        std::unique_ptr<QueryIterator> m_query;
+        std::vector<Criteria> m_criteria;
+        std::vector<AggregateOp> m_ops;
+        // field index per op (or -1 for COUNT)
+        std::vector<int> m_op_fields;
+        std::vector<std::string> m_field_names;
+        // string contents mapped to the first encountered string address
+        std::unordered_map<std::string, std::uint64_t> m_strings;
+        GroupMap m_groups;
+
+        int addField(const std::string &field_name);
+
+        bool isCountByTags() const;
+        void countByTags();
+        bool scan();
+
+        // Read all fields of the object (normalized for grouping)
+        // @return false if any of the members could not be read
+        bool readFields(FieldReader &, UniqueAddress, std::vector<std::pair<StorageClass, Value> > &);
+        GroupState &getGroup(const GroupKey &);
+    };
+
+}
@@ -382,6 +382,10 @@ namespace db0::object_model
         
         std::size_t result = 0;
         if (iter) {
+            // e.g. single-tag or type queries
+            if (iter->tryGetSize(result)) {
+                return m_slice_def.getSize(result);
+            }
             Slice slice(iter.get(), m_slice_def);            
             while (!slice.isEnd()) {
                 slice.next();                
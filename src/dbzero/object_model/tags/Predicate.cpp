@@ -0,0 +1,271 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#include "Predicate.hpp"
+#include <cstring>
+#include <ostream>
+#include <dbzero/core/serialization/Serializable.hpp>
+#include <dbzero/core/serialization/string.hpp>
+#include <dbzero/core/vspace/v_object.hpp>
+#include <dbzero/core/exception/Exceptions.hpp>
+#include <dbzero/workspace/Fixture.hpp>
+
+namespace db0::object_model
+
+{
+
+    static const char *opToString(CompareOp op)
+    {
+        switch (op) {
+            case CompareOp::EQ: return "==";
+            case CompareOp::NE: return "!=";
+            case CompareOp::LT: return "<";
+            case CompareOp::LE: return "<=";
+            case CompareOp::GT: return ">";
+            case CompareOp::GE: return ">=";
+        }
+        return "?";
+    }
+
+    // Apply the op to the result of a three-way comparison
+    static bool isMatch(CompareOp op, int cmp)
+    {
+        switch (op) {
+            case CompareOp::EQ: return cmp == 0;
+            case CompareOp::NE: return cmp != 0;
+            case CompareOp::LT: return cmp < 0;
+            case CompareOp::LE: return cmp <= 0;
+            case CompareOp::GT: return cmp > 0;
+            case CompareOp::GE: return cmp >= 0;
+        }
+        return false;
+    }
+
+    template <typename T> static int compare(const T &lhs, const T &rhs) {
+        return (lhs < rhs) ? -1 : ((rhs < lhs) ? 1 : 0);
+    }
+
+    // Compare a numeric member value with the constant
+    static bool isMatchNumeric(CompareOp op, bool is_real, std::int64_t int_value, double real_value,
+        const PredicateValue &value)
+    {
+        if (!is_real && value.m_type != PredicateValue::Type::REAL) {
+            return isMatch(op, compare(int_value, value.m_int));
+        }
+        auto lhs = is_real ? real_value : (double)int_value;
+        auto rhs = (value.m_type == PredicateValue::Type::REAL) ? value.m_real : (double)value.m_int;
+        // NOTE: NaN compares unequal with anything
+        if (lhs != lhs || rhs != rhs) {
+            return op == CompareOp::NE;
+        }
+        return isMatch(op, compare(lhs, rhs));
+    }
+
+    static bool isNumeric(PredicateValue::Type type) {
+        return type == PredicateValue::Type::BOOLEAN || type == PredicateValue::Type::INT ||
+            type == PredicateValue::Type::REAL;
+    }
+
+    static bool isMatch(Fixture &fixture, const Comparison &comparison, const std::pair<StorageClass, Value> &raw)
+    {
+        auto &value = comparison.m_value;
+        switch (raw.first) {
+            case StorageClass::NONE: {
+                if (value.m_type == PredicateValue::Type::NONE) {
+                    // None is only comparable for equality
+                    return comparison.m_op == CompareOp::EQ;
+                }
+            }
+            break;
+
+            case StorageClass::INT64: {
+                if (isNumeric(value.m_type)) {
+                    return isMatchNumeric(comparison.m_op, false, raw.second.cast<std::int64_t>(), 0, value);
+                }
+            }
+            break;
+
+            case StorageClass::FP_NUMERIC64: {
+                if (isNumeric(value.m_type)) {
+                    return isMatchNumeric(comparison.m_op, true, 0, raw.second.cast<double>(), value);
+                }
+            }
+            break;
+
+            case StorageClass::BOOLEAN: {
+                if (isNumeric(value.m_type)) {
+                    return isMatchNumeric(comparison.m_op, false, raw.second == Value::TRUE ? 1 : 0, 0, value);
+                }
+            }
+            break;
+
+            case StorageClass::STRING_REF: {
+                if (value.m_type == PredicateValue::Type::STRING) {
+                    db0::v_object<db0::o_string> string_ref(fixture.myPtr(raw.second.asAddress()));
+                    auto str_ptr = string_ref->get();
+                    auto size = std::min(str_ptr.size(), value.m_str.size());
+                    int cmp = size ? std::memcmp(str_ptr.get_raw(), value.m_str.data(), size) : 0;
+                    if (!cmp) {
+                        cmp = compare(str_ptr.size(), value.m_str.size());
+                    }
+                    return isMatch(comparison.m_op, cmp);
+                }
+            }
+            break;
+
+            default:
+                break;
+        }
+        // incompatible types are never equal (nor ordered)
+        return comparison.m_op == CompareOp::NE;
+    }
+
+    PredicateValue PredicateValue::makeNone() {
+        return {};
+    }
+
+    PredicateValue PredicateValue::makeBool(bool value)
+    {
+        PredicateValue result;
+        result.m_type = Type::BOOLEAN;
+        result.m_int = value ? 1 : 0;
+        return result;
+    }
+
+    PredicateValue PredicateValue::makeInt(std::int64_t value)
+    {
+        PredicateValue result;
+        result.m_type = Type::INT;
+        result.m_int = value;
+        return result;
+    }
+
+    PredicateValue PredicateValue::makeReal(double value)
+    {
+        PredicateValue result;
+        result.m_type = Type::REAL;
+        result.m_real = value;
+        return result;
+    }
+
+    PredicateValue PredicateValue::makeString(const std::string &value)
+    {
+        PredicateValue result;
+        result.m_type = Type::STRING;
+        result.m_str = value;
+        return result;
+    }
+
+    bool PredicateValue::operator==(const PredicateValue &other) const
+    {
+        return m_type == other.m_type && m_int == other.m_int && m_str == other.m_str &&
+            std::memcmp(&m_real, &other.m_real, sizeof(m_real)) == 0;
+    }
+
+    bool Comparison::operator==(const Comparison &other) const {
+        return m_field_name == other.m_field_name && m_op == other.m_op && m_value == other.m_value;
+    }
+
+    Predicate::Predicate(const std::string &field_name, CompareOp op, const PredicateValue &value)
+        : m_comparisons({ { field_name, op, value } })
+    {
+    }
+
+    void Predicate::append(const Predicate &other) {
+        m_comparisons.insert(m_comparisons.end(), other.m_comparisons.begin(), other.m_comparisons.end());
+    }
+
+    std::vector<std::string> Predicate::getFieldNames() const
+    {
+        std::vector<std::string> result;
+        for (auto &comparison: m_comparisons) {
+            result.push_back(comparison.m_field_name);
+        }
+        return result;
+    }
+
+    bool Predicate::evaluate(Fixture &fixture, const std::vector<std::pair<StorageClass, Value> > &values) const
+    {
+        assert(values.size() == m_comparisons.size());
+        for (unsigned int i = 0; i < m_comparisons.size(); ++i) {
+            if (!isMatch(fixture, m_comparisons[i], values[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static void writeString(std::vector<std::byte> &v, const std::string &str)
+    {
+        db0::serial::write<std::uint32_t>(v, str.size());
+        auto p = reinterpret_cast<const std::byte *>(str.data());
+        v.insert(v.end(), p, p + str.size());
+    }
+
+    static std::string readString(std::vector<std::byte>::const_iterator &iter,
+        std::vector<std::byte>::const_iterator end)
+    {
+        auto size = db0::serial::read<std::uint32_t>(iter, end);
+        if (end - iter < (std::ptrdiff_t)size) {
+            THROWF(db0::InternalException) << "Not enough bytes to read" << THROWF_END;
+        }
+        std::string result(reinterpret_cast<const char *>(&*iter), size);
+        iter += size;
+        return result;
+    }
+
+    void Predicate::serialize(std::vector<std::byte> &v) const
+    {
+        db0::serial::write<std::uint32_t>(v, m_comparisons.size());
+        for (auto &comparison: m_comparisons) {
+            writeString(v, comparison.m_field_name);
+            db0::serial::write(v, comparison.m_op);
+            db0::serial::write(v, comparison.m_value.m_type);
+            db0::serial::write(v, comparison.m_value.m_int);
+            db0::serial::write(v, comparison.m_value.m_real);
+            writeString(v, comparison.m_value.m_str);
+        }
+    }
+
+    Predicate Predicate::deserialize(std::vector<std::byte>::const_iterator &iter,
+        std::vector<std::byte>::const_iterator end)
+    {
+        Predicate result;
+        auto size = db0::serial::read<std::uint32_t>(iter, end);
+        for (std::uint32_t i = 0; i < size; ++i) {
+            Comparison comparison;
+            comparison.m_field_name = readString(iter, end);
+            comparison.m_op = db0::serial::read<CompareOp>(iter, end);
+            comparison.m_value.m_type = db0::serial::read<PredicateValue::Type>(iter, end);
+            comparison.m_value.m_int = db0::serial::read<std::int64_t>(iter, end);
+            comparison.m_value.m_real = db0::serial::read<double>(iter, end);
+            comparison.m_value.m_str = readString(iter, end);
+            result.m_comparisons.push_back(std::move(comparison));
+        }
+        return result;
+    }
+
+    bool Predicate::operator==(const Predicate &other) const {
+        return m_comparisons == other.m_comparisons;
+    }
+
+    std::ostream &Predicate::dump(std::ostream &os) const
+    {
+        for (unsigned int i = 0; i < m_comparisons.size(); ++i) {
+            auto &comparison = m_comparisons[i];
+            if (i) {
+                os << " and ";
+            }
+            os << comparison.m_field_name << " " << opToString(comparison.m_op) << " ";
+            switch (comparison.m_value.m_type) {
+                case PredicateValue::Type::NONE: os << "None"; break;
+                case PredicateValue::Type::BOOLEAN: os << (comparison.m_value.m_int ? "True" : "False"); break;
+                case PredicateValue::Type::INT: os << comparison.m_value.m_int; break;
+                case PredicateValue::Type::REAL: os << comparison.m_value.m_real; break;
+                case PredicateValue::Type::STRING: os << "'" << comparison.m_value.m_str << "'"; break;
+            }
+        }
+        return os;
+    }
+
+}
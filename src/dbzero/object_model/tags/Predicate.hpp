@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <iosfwd>
+#include <dbzero/object_model/value/StorageClass.hpp>
+#include <dbzero/object_model/value/Value.hpp>
+
+namespace db0
+
+{
+
+    class Fixture;
+
+}
+
+namespace db0::object_model
+
+{
+
+    enum class CompareOp: std::uint8_t
+    {
+        EQ = 0,
+        NE = 1,
+        LT = 2,
+        LE = 3,
+        GT = 4,
+        GE = 5
+    };
+
+    // Constant operand of a comparison
+    struct PredicateValue
+    {
+        enum class Type: std::uint8_t
+        {
+            NONE = 0,
+            BOOLEAN = 1,
+            INT = 2,
+            REAL = 3,
+            STRING = 4
+        };
+
+        Type m_type = Type::NONE;
+        std::int64_t m_int = 0;
+        double m_real = 0;
+        std::string m_str;
+
+        static PredicateValue makeNone();
+        static PredicateValue makeBool(bool);
+        static PredicateValue makeInt(std::int64_t);
+        static PredicateValue makeReal(double);
+        static PredicateValue makeString(const std::string &);
+
+        bool operator==(const PredicateValue &) const;
+    };
+
+    // Compare member value with a constant
+    struct Comparison
+    {
+        std::string m_field_name;
+        CompareOp m_op = CompareOp::EQ;
+        PredicateValue m_value;
+
+        bool operator==(const Comparison &) const;
+    };
+
+    /**
+     * Declarative predicate - a conjunction of member-vs-constant comparisons,
+     * evaluated directly against raw values of the object's members (see FieldReader)
+     * Follows the Python semantics: numbers (including bools) are compared by value, strings by content,
+     * comparing incompatible types yields false (or true for NE)
+     * NOTE: objects missing any of the members never match
+    */
+    class Predicate
+    {
+    public:
+        Predicate() = default;
+        Predicate(const std::string &field_name, CompareOp, const PredicateValue &);
+
+        // Combine with other predicate (logical AND)
+        void append(const Predicate &);
+
+        const std::vector<Comparison> &getComparisons() const {
+            return m_comparisons;
+        }
+
+        // Names of the compared members (one per comparison)
+        std::vector<std::string> getFieldNames() const;
+
+        /**
+         * Evaluate the predicate with raw values of the members
+         * @param values one per comparison (see getFieldNames)
+        */
+        bool evaluate(Fixture &, const std::vector<std::pair<StorageClass, Value> > &values) const;
+
+        void serialize(std::vector<std::byte> &) const;
+        static Predicate deserialize(std::vector<std::byte>::const_iterator &iter,
+            std::vector<std::byte>::const_iterator end);
+
+        bool operator==(const Predicate &) const;
+
+        std::ostream &dump(std::ostream &) const;
+
+    private:
+        std::vector<Comparison> m_comparisons;
+    };
+
+}
@@ -0,0 +1,253 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#include "PredicateIterator.hpp"
+#include <cstring>
+#include <dbzero/core/collections/full_text/FT_Serialization.hpp>
+#include <dbzero/core/serialization/Serializable.hpp>
+#include <dbzero/core/exception/Exceptions.hpp>
+#include <dbzero/workspace/Fixture.hpp>
+#include <dbzero/workspace/Snapshot.hpp>
+
+namespace db0::object_model
+
+{
+
+    PredicateIterator::PredicateIterator(db0::swine_ptr<Fixture> &fixture, std::unique_ptr<QueryIterator> &&inner,
+        const Predicate &predicate, int direction)
+        : m_fixture(fixture)
+        , m_fixture_uuid(fixture->getUUID())
+        , m_inner(std::move(inner))
+        , m_predicate(predicate)
+        , m_direction(direction)
+        , m_reader(predicate.getFieldNames())
+        , m_values(predicate.getComparisons().size())
+    {
+        assert(m_inner);
+        skip();
+    }
+
+    PredicateIterator::PredicateIterator(std::uint64_t uid, db0::swine_ptr<Fixture> &fixture,
+        std::unique_ptr<QueryIterator> &&inner, const Predicate &predicate, int direction)
+        : super_t(uid)
+        , m_fixture(fixture)
+        , m_fixture_uuid(fixture->getUUID())
+        , m_inner(std::move(inner))
+        , m_predicate(predicate)
+        , m_direction(direction)
+        , m_reader(predicate.getFieldNames())
+        , m_values(predicate.getComparisons().size())
+    {
+        assert(m_inner);
+        skip();
+    }
+
+    bool PredicateIterator::isMatch(UniqueAddress key)
+    {
+        auto fixture = m_fixture.safe_lock();
+        if (!m_reader.read(fixture, key.getAddress(), m_values)) {
+            // e.g. missing member
+            return false;
+        }
+        return m_predicate.evaluate(*fixture, m_values);
+    }
+
+    bool PredicateIterator::skip()
+    {
+        while (!m_inner->isEnd()) {
+            if (isMatch(m_inner->getKey())) {
+                return true;
+            }
+            if (m_direction > 0) {
+                ++(*m_inner);
+            } else {
+                --(*m_inner);
+            }
+        }
+        return false;
+    }
+
+    UniqueAddress PredicateIterator::getKey() const {
+        return m_inner->getKey();
+    }
+
+    bool PredicateIterator::isEnd() const {
+        return m_inner->isEnd();
+    }
+
+    const std::type_info &PredicateIterator::typeId() const {
+        return typeid(PredicateIterator);
+    }
+
+    void PredicateIterator::next(void *buf)
+    {
+        assert(!isEnd());
+        if (buf) {
+            auto key = m_inner->getKey();
+            std::memcpy(buf, &key, sizeof(key));
+        }
+        if (m_direction > 0) {
+            ++(*this);
+        } else {
+            --(*this);
+        }
+    }
+
+    void PredicateIterator::operator++()
+    {
+        assert(m_direction > 0);
+        ++(*m_inner);
+        skip();
+    }
+
+    void PredicateIterator::operator--()
+    {
+        assert(m_direction < 0);
+        --(*m_inner);
+        skip();
+    }
+
+    bool PredicateIterator::join(UniqueAddress join_key, int direction)
+    {
+        if (!m_inner->join(join_key, direction)) {
+            return false;
+        }
+        return skip();
+    }
+
+    void PredicateIterator::joinBound(UniqueAddress join_key) {
+        m_inner->joinBound(join_key);
+    }
+
+    std::pair<UniqueAddress, bool> PredicateIterator::peek(UniqueAddress join_key) const
+    {
+        auto it = beginTyped(-1);
+        if (!it->join(join_key, -1)) {
+            return { join_key, false };
+        }
+        return { it->getKey(), true };
+    }
+
+    bool PredicateIterator::isNextKeyDuplicated() const {
+        // NOTE: duplicate keys refer to the same object (i.e. the same predicate result)
+        return m_inner->isNextKeyDuplicated();
+    }
+
+    std::unique_ptr<PredicateIterator::QueryIterator> PredicateIterator::beginTyped(int direction) const
+    {
+        auto fixture = m_fixture.safe_lock();
+        return std::unique_ptr<QueryIterator>(
+            new PredicateIterator(this->m_uid, fixture, m_inner->beginTyped(direction), m_predicate, direction)
+        );
+    }
+
+    bool PredicateIterator::limitBy(UniqueAddress key) {
+        return m_inner->limitBy(key);
+    }
+
+    void PredicateIterator::scanQueryTree(std::function<void(const QueryIterator *, int depth)> scan_function,
+        int depth) const
+    {
+        scan_function(this, depth);
+        m_inner->scanQueryTree(scan_function, depth);
+    }
+
+    std::size_t PredicateIterator::getDepth() const {
+        return m_inner->getDepth() + 1u;
+    }
+
+    void PredicateIterator::stop() {
+        m_inner->stop();
+    }
+
+    bool PredicateIterator::findBy(const std::function<bool(const QueryIterator &)> &f) const
+    {
+        if (!super_t::findBy(f)) {
+            return false;
+        }
+        return m_inner->findBy(f);
+    }
+
+    std::pair<bool, bool> PredicateIterator::mutateInner(const MutateFunction &f)
+    {
+        auto result = super_t::mutateInner(f);
+        if (result.first) {
+            return result;
+        }
+        result = m_inner->mutateInner(f);
+        // was mutated and has result
+        if (result.first && result.second && !skip()) {
+            result.second = false;
+        }
+        return result;
+    }
+
+    const FT_IteratorBase *PredicateIterator::find(std::uint64_t uid) const
+    {
+        if (this->m_uid == uid) {
+            return this;
+        }
+        return m_inner->find(uid);
+    }
+
+    FTIteratorType PredicateIterator::getSerialTypeId() const {
+        return FTIteratorType::Predicate;
+    }
+
+    void PredicateIterator::getSignature(std::vector<std::byte> &v) const {
+        // get the serializable's signature
+        db0::serial::getSignature(*this, v);
+    }
+
+    std::ostream &PredicateIterator::dump(std::ostream &os) const
+    {
+        os << "WHERE@" << this << '[';
+        m_predicate.dump(os) << ',';
+        m_inner->dump(os);
+        return os << ']';
+    }
+
+    void PredicateIterator::serializeFTIterator(std::vector<std::byte> &v) const
+    {
+        using TypeIdType = decltype(db0::serial::typeId<void>());
+
+        db0::serial::write<TypeIdType>(v, db0::serial::typeId<UniqueAddress>());
+        db0::serial::write(v, m_fixture_uuid);
+        db0::serial::write<std::int8_t>(v, m_direction);
+        m_predicate.serialize(v);
+        m_inner->serialize(v);
+    }
+
+    std::unique_ptr<PredicateIterator> PredicateIterator::deserialize(Snapshot &snapshot,
+        std::vector<std::byte>::const_iterator &iter, std::vector<std::byte>::const_iterator end)
+    {
+        using TypeIdType = decltype(db0::serial::typeId<void>());
+
+        auto key_type_id = db0::serial::read<TypeIdType>(iter, end);
+        if (key_type_id != db0::serial::typeId<UniqueAddress>()) {
+            THROWF(db0::InternalException) << "Key type mismatch: " << key_type_id << " != "
+                << db0::serial::typeId<UniqueAddress>() << THROWF_END;
+        }
+        auto fixture = snapshot.getFixture(db0::serial::read<std::uint64_t>(iter, end));
+        int direction = db0::serial::read<std::int8_t>(iter, end);
+        auto predicate = Predicate::deserialize(iter, end);
+        auto inner = db0::deserializeFT_Iterator<UniqueAddress>(snapshot, iter, end);
+        if (!inner) {
+            return nullptr;
+        }
+        return std::make_unique<PredicateIterator>(fixture, std::move(inner), predicate, direction);
+    }
+
+    double PredicateIterator::compareToImpl(const FT_IteratorBase &it) const
+    {
+        if (this->typeId() != it.typeId()) {
+            return 1.0;
+        }
+        auto &other = reinterpret_cast<const PredicateIterator &>(it);
+        if (!(m_predicate == other.m_predicate)) {
+            return 1.0;
+        }
+        return m_inner->compareTo(*other.m_inner);
+    }
+
+}
@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "Predicate.hpp"
+#include <dbzero/core/collections/full_text/FT_Iterator.hpp>
+#include <dbzero/core/memory/swine_ptr.hpp>
+#include <dbzero/object_model/object/FieldReader.hpp>
+
+namespace db0
+
+{
+
+    class Fixture;
+    class Snapshot;
+
+}
+
+namespace db0::object_model
+
+{
+
+    /**
+     * Filters keys of the inner iterator by a declarative predicate,
+     * the predicate is evaluated against raw member values (without creating language objects)
+    */
+    class PredicateIterator final: public db0::FT_Iterator<UniqueAddress>
+    {
+    public:
+        using super_t = db0::FT_Iterator<UniqueAddress>;
+        using QueryIterator = db0::FT_Iterator<UniqueAddress>;
+
+        PredicateIterator(db0::swine_ptr<Fixture> &, std::unique_ptr<QueryIterator> &&, const Predicate &,
+            int direction = -1);
+
+        const Predicate &getPredicate() const {
+            return m_predicate;
+        }
+
+        UniqueAddress getKey() const override;
+
+        bool isEnd() const override;
+
+        const std::type_info &typeId() const override;
+
+        void next(void *buf = nullptr) override;
+
+        void operator++() override;
+
+        void operator--() override;
+
+        bool join(UniqueAddress join_key, int direction = -1) override;
+
+        // NOTE: iterates over the super-set (i.e. the inner query)
+        void joinBound(UniqueAddress join_key) override;
+
+        std::pair<UniqueAddress, bool> peek(UniqueAddress join_key) const override;
+
+        bool isNextKeyDuplicated() const override;
+
+        std::unique_ptr<QueryIterator> beginTyped(int direction = -1) const override;
+
+        bool limitBy(UniqueAddress key) override;
+
+        void scanQueryTree(std::function<void(const QueryIterator *, int depth)> scan_function,
+            int depth = 0) const override;
+
+        std::size_t getDepth() const override;
+
+        void stop() override;
+
+        bool findBy(const std::function<bool(const QueryIterator &)> &f) const override;
+
+        std::pair<bool, bool> mutateInner(const MutateFunction &f) override;
+
+        const FT_IteratorBase *find(std::uint64_t uid) const override;
+
+        FTIteratorType getSerialTypeId() const override;
+
+        void getSignature(std::vector<std::byte> &) const override;
+
+        std::ostream &dump(std::ostream &os) const override;
+
+        static std::unique_ptr<PredicateIterator> deserialize(Snapshot &, std::vector<std::byte>::const_iterator &iter,
+            std::vector<std::byte>::const_iterator end);
+
+    protected:
+        void serializeFTIterator(std::vector<std::byte> &) const override;
+
+        double compareToImpl(const FT_IteratorBase &it) const override;
+
+    private:
+        db0::weak_swine_ptr<Fixture> m_fixture;
+        const std::uint64_t m_fixture_uuid;
+        std::unique_ptr<QueryIterator> m_inner;
+        const Predicate m_predicate;
+        const int m_direction;
+        FieldReader m_reader;
+        std::vector<std::pair<StorageClass, Value> > m_values;
+
+        PredicateIterator(std::uint64_t uid, db0::swine_ptr<Fixture> &, std::unique_ptr<QueryIterator> &&,
+            const Predicate &, int direction);
+
+        bool isMatch(UniqueAddress);
+
+        // Move to the first matching key (including the current one) in the iteration direction
+        // @return false if end reached
+        bool skip();
+    };
+
+}
@@ -3,6 +3,7 @@
 
 #include "Slice.hpp"
 #include <limits>
+#include <algorithm>
 #include <cassert>
 
 namespace db0::object_model
@@ -26,11 +27,24 @@ namespace db0::object_model
             << "Cannot slice an already sliced iterable (Operation not supported)" << THROWF_END;
     }
     
+    std::size_t SliceDef::getSize(std::size_t size) const
+    {
+        auto stop = std::min(m_stop, size);
+        if (m_start >= stop) {
+            return 0;
+        }
+        return (stop - m_start + m_step - 1) / m_step;
+    }
+
     Slice::Slice(BaseIterator *base_iterator, const SliceDef &slice_def)
         : m_slice_def(slice_def)
         , m_iterator_ptr(base_iterator)        
     {        
         assert(m_slice_def.m_step > 0);
+        if (m_iterator_ptr && m_slice_def.m_stop != SliceDef::MAX_STOP()) {
+            // NOTE: must be set before the first access (e.g. allows top-K sorting)
+            m_iterator_ptr->setLimit(m_slice_def.m_stop);
+        }
         if (m_slice_def.m_start > 0 && m_iterator_ptr && !m_iterator_ptr->isEnd()) {
             m_iterator_ptr->skip(m_slice_def.m_start);
             m_pos += m_slice_def.m_start;
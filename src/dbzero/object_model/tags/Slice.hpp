@@ -28,6 +28,9 @@ namespace db0::object_model
         }
         
         SliceDef combineWith(const SliceDef &other) const;
+
+        // Get the number of items within the slice of a collection of a known size
+        std::size_t getSize(std::size_t size) const;
     };
     
     class Slice
@@ -891,6 +891,30 @@ namespace db0::object_model
         }
     }
     
+    std::vector<std::unique_ptr<TagIndex::QueryIterator> > TagIndex::makeIterators(ObjectPtr py_arg) const
+    {
+        auto type_id = LangToolkit::getTypeManager().getTypeId(py_arg);
+        // must check for string since it's is an iterable as well
+        if (type_id == TypeId::STRING || !LangToolkit::isIterable(py_arg)) {
+            THROWF(db0::InputException) << "Invalid argument type: " << LangToolkit::getTypeName(py_arg) 
+                << " (iterable expected)" << THROWF_END;
+        }
+        
+        std::vector<std::unique_ptr<QueryIterator> > result;
+        for (auto it = ForwardIterator(LangToolkit::getIterator(py_arg)), end = ForwardIterator::end(); it != end; ++it) {
+            if (isShortTag(*it)) {
+                result.push_back(m_base_index_short.makeIterator(getShortTag(*it)));
+            } else if (isLongTag(*it)) {
+                result.push_back(m_base_index_long.makeIterator(getLongTag(*it)));
+            } else {
+                THROWF(db0::InputException) << "Unable to convert to tag: " 
+                    << LangToolkit::getTypeName((*it).get()) 
+                    << THROWF_END;
+            }
+        }
+        return result;
+    }
+    
     LongTagT TagIndex::getLongTag(ObjectSharedPtr py_arg) const {
         return getLongTag(py_arg.get());
     }
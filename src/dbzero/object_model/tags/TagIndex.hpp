@@ -93,6 +93,12 @@ DB0_PACKED_END
         std::pair<std::unique_ptr<QueryIterator>, std::unique_ptr<QueryObserver> >
         splitBy(ObjectPtr lang_arg, std::unique_ptr<QueryIterator> &&query, bool exclusive) const;
         
+        /**
+         * Create query iterators for all values from a specific tags_list (short or long tag definitions)
+         * @return iterators in the order of the tags_list, nullptr for tags which do not exist
+        */
+        std::vector<std::unique_ptr<QueryIterator> > makeIterators(ObjectPtr lang_arg) const;
+        
         // Clears the uncommited contents (rollback)
         void rollback();
 
@@ -2,6 +2,7 @@
 // Copyright (c) 2025 DBZero Software sp. z o.o.
 
 #include "Member.hpp"
+#include <cstring>
 #include <dbzero/core//serialization/Serializable.hpp>
 #include <dbzero/object_model/tags/ObjectIterator.hpp>
 #include <dbzero/object_model/enum/Enum.hpp>
@@ -9,6 +10,7 @@
 #include <dbzero/object_model/enum/EnumFactory.hpp>
 #include <dbzero/object_model/bytes/ByteArray.hpp>
 #include <dbzero/object_model/class/Class.hpp>
+#include <dbzero/object_model/array/Array.hpp>
 #include <dbzero/bindings/python/collections/PyTuple.hpp>
 #include <dbzero/bindings/python/types/PyDecimal.hpp>
 #include <dbzero/object_model/bytes/ByteArray.hpp>
@@ -128,6 +130,14 @@ namespace db0::object_model
         return resolveForFixture(fixture, weak_set, obj_ptr, storage_class, access_flags);
     }
 
+    // DB0_ARRAY specialization
+    template <> Value createMember<TypeId::DB0_ARRAY, PyToolkit>(db0::swine_ptr<Fixture> &fixture,
+        PyObjectPtr obj_ptr, StorageClass storage_class, AccessFlags access_flags)
+    {
+        auto &array = PyToolkit::getTypeManager().extractMutableArray(obj_ptr);
+        return resolveForFixture(fixture, array, obj_ptr, storage_class, access_flags);
+    }
+
     // DB0 DICT specialization
     template <> Value createMember<TypeId::DB0_DICT, PyToolkit>(db0::swine_ptr<Fixture> &fixture,
         PyObjectPtr obj_ptr, StorageClass storage_class, AccessFlags access_flags)
@@ -370,6 +380,7 @@ namespace db0::object_model
         functions[static_cast<int>(TypeId::DB0_INDEX)] = createMember<TypeId::DB0_INDEX, PyToolkit>;
         functions[static_cast<int>(TypeId::DB0_SET)] = createMember<TypeId::DB0_SET, PyToolkit>;
         functions[static_cast<int>(TypeId::DB0_WEAK_SET)] = createMember<TypeId::DB0_WEAK_SET, PyToolkit>;
+        functions[static_cast<int>(TypeId::DB0_ARRAY)] = createMember<TypeId::DB0_ARRAY, PyToolkit>;
         functions[static_cast<int>(TypeId::DB0_DICT)] = createMember<TypeId::DB0_DICT, PyToolkit>;
         functions[static_cast<int>(TypeId::DB0_TUPLE)] = createMember<TypeId::DB0_TUPLE, PyToolkit>;
         functions[static_cast<int>(TypeId::LIST)] = createMember<TypeId::LIST, PyToolkit>;
@@ -598,6 +609,13 @@ namespace db0::object_model
         return PyToolkit::unloadByteArray(fixture, value.asAddress(), access_mode);
     }
     
+    // DB0_ARRAY specialization
+    template <> typename PyToolkit::ObjectSharedPtr unloadMember<StorageClass::DB0_ARRAY, PyToolkit>(
+        db0::swine_ptr<Fixture> &fixture, Value value, unsigned int, AccessFlags access_mode)
+    {
+        return PyToolkit::unloadArray(fixture, value.asAddress(), access_mode);
+    }
+
     // OBJECT_WEAK_REF
     template <> typename PyToolkit::ObjectSharedPtr unloadMember<StorageClass::OBJECT_WEAK_REF, PyToolkit>(
         db0::swine_ptr<Fixture> &fixture, Value value, unsigned int, AccessFlags)
@@ -672,6 +690,7 @@ namespace db0::object_model
         functions[static_cast<int>(StorageClass::DB0_INDEX)] = unloadMember<StorageClass::DB0_INDEX, PyToolkit>;
         functions[static_cast<int>(StorageClass::DB0_SET)] = unloadMember<StorageClass::DB0_SET, PyToolkit>;
         functions[static_cast<int>(StorageClass::DB0_WEAK_SET)] = unloadMember<StorageClass::DB0_WEAK_SET, PyToolkit>;
+        functions[static_cast<int>(StorageClass::DB0_ARRAY)] = unloadMember<StorageClass::DB0_ARRAY, PyToolkit>;
         functions[static_cast<int>(StorageClass::DB0_DICT)] = unloadMember<StorageClass::DB0_DICT, PyToolkit>;
         functions[static_cast<int>(StorageClass::DB0_TUPLE)] = unloadMember<StorageClass::DB0_TUPLE, PyToolkit>;
         functions[static_cast<int>(StorageClass::DB0_BYTES)] = unloadMember<StorageClass::DB0_BYTES, PyToolkit>;
@@ -803,6 +822,12 @@ namespace db0::object_model
         unrefObjectBase<ByteArray, PyToolkit>(fixture, value.asAddress());
     }
     
+    template <> void unrefMember<StorageClass::DB0_ARRAY, PyToolkit>(
+        db0::swine_ptr<Fixture> &fixture, Value value)
+    {
+        unrefObjectBase<Array, PyToolkit>(fixture, value.asAddress());
+    }
+
     // CLASS specialization
     template <> void unrefMember<StorageClass::DB0_CLASS, PyToolkit>(
         db0::swine_ptr<Fixture> &fixture, Value value)
@@ -827,6 +852,7 @@ namespace db0::object_model
         functions[static_cast<int>(StorageClass::DB0_INDEX)] = unrefMember<StorageClass::DB0_INDEX, PyToolkit>;
         functions[static_cast<int>(StorageClass::DB0_SET)] = unrefMember<StorageClass::DB0_SET, PyToolkit>;
         functions[static_cast<int>(StorageClass::DB0_WEAK_SET)] = unrefMember<StorageClass::DB0_WEAK_SET, PyToolkit>;
+        functions[static_cast<int>(StorageClass::DB0_ARRAY)] = unrefMember<StorageClass::DB0_ARRAY, PyToolkit>;
         functions[static_cast<int>(StorageClass::DB0_DICT)] = unrefMember<StorageClass::DB0_DICT, PyToolkit>;
         functions[static_cast<int>(StorageClass::DB0_TUPLE)] = unrefMember<StorageClass::DB0_TUPLE, PyToolkit>;
         functions[static_cast<int>(StorageClass::DB0_BYTES_ARRAY)] = unrefMember<StorageClass::DB0_BYTES_ARRAY, PyToolkit>;
@@ -836,6 +862,79 @@ namespace db0::object_model
         // functions[static_cast<int>(StorageClass::DB0_SERIALIZED)] = unrefMember<StorageClass::DB0_SERIALIZED, PyToolkit>;
     }
     
+    // 0 = not equal, 1 = equal, -1 = native comparison not applicable
+    static int tryCompareNative(db0::swine_ptr<Fixture> &fixture, StorageClass storage_class, Value value,
+        PyObjectPtr obj_ptr, AccessFlags access_mode)
+    {
+        // NOTE: only storage classes with well-defined equality against the 5 native key types are resolved here
+        // (e.g. 1 == 1.0 == Decimal(1) or b'a' == bytearray(b'a') are left to the fallback)
+        bool is_native_class = storage_class == StorageClass::INT64 || storage_class == StorageClass::BOOLEAN
+            || storage_class == StorageClass::NONE || storage_class == StorageClass::STRING_REF
+            || storage_class == StorageClass::DB0_BYTES;
+        if (!is_native_class) {
+            return -1;
+        }
+
+        if (obj_ptr == Py_None) {
+            return storage_class == StorageClass::NONE;
+        }
+        if (PyBool_Check(obj_ptr) || PyLong_CheckExact(obj_ptr)) {
+            if (storage_class == StorageClass::INT64 || storage_class == StorageClass::BOOLEAN) {
+                int overflow = 0;
+                auto key = PyLong_AsLongLongAndOverflow(obj_ptr, &overflow);
+                if (overflow) {
+                    return 0;
+                }
+                if (key == -1 && PyErr_Occurred()) {
+                    PyErr_Clear();
+                    return -1;
+                }
+                if (storage_class == StorageClass::INT64) {
+                    return value.cast<std::int64_t>() == key;
+                }
+                // NOTE: booleans use the common constant encoding (1 = False, 2 = True)
+                return (value.cast<std::uint64_t>() == 2 ? 1 : 0) == key;
+            }
+            return 0;
+        }
+        if (PyUnicode_CheckExact(obj_ptr)) {
+            if (storage_class != StorageClass::STRING_REF) {
+                return 0;
+            }
+            Py_ssize_t size = 0;
+            // NOTE: the UTF-8 representation is cached by the str object
+            auto key = PyUnicode_AsUTF8AndSize(obj_ptr, &size);
+            if (!key) {
+                PyErr_Clear();
+                return -1;
+            }
+            db0::v_object<db0::o_string> string_ref(fixture->myPtr(value.asAddress()), access_mode);
+            auto str_ptr = string_ref->get();
+            return str_ptr.size() == static_cast<std::size_t>(size) && !std::memcmp(str_ptr.get_raw(), key, size);
+        }
+        if (PyBytes_CheckExact(obj_ptr)) {
+            if (storage_class != StorageClass::DB0_BYTES) {
+                return 0;
+            }
+            db0::v_object<db0::o_binary> bytes(fixture->myPtr(value.asAddress()), access_mode);
+            auto size = PyBytes_GET_SIZE(obj_ptr);
+            return bytes->size() == static_cast<std::size_t>(size)
+                && !std::memcmp(bytes->getBuffer(), PyBytes_AS_STRING(obj_ptr), size);
+        }
+        return -1;
+    }
+
+    template <> bool compareMember<PyToolkit>(db0::swine_ptr<Fixture> &fixture, StorageClass storage_class,
+        Value value, PyObjectPtr obj_ptr, AccessFlags access_mode)
+    {
+        auto result = tryCompareNative(fixture, storage_class, value, obj_ptr, access_mode);
+        if (result >= 0) {
+            return result;
+        }
+        auto member = unloadMember<PyToolkit>(fixture, storage_class, value, 0, access_mode);
+        return PyToolkit::compare(obj_ptr, member.get());
+    }
+
     bool isMaterialized(PyObjectPtr obj_ptr)
     {
         auto object_ptr = PyToolkit::getTypeManager().tryExtractObject(obj_ptr);
@@ -115,6 +115,14 @@ namespace db0::object_model
         }
     }
     
+    /**
+     * Check if the language object is equal to a stored member (e.g. a dict key)
+     * str / bytes / int / bool / None are compared directly against the stored value,
+     * without creating temporary language objects. Other types are unloaded and compared with LangToolkit::compare
+    */
+    template <typename LangToolkit> bool compareMember(db0::swine_ptr<Fixture> &, StorageClass, Value,
+        typename LangToolkit::ObjectPtr, AccessFlags = {});
+
     /**
      * Invoke materialize before setting obj_ptr as a member
      * this is to materialize objects (where hasInstance = false) before using them as members
@@ -64,6 +64,7 @@ namespace db0::object_model
        DELETED = 31,
        CALLABLE = 32,
        DB0_WEAK_SET = 33,
+       DB0_ARRAY = 34,
 
        COUNT = std::numeric_limits<std::uint8_t>::max() - 32,
        // invalid / reserved value, never used in objects
@@ -116,6 +117,7 @@ namespace db0::object_model
         DELETED = static_cast<int>(PreStorageClass::DELETED),
         CALLABLE = static_cast<int>(PreStorageClass::CALLABLE),
         DB0_WEAK_SET = static_cast<int>(PreStorageClass::DB0_WEAK_SET),
+        DB0_ARRAY = static_cast<int>(PreStorageClass::DB0_ARRAY),
         // weak reference to other (Memo) instance from a foreign prefix
         OBJECT_LONG_WEAK_REF = static_cast<int>(PreStorageClass::COUNT),
         // COUNT used to determine size of the StorageClass associated arrays
@@ -151,6 +151,10 @@ namespace db0
         return std::unique_lock<std::mutex>(m_atomic_mutex);
     }
     
+    std::unique_lock<std::mutex> AtomicContext::tryLock() {
+        return std::unique_lock<std::mutex>(m_atomic_mutex, std::try_to_lock);
+    }
+
     bool AtomicContext::isActive() const {
         return m_atomic_lock.owns_lock();
     }
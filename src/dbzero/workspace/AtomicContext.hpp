@@ -41,6 +41,8 @@ namespace db0
         return func_ptr(obj_ptr);
     }
 
+    // NOTE: there's a single (process-wide) atomic operation at a time, atomic state (e.g. volatile locks)
+    // is tracked per workspace, not per thread
     class AtomicContext
     {
     public:
@@ -62,6 +64,8 @@ namespace db0
         void close();
         
         static std::unique_lock<std::mutex> lock();
+        // Acquire the atomic lock only if no atomic operation is in progress (check with owns_lock)
+        static std::unique_lock<std::mutex> tryLock();
         
     private:
         std::shared_ptr<Workspace> m_workspace;
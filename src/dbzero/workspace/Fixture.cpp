@@ -6,7 +6,9 @@
 #include <dbzero/core/vspace/v_object.hpp>
 #include <dbzero/core/utils/uuid.hpp>
 #include <dbzero/core/utils/ProcessTimer.hpp>
+#include <dbzero/core/utils/Tracer.hpp>
 #include "GC0.hpp"
+#include "ObjectChangeLog.hpp"
 #include "Workspace.hpp"
 #include "WorkspaceView.hpp"
 #include "PrefixName.hpp"
@@ -164,6 +166,9 @@ namespace db0
         for (auto &handler: m_rollback_handlers) {
             handler();
         }
+        if (m_change_log_ptr) {
+            m_change_log_ptr->rollback();
+        }
     }
     
     void Fixture::flush()
@@ -302,6 +307,7 @@ namespace db0
     
     bool Fixture::commit()
     {
+        DB0_TRACE("Fixture::commit");
         std::unique_ptr<ProcessTimer> process_timer;
         // process_timer = std::make_unique<ProcessTimer>("Fixture::commit");
         assert(getPrefixPtr());
@@ -363,6 +369,11 @@ namespace db0
                 ctx = nullptr;
             }
             
+            // NOTE: changes are logged with the number of the state being committed
+            if (m_change_log_ptr) {
+                m_change_log_ptr->commit(prefix_ptr->getStateNum());
+            }
+            
             m_string_pool.commit();
             m_object_catalogue.commit();
             m_v_object_cache.commit();
@@ -423,6 +434,22 @@ namespace db0
         return *m_gc0_ptr;
     }
     
+    db0::ObjectChangeLog &Fixture::createChangeLog(db0::swine_ptr<Fixture> &fixture)
+    {
+        assert(!m_change_log_ptr);
+        m_change_log_ptr = &addResource<db0::ObjectChangeLog>(fixture);
+        getGC0().setChangeLog(m_change_log_ptr);
+        return *m_change_log_ptr;
+    }
+    
+    db0::ObjectChangeLog &Fixture::createChangeLog(db0::swine_ptr<Fixture> &fixture, Address address)
+    {
+        assert(!m_change_log_ptr);
+        m_change_log_ptr = &addResource<db0::ObjectChangeLog>(fixture, address);
+        getGC0().setChangeLog(m_change_log_ptr);
+        return *m_change_log_ptr;
+    }
+    
     const Snapshot &Fixture::getWorkspace() const {
         return m_snapshot;
     }
@@ -462,6 +489,9 @@ namespace db0
         m_atomic_context_ptr = context;
         m_meta_allocator.beginAtomic();        
         getGC0().beginAtomic();
+        if (m_change_log_ptr) {
+            m_change_log_ptr->beginAtomic();
+        }
         m_string_pool.commit();
         m_object_catalogue.commit();
         m_v_object_cache.beginAtomic();
@@ -498,6 +528,9 @@ namespace db0
         m_meta_allocator.endAtomic();
         m_v_object_cache.endAtomic();        
         getGC0().endAtomic();
+        if (m_change_log_ptr) {
+            m_change_log_ptr->endAtomic();
+        }
         Memspace::endAtomic();
     }
     
@@ -509,6 +542,10 @@ namespace db0
         getGC0().cancelAtomic();
         // rollback any uncommited changes
         rollback();
+        // NOTE: restores changes logged before the atomic operation (discarded by rollback)
+        if (m_change_log_ptr) {
+            m_change_log_ptr->cancelAtomic();
+        }
         // detach owned resources
         for (auto &detach: m_detach_handlers) {
             detach();
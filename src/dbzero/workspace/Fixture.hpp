@@ -34,6 +34,7 @@ namespace db0
 DB0_PACKED_BEGIN
     
     class GC0;
+    class ObjectChangeLog;
     class MetaAllocator;
     class Snapshot;
     class Workspace;
@@ -164,6 +165,12 @@ DB0_PACKED_BEGIN
         */
         db0::GC0 &createGC0(db0::swine_ptr<Fixture> &fixture);
         db0::GC0 &createGC0(db0::swine_ptr<Fixture> &fixture, Address, bool read_only);
+
+        /**
+         * Create the object change log as a resource (only for read-write fixtures with change log enabled)
+        */
+        db0::ObjectChangeLog &createChangeLog(db0::swine_ptr<Fixture> &fixture);
+        db0::ObjectChangeLog &createChangeLog(db0::swine_ptr<Fixture> &fixture, Address);
         
         // add commit or close handler (the actual operation identified by the boolean flag)
         void addCloseHandler(std::function<void(bool commit)>);
@@ -189,6 +196,10 @@ DB0_PACKED_BEGIN
             return m_gc0_ptr;
         }
 
+        inline ObjectChangeLog *tryGetChangeLog() const {
+            return m_change_log_ptr;
+        }
+
         inline GC0 &getGC0()
         {
             assert(m_gc0_ptr);
@@ -217,6 +228,11 @@ DB0_PACKED_BEGIN
         */
         bool refreshIfUpdated();
         
+        // Check if refreshIfUpdated would refresh the fixture (without locking)
+        bool isRefreshPending() const {
+            return getAccessType() == AccessType::READ_ONLY && m_updated;
+        }
+        
         /**
          * Get read-only snapshot of the fixture's state within a specific WorkspaceView
         */
@@ -293,6 +309,8 @@ DB0_PACKED_BEGIN
         // the registry holds active v_object instances (important for refresh)
         // and cleanup of the "hanging" references
         db0::GC0 *m_gc0_ptr = nullptr;
+        // optional log of created / modified / deleted objects
+        db0::ObjectChangeLog *m_change_log_ptr = nullptr;
         StringPoolT m_string_pool;
         ObjectCatalogue m_object_catalogue;
         // internal cache for dbzero based collections
@@ -359,6 +377,11 @@ DB0_PACKED_BEGIN
          */
         void executeStateReachedCallbacks(const StateReachedCallbackList &callbacks);
         
+        // Check if there're any uncommitted modifications (without locking)
+        bool hasPendingUpdates() const {
+            return m_updated;
+        }
+
         /**
          * Called by the AutoCommitThread
          * @return the list of callbacks to be executed when committing process was completed
@@ -2,7 +2,9 @@
 // Copyright (c) 2025 DBZero Software sp. z o.o.
 
 #include "FixtureThreads.hpp"
+#include <algorithm>
 #include <dbzero/core/memory/Prefix.hpp>
+#include <dbzero/core/storage/BaseStorage.hpp>
 #include <dbzero/object_model/LangConfig.hpp>
 #include "AtomicContext.hpp"
 #include "LockedContext.hpp"
@@ -43,7 +45,7 @@ namespace db0
     {
         {
             std::lock_guard<std::mutex> lock(m_mutex);
-            m_fixtures.emplace_back(fixture);
+            m_fixtures.emplace_back(fixture, fixture->getUUID());
         }
         onFixtureAdded(*fixture);
     }
@@ -58,6 +60,14 @@ namespace db0
             std::unique_lock<std::mutex> lock(m_mutex);
             m_stopped = true;
         }
+        wakeUp();
+    }
+
+    void FixtureThread::waitNext(std::unique_lock<std::mutex> &lock) {
+        m_cv.wait_for(lock, std::chrono::milliseconds(m_interval_ms));
+    }
+
+    void FixtureThread::wakeUp() {
         m_cv.notify_all();
     }
     
@@ -65,7 +75,7 @@ namespace db0
     {
         while (true) {
             std::unique_lock<std::mutex> lock(m_mutex);
-            m_cv.wait_for(lock, std::chrono::milliseconds(m_interval_ms));
+            waitNext(lock);
             if (m_stopped) {
                 break;
             }
@@ -74,17 +84,28 @@ namespace db0
             prepareContext();
             // collect fixtures first
             std::vector<db0::swine_ptr<Fixture> > fixtures;
+            std::vector<std::uint64_t> removed;
             lock.lock();
             fixtures.reserve(m_fixtures.size());
             for (auto it = m_fixtures.begin(); it != m_fixtures.end();) {
-                auto fixture_ptr = it->lock();
+                auto fixture_ptr = it->first.lock();
                 if (!fixture_ptr) {
+                    removed.push_back(it->second);
                     it = m_fixtures.erase(it);
                     continue;
                 }
                 fixtures.push_back(fixture_ptr);                
                 ++it;
             }
+            for (auto uuid: removed) {
+                // NOTE: the fixture might've been re-opened in the meantime
+                auto is_open = std::any_of(m_fixtures.begin(), m_fixtures.end(), [uuid](const auto &item) {
+                    return item.second == uuid;
+                });
+                if (!is_open) {
+                    onFixtureRemoved(uuid, lock);
+                }
+            }
             // then process as unlocked
             lock.unlock();
             for (auto &fixture_ptr : fixtures) {
@@ -98,6 +119,13 @@ namespace db0
     void FixtureThread::onFixtureAdded(Fixture &)
     {
     }
+    
+    void FixtureThread::onFixtureRemoved(std::uint64_t, std::unique_lock<std::mutex> &)
+    {
+    }
+
+    // the refresh is forced after this time even if no modifications were detected
+    static constexpr auto REFRESH_SAFETY_INTERVAL = std::chrono::seconds(5);
 
     RefreshThread::RefreshThread()
         : FixtureThread(250)
@@ -107,8 +135,89 @@ namespace db0
     void RefreshThread::onFixtureAdded(Fixture &fixture)
     {
         std::uint64_t uuid = fixture.getUUID();
-        // NOTE: m_fixture_status may already contain this UUID since a fixture might've been closed and then reopened        
-        m_fixture_status[uuid] = FixtureUpdateStatus{fixture.getPrefix().getLastUpdated(), ClockType::now()};
+        auto &prefix = fixture.getPrefix();
+        FixtureUpdateStatus status { prefix.getLastUpdated(), ClockType::now() };
+        auto file_name = prefix.getStorage().getFileName();
+        if (!file_name.empty()) {
+            status.watch_id = m_watcher.add(file_name);
+        }
+        
+        std::unique_lock<std::mutex> lock(m_mutex);
+        // NOTE: m_fixture_status may already contain this UUID since a fixture might've been closed and then reopened
+        auto it = m_fixture_status.find(uuid);
+        if (it != m_fixture_status.end() && it->second.watch_id >= 0) {
+            unwatch(it->second.watch_id, uuid);
+        }
+        m_fixture_status[uuid] = status;
+        if (status.watch_id >= 0) {
+            // NOTE: inotify returns the same watch id for the same file
+            m_watched[status.watch_id].insert(uuid);
+        }
+    }
+    
+    void RefreshThread::onFixtureRemoved(std::uint64_t uuid, std::unique_lock<std::mutex> &)
+    {
+        auto it = m_fixture_status.find(uuid);
+        if (it == m_fixture_status.end()) {
+            return;
+        }
+        if (it->second.watch_id >= 0) {
+            unwatch(it->second.watch_id, uuid);
+        }
+        m_fixture_status.erase(it);
+    }
+    
+    void RefreshThread::unwatch(int watch_id, std::uint64_t uuid)
+    {
+        auto it = m_watched.find(watch_id);
+        if (it == m_watched.end()) {
+            return;
+        }
+        it->second.erase(uuid);
+        if (it->second.empty()) {
+            m_watched.erase(it);
+            m_watcher.remove(watch_id);
+        }
+    }
+    
+    void RefreshThread::waitNext(std::unique_lock<std::mutex> &lock)
+    {
+        if (!m_watcher) {
+            FixtureThread::waitNext(lock);
+            return;
+        }
+        
+        // unwatched fixtures still need to be polled
+        std::chrono::milliseconds timeout = REFRESH_SAFETY_INTERVAL;
+        for (auto &item: m_fixture_status) {
+            if (item.second.watch_id < 0) {
+                timeout = std::chrono::milliseconds(m_interval_ms);
+                break;
+            }
+        }
+        
+        std::vector<int> watch_ids;
+        lock.unlock();
+        m_watcher.wait(timeout, watch_ids);
+        lock.lock();
+        for (auto watch_id: watch_ids) {
+            auto it = m_watched.find(watch_id);
+            if (it == m_watched.end()) {
+                continue;
+            }
+            for (auto uuid: it->second) {
+                auto status_it = m_fixture_status.find(uuid);
+                if (status_it != m_fixture_status.end()) {
+                    status_it->second.modified = true;
+                }
+            }
+        }
+    }
+    
+    void RefreshThread::wakeUp()
+    {
+        FixtureThread::wakeUp();
+        m_watcher.wakeUp();
     }
     
     void RefreshThread::prepareContext()
@@ -133,25 +242,34 @@ namespace db0
         }
         
         std::uint64_t uuid = fixture.getUUID();
-        auto last_updated = prefix_ptr->getLastUpdated();
         auto now = ClockType::now();
-        
-        auto it = m_fixture_status.find(uuid);
-        assert(it != m_fixture_status.end());        
-        FixtureUpdateStatus &update_status = it->second;
-        if (last_updated != update_status.last_updated) {
-            tryRefresh(fixture);
-            update_status.last_updated = last_updated;
-            update_status.last_updated_check_tp = now;
-        } else {
-            if ((now - update_status.last_updated_check_tp) > std::chrono::seconds(5)) {
-                // This is to protect against edge-case hang on 'wait' function,
-                // caused by refresh thread not picking up all cases when prefix file is modified.
-                // The refresh mechanism can potentially be improved in the future.
-                tryRefresh(fixture);
+        bool refresh = false;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            auto it = m_fixture_status.find(uuid);
+            assert(it != m_fixture_status.end());
+            FixtureUpdateStatus &update_status = it->second;
+            if (update_status.watch_id >= 0) {
+                // watched fixture, no need to check the modification timestamp
+                refresh = update_status.modified;
+                update_status.modified = false;
+            } else {
+                auto last_updated = prefix_ptr->getLastUpdated();
+                refresh = (last_updated != update_status.last_updated);
+                update_status.last_updated = last_updated;
+            }
+            // This is to protect against edge-case hang on 'wait' function,
+            // caused by refresh thread not picking up all cases when prefix file is modified.
+            // The refresh mechanism can potentially be improved in the future.
+            if (refresh || (now - update_status.last_updated_check_tp) > REFRESH_SAFETY_INTERVAL) {
+                refresh = true;
                 update_status.last_updated_check_tp = now;
             }
         }
+        
+        if (refresh) {
+            tryRefresh(fixture);
+        }
     }
     
     void RefreshThread::tryRefresh(Fixture &fixture)
@@ -171,28 +289,61 @@ namespace db0
 
     /**
      * Acquires locks for safe execution and handles post-commit callbacks
+     * NOTE: locks are only acquired once the first fixture with pending updates is found,
+     * so that idle cycles don't block atomic / locked sections of other threads
+     * NOTE: if an atomic operation is in progress the cycle is deferred (retried on the next interval)
+     * instead of waiting for the atomic lock while holding the commit / locked-context locks
+     * unless the cycles have been deferred for too long (e.g. back-to-back atomic operations)
      */
     class AutoSaveContext : public FixtureThreadCallbacksContext
     {
         std::unique_lock<std::mutex> m_commit_lock;
         std::unique_lock<std::shared_mutex> m_locked_context_lock;
         std::unique_lock<std::mutex> m_atomic_lock;
+        // wait for the atomic lock instead of deferring
+        const bool m_blocking;
+        bool m_deferred = false;
 
     public:
-        AutoSaveContext(
-            std::unique_lock<std::mutex> &&commit_lock,
-            std::unique_lock<std::shared_mutex> &&locked_context_lock, 
-            std::unique_lock<std::mutex> &&atomic_lock)
-            : m_commit_lock(std::move(commit_lock))
-            , m_locked_context_lock(std::move(locked_context_lock))
-            , m_atomic_lock(std::move(atomic_lock))
-        {}
+        AutoSaveContext(bool blocking)
+            : m_blocking(blocking)
+        {
+        }
         
+        bool isDeferred() const {
+            return m_deferred;
+        }
+
+        // @return false if the cycle has been deferred
+        bool lock()
+        {
+            if (m_commit_lock.owns_lock()) {
+                return true;
+            }
+            if (m_deferred) {
+                return false;
+            }
+            m_commit_lock = std::unique_lock<std::mutex>(AutoCommitThread::m_commit_mutex);
+            // must acquire unique lock-context's lock
+            m_locked_context_lock = db0::LockedContext::lockUnique();
+            // and the atomic lock next (order is relevant here !!)
+            m_atomic_lock = m_blocking ? db0::AtomicContext::lock() : db0::AtomicContext::tryLock();
+            if (!m_atomic_lock.owns_lock()) {
+                m_locked_context_lock.unlock();
+                m_commit_lock.unlock();
+                m_deferred = true;
+                return false;
+            }
+            return true;
+        }
+
         virtual void finalize() override
         {
-            m_locked_context_lock.unlock();
-            m_atomic_lock.unlock();
-            m_commit_lock.unlock();
+            if (m_commit_lock.owns_lock()) {
+                m_locked_context_lock.unlock();
+                m_atomic_lock.unlock();
+                m_commit_lock.unlock();
+            }
             FixtureThreadCallbacksContext::finalize();
         }
     };
@@ -206,6 +357,16 @@ namespace db0
     {
         using LangToolkit = db0::object_model::LangConfig::LangToolkit;
         
+        // skip idle fixtures without taking the global locks (and the interpreter's lock)
+        // NOTE: the flag is re-checked by onAutoCommit under the locks
+        if (!fixture.hasPendingUpdates()) {
+            return;
+        }
+        assert(m_context && "AutoSaveContext must exist here!");
+        if (!m_context->lock()) {
+            // atomic operation in progress, the pending updates will be committed on the next cycle
+            return;
+        }
         // need to lock the language API first
         // otherwise it may deadlock on trying to invoke API calls from auto-commit 
         // (e.g. instance destruction triggered by LangCache::clear)
@@ -223,21 +384,20 @@ namespace db0
     void AutoCommitThread::prepareContext()
     {
         assert(!m_context && "Only one AutoSaveContext should exist at the time!");
-        auto commit_lock = std::unique_lock<std::mutex>(m_commit_mutex);
-        // must acquire unique lock-context's lock
-        auto locked_context_lock = db0::LockedContext::lockUnique();
-        // and the atomic lock next (order is relevant here !!)
-        auto atomic_lock = db0::AtomicContext::lock();
         // To collect callbacks from fixtures as we proceed with commiting
-        m_context = std::make_shared<AutoSaveContext>(std::move(commit_lock),
-            std::move(locked_context_lock), std::move(atomic_lock)
-        );                
+        bool blocking = m_deferred_since && (ClockType::now() - *m_deferred_since) >= MAX_DEFER_TIME;
+        m_context = std::make_shared<AutoSaveContext>(blocking);
     }
 
     void AutoCommitThread::closeContext()
     {
         assert(m_context && "AutoSaveContext must exist here!");
         m_context->finalize();
+        if (!m_context->isDeferred()) {
+            m_deferred_since = std::nullopt;
+        } else if (!m_deferred_since) {
+            m_deferred_since = ClockType::now();
+        }
         m_context = nullptr;
     }
 
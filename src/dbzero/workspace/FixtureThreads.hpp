@@ -5,10 +5,13 @@
 
 #include <dbzero/core/memory/swine_ptr.hpp>
 #include <dbzero/workspace/Fixture.hpp>
+#include <dbzero/core/utils/FileWatcher.hpp>
 #include <thread>
 #include <mutex>
 #include <vector>
 #include <memory>
+#include <unordered_set>
+#include <optional>
 #include <chrono>
 #include <condition_variable>
 
@@ -50,15 +53,27 @@ namespace db0
         std::mutex m_mutex;
         bool m_stopped = false;
 
-        std::vector<weak_swine_ptr<Fixture>> m_fixtures;
+        // registered fixtures with their UUIDs
+        std::vector<std::pair<weak_swine_ptr<Fixture>, std::uint64_t> > m_fixtures;
+
+        // Called (with m_mutex locked) once the last fixture of a specific UUID has been closed
+        virtual void onFixtureRemoved(std::uint64_t uuid, std::unique_lock<std::mutex> &);
 
         virtual void prepareContext() = 0;
         virtual void closeContext() = 0;
+
+        // Wait for the next update cycle (or until stopped), called with m_mutex locked
+        virtual void waitNext(std::unique_lock<std::mutex> &);
+        // Interrupt the pending waitNext call
+        virtual void wakeUp();
     };
     
     /**
      * A thread object to poll fixture modification status
      * applicatble to read-only fixtures
+     * Where possible, prefix files are watched for modifications (see FileWatcher)
+     * so that the fixture gets refreshed immediately after a write (commit) by other process
+     * and idle fixtures are not polled
     */
     class FixtureThreadCallbacksContext;
     class RefreshThread: public FixtureThread
@@ -78,13 +93,26 @@ namespace db0
         struct FixtureUpdateStatus {
             std::uint64_t last_updated;
             ClockType::time_point last_updated_check_tp;
+            // the file watch id or -1 if the fixture is polled
+            int watch_id = -1;
+            // modification reported by the watcher
+            bool modified = false;
         };
 
+        // NOTE: fixture status is protected with m_mutex
         std::unordered_map<std::uint64_t, FixtureUpdateStatus> m_fixture_status;
+        FileWatcher m_watcher;
+        // watch id to UUIDs of the fixtures (the same file may be watched for more than one fixture)
+        // NOTE: the watch is removed once no longer referenced
+        std::unordered_map<int, std::unordered_set<std::uint64_t> > m_watched;
         std::shared_ptr<FixtureThreadCallbacksContext> m_context;
 
+        void onFixtureRemoved(std::uint64_t uuid, std::unique_lock<std::mutex> &) override;
+        void unwatch(int watch_id, std::uint64_t uuid);
         void prepareContext() override;
         void closeContext() override;
+        void waitNext(std::unique_lock<std::mutex> &) override;
+        void wakeUp() override;
     };
 
     /**
@@ -103,8 +131,14 @@ namespace db0
         static std::unique_lock<std::mutex> preventAutoCommit();
 
     private:
+        friend class AutoSaveContext;
+        using ClockType = std::chrono::steady_clock;
+        // the max time the commit can be deferred by atomic operations in progress
+        static constexpr auto MAX_DEFER_TIME = std::chrono::seconds(1);
         static std::mutex m_commit_mutex;
         std::shared_ptr<AutoSaveContext> m_context;
+        // the time of the first deferred cycle (if the last cycle was deferred)
+        std::optional<ClockType::time_point> m_deferred_since;
 
         void prepareContext() override;
         void closeContext() override;
@@ -2,6 +2,7 @@
 // Copyright (c) 2025 DBZero Software sp. z o.o.
 
 #include "GC0.hpp"
+#include "ObjectChangeLog.hpp"
 
 namespace db0
 
@@ -63,14 +64,21 @@ namespace db0
         if (!m_read_only && ops.hasRefs && ops.drop && !is_volatile
             && !ops.hasRefs(it->first))
         {
+            auto addr_pair = ops.address(it->first);
             if (m_commit_pending) {
-                // must schedule for deletion since unable to drop while save is pending
-                auto addr_pair = ops.address(it->first);
+                // must schedule for deletion since unable to drop while save is pending                
                 m_scheduled_for_deletion[addr_pair.first] = addr_pair.second;
             } else {
                 // at this stage just collect the ops and remove the entry
                 drop_op = ops.drop;
             }
+            if (m_change_log) {
+                m_change_log->onDeleted(addr_pair.first, addr_pair.second);
+            }
+        } else if (m_change_log && !m_read_only && static_cast<const vtypeless*>(vptr)->isModified()) {
+            // modifications would otherwise be lost from the commit's scope (modified list)
+            auto addr_pair = ops.address(it->first);
+            m_change_log->onModified(addr_pair.first, addr_pair.second);
         }
         // NOTE: we erase by vptr because hasRefs may have side effects and invalidate the iterator
         m_vptr_map.erase(vptr);
@@ -115,6 +123,10 @@ namespace db0
             auto it = m_vptr_map.find(vptr);
             if (it != m_vptr_map.end()) {
                 auto &ops = ops_list[it->second];
+                if (m_change_log && static_cast<const vtypeless*>(vptr)->isModified()) {
+                    auto addr_pair = ops.address(vptr);
+                    m_change_log->onModified(addr_pair.first, addr_pair.second);
+                }
                 ops.commit(vptr);
                 if (ops.hasRefs && !ops.hasRefs(vptr)) {
                     addresses.insert(toTypedAddress(ops.address(vptr)));
@@ -142,7 +154,12 @@ namespace db0
         std::unique_lock<std::mutex> lock(m_mutex);
         auto &ops_list = getSharedState().m_ops;
         for (auto &vptr_item : m_vptr_map) {
-            ops_list[vptr_item.second].commit(vptr_item.first);
+            auto &ops = ops_list[vptr_item.second];
+            if (m_change_log && static_cast<const vtypeless*>(vptr_item.first)->isModified()) {
+                auto addr_pair = ops.address(vptr_item.first);
+                m_change_log->onModified(addr_pair.first, addr_pair.second);
+            }
+            ops.commit(vptr_item.first);
         }
     }
 
@@ -284,5 +301,11 @@ namespace db0
     std::unique_ptr<GC0::CommitContext> GC0::beginCommit() {
         return std::make_unique<CommitContext>(*this);
     }
+    
+    void GC0::setChangeLog(ObjectChangeLog *change_log)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_change_log = change_log;
+    }
 
 }
\ No newline at end of file
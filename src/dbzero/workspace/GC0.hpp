@@ -21,6 +21,7 @@ namespace db0
         
     class Fixture;
     class ProcessTimer;
+    class ObjectChangeLog;
         
     using TypedAddress = db0::object_model::TypedAddress;
     using StorageClass = db0::object_model::StorageClass;
@@ -141,6 +142,9 @@ namespace db0
         
         std::unique_ptr<CommitContext> beginCommit();
 
+        // Assign the log to report modified / deleted instances to
+        void setChangeLog(ObjectChangeLog *);
+
     protected:
         bool m_commit_pending = false;
         
@@ -167,6 +171,7 @@ namespace db0
         bool m_atomic = false;
         // the list of volatile instances - i.e. created during atomic operation
         std::vector<void*> m_volatile;
+        ObjectChangeLog *m_change_log = nullptr;
         mutable std::mutex m_mutex;
         
         void commitAll();
@@ -0,0 +1,151 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#include "ObjectChangeLog.hpp"
+#include <algorithm>
+#include <vector>
+#include <dbzero/workspace/Fixture.hpp>
+
+namespace db0
+
+{
+
+    ObjectChange::ObjectChange(StateNumType state_num, UniqueAddress address, StorageClass storage_class,
+        ObjectChangeType type)
+        : m_state_num(state_num)
+        , m_address(address)
+        , m_storage_class(storage_class)
+        , m_type(type)
+    {
+    }
+
+    ObjectChangeLog::ObjectChangeLog(db0::swine_ptr<Fixture> &fixture)
+        : super_t(fixture)
+    {
+    }
+
+    ObjectChangeLog::ObjectChangeLog(db0::swine_ptr<Fixture> &fixture, Address address)
+        : super_t(tag_from_address(), fixture, address)
+    {
+    }
+
+    void ObjectChangeLog::onCreated(UniqueAddress address, StorageClass storage_class) {
+        add(address, storage_class, ObjectChangeType::CREATED);
+    }
+
+    void ObjectChangeLog::onModified(UniqueAddress address, StorageClass storage_class) {
+        add(address, storage_class, ObjectChangeType::MODIFIED);
+    }
+
+    void ObjectChangeLog::onDeleted(UniqueAddress address, StorageClass storage_class) {
+        add(address, storage_class, ObjectChangeType::DELETED);
+    }
+
+    void ObjectChangeLog::add(UniqueAddress address, StorageClass storage_class, ObjectChangeType type)
+    {
+        // class / enum definitions are internal (schema) objects, not reported
+        if (storage_class == StorageClass::DB0_CLASS || storage_class == StorageClass::DB0_ENUM_TYPE_REF) {
+            return;
+        }
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        auto it = m_pending.find(address);
+        if (it == m_pending.end()) {
+            m_pending.emplace(address, std::make_pair(storage_class, type));
+            return;
+        }
+
+        auto &prev_type = it->second.second;
+        if (type == ObjectChangeType::DELETED) {
+            if (prev_type == ObjectChangeType::CREATED) {
+                // object did not outlive the transaction
+                m_pending.erase(it);
+            } else {
+                prev_type = type;
+            }
+        } else if (prev_type == ObjectChangeType::MODIFIED) {
+            prev_type = type;
+        }
+    }
+
+    void ObjectChangeLog::commit(StateNumType state_num)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (!m_pending.empty()) {
+            // sort by address for deterministic output
+            std::vector<std::pair<UniqueAddress, std::pair<StorageClass, ObjectChangeType> > > changes(
+                m_pending.begin(), m_pending.end());
+            std::sort(changes.begin(), changes.end(), [](const auto &lhs, const auto &rhs) {
+                return lhs.first < rhs.first;
+            });
+            for (auto &item: changes) {
+                super_t::emplace_back(state_num, item.first, item.second.first, item.second.second);
+            }
+            m_pending.clear();
+        }
+        super_t::commit();
+    }
+
+    void ObjectChangeLog::rollback()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_pending.clear();
+    }
+
+    void ObjectChangeLog::beginAtomic()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        assert(!m_atomic_pending);
+        m_atomic_pending = std::make_unique<PendingMap>(m_pending);
+    }
+
+    void ObjectChangeLog::endAtomic()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        assert(m_atomic_pending);
+        m_atomic_pending = nullptr;
+    }
+
+    void ObjectChangeLog::cancelAtomic()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        assert(m_atomic_pending);
+        m_pending = std::move(*m_atomic_pending);
+        m_atomic_pending = nullptr;
+    }
+
+    bool ObjectChangeLog::forEach(StateNumType from_state, StateNumType to_state,
+        std::function<bool(const ObjectChange &)> callback) const
+    {
+        // binary search for the first change of from_state (entries are ordered by state number)
+        std::size_t lo = 0, hi = super_t::size();
+        while (lo < hi) {
+            auto mid = lo + (hi - lo) / 2;
+            if ((*this)[mid].m_state_num < from_state) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+
+        if (lo == super_t::size()) {
+            return true;
+        }
+        for (auto it = super_t::begin(lo), end = super_t::end(); it != end; ++it) {
+            if ((*it).m_state_num > to_state) {
+                break;
+            }
+            if (!callback(*it)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::size_t ObjectChangeLog::getPendingCount() const
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_pending.size();
+    }
+
+}
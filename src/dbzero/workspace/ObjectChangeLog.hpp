@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#pragma once
+
+#include <mutex>
+#include <memory>
+#include <functional>
+#include <unordered_map>
+#include <dbzero/core/collections/vector/v_bvector.hpp>
+#include <dbzero/core/compiler_attributes.hpp>
+#include <dbzero/core/memory/config.hpp>
+#include <dbzero/object_model/value/StorageClass.hpp>
+#include <dbzero/object_model/has_fixture.hpp>
+
+namespace db0
+
+{
+
+    class Fixture;
+    using StorageClass = db0::object_model::StorageClass;
+
+    enum class ObjectChangeType: std::uint8_t
+    {
+        CREATED = 1,
+        MODIFIED = 2,
+        DELETED = 3
+    };
+
+DB0_PACKED_BEGIN
+
+    struct DB0_PACKED_ATTR ObjectChange
+    {
+        // the state number of the transaction the change was committed with
+        StateNumType m_state_num = 0;
+        UniqueAddress m_address;
+        StorageClass m_storage_class = StorageClass::UNDEFINED;
+        ObjectChangeType m_type = ObjectChangeType::MODIFIED;
+
+        ObjectChange() = default;
+        ObjectChange(StateNumType, UniqueAddress, StorageClass, ObjectChangeType);
+    };
+
+DB0_PACKED_END
+
+    /**
+     * Persisted per-commit log of objects actually created, modified or deleted (object-level change data capture)
+     * Changes are collected from GC0 (modified / dropped instances) and object creation during the transaction
+     * and appended on commit, therefore the log is ordered by the state number
+     * NOTE: objects created and deleted within the same transaction are not reported
+     * NOTE: modifications include changes to the object's ref-counts (e.g. tag assignments)
+    */
+    class ObjectChangeLog: public db0::has_fixture<v_bvector<ObjectChange> >
+    {
+    public:
+        using super_t = db0::has_fixture<v_bvector<ObjectChange> >;
+
+        ObjectChangeLog(db0::swine_ptr<Fixture> &);
+        ObjectChangeLog(db0::swine_ptr<Fixture> &, Address address);
+
+        void onCreated(UniqueAddress, StorageClass);
+        void onModified(UniqueAddress, StorageClass);
+        void onDeleted(UniqueAddress, StorageClass);
+
+        // Append changes of the transaction being committed
+        void commit(StateNumType state_num);
+        // Discard uncommitted changes
+        void rollback();
+
+        void beginAtomic();
+        void endAtomic();
+        void cancelAtomic();
+
+        /**
+         * Visit changes committed within the state range (inclusive) in commit order
+         * @return false if the iteration was interrupted by the callback
+        */
+        bool forEach(StateNumType from_state, StateNumType to_state,
+            std::function<bool(const ObjectChange &)> callback) const;
+
+        // Number of uncommitted changes
+        std::size_t getPendingCount() const;
+
+    private:
+        using PendingMap = std::unordered_map<UniqueAddress, std::pair<StorageClass, ObjectChangeType> >;
+        PendingMap m_pending;
+        // pending changes at the beginning of the atomic operation
+        std::unique_ptr<PendingMap> m_atomic_pending;
+        mutable std::mutex m_mutex;
+
+        void add(UniqueAddress, StorageClass, ObjectChangeType);
+    };
+
+}
@@ -0,0 +1,40 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#include "StorageConfig.hpp"
+#include "Config.hpp"
+#include <dbzero/core/exception/Exceptions.hpp>
+
+namespace db0
+
+{
+    
+    StorageFlags getStorageFlags(const Config &config)
+    {
+        StorageFlags result;
+        if (config.get<bool>("positional_io", false)) {
+            result.set(StorageOptions::POSITIONAL_IO);
+        }
+        if (config.get<bool>("pipelined_commit", false)) {
+            result.set(StorageOptions::PIPELINED_COMMIT);
+        }
+        if (config.get<bool>("change_log", false)) {
+            result.set(StorageOptions::CHANGE_LOG);
+        }
+        if (config.get<bool>("read_ahead", false)) {
+            result.set(StorageOptions::READ_AHEAD);
+        }
+        auto compression = config.get<std::string>("compression");
+        if (compression && *compression != "none") {
+            if (*compression == "lz4") {
+                result.set(StorageOptions::COMPRESS_LZ4);
+            } else if (*compression == "zstd") {
+                result.set(StorageOptions::COMPRESS_ZSTD);
+            } else {
+                THROWF(db0::InputException) << "Unsupported compression: " << *compression;
+            }
+        }
+        return result;
+    }
+    
+}
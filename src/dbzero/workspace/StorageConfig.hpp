@@ -0,0 +1,19 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#pragma once
+
+#include <dbzero/core/storage/StorageFlags.hpp>
+
+namespace db0
+
+{
+
+    class Config;
+    
+    // Translates per-prefix storage options (e.g. a Python dict) into StorageFlags
+    // Recognized keys: "positional_io" (bool), "pipelined_commit" (bool), "change_log" (bool), "read_ahead" (bool),
+    // "compression" ("none", "lz4" or "zstd", only applied when a new prefix is created)
+    StorageFlags getStorageFlags(const Config &);
+    
+}
@@ -34,7 +34,8 @@ namespace db0
         const PrefixName &prefix_name, bool &new_file_created, AccessType access_type, 
         std::optional<std::size_t> page_size, std::optional<std::size_t> slab_size, 
         std::optional<std::size_t> sparse_index_node_size, std::optional<LockFlags> lock_flags,
-        std::optional<std::size_t> meta_io_step_size, std::optional<std::size_t> page_io_step_size)
+        std::optional<std::size_t> meta_io_step_size, std::optional<std::size_t> page_io_step_size,
+        StorageFlags storage_flags)
     {
         if (!page_size) {
             page_size = DEFAULT_PAGE_SIZE;
@@ -54,11 +55,13 @@ namespace db0
                 THROWF(db0::PrefixNotFoundException) << "Prefix does not exist: " << prefix_name;
             }
                         
-            BDevStorage::create(file_name, *page_size, *sparse_index_node_size, page_io_step_size);
+            // NOTE: the page codec is fixed once the prefix is created
+            BDevStorage::create(file_name, *page_size, *sparse_index_node_size, page_io_step_size,
+                getPageCodecType(storage_flags));
             new_file_created = true;
         }
         auto storage = std::make_shared<BDevStorage>(
-            file_name, access_type, lock_flags ? *lock_flags : m_default_lock_flags, meta_io_step_size
+            file_name, access_type, lock_flags ? *lock_flags : m_default_lock_flags, meta_io_step_size, storage_flags
         );
         auto prefix = std::make_shared<PrefixImpl>(
             prefix_name, m_dirty_meter, m_cache_recycler, storage
@@ -246,6 +249,11 @@ namespace db0
         if (autocommit_interval_ms) {
             this->setAutocommitInterval(*autocommit_interval_ms);
         }
+        // apply cache replacement policy if configured
+        auto cache_policy = (m_config ? m_config->get<std::string>("cache_policy") : std::nullopt);
+        if (cache_policy) {
+            getCacheRecycler().setPolicy(parseCachePolicy(*cache_policy));
+        }
     }
     
     Workspace::~Workspace()
@@ -322,6 +330,11 @@ namespace db0
 
         m_default_fixture = {};
         m_current_prefix_history.clear();
+        // NOTE: pinned pages may still be referenced by the closed prefixes' locks
+        for (auto &item: m_shared_page_caches) {
+            item.second->close();
+        }
+        m_shared_page_caches.clear();
         BaseWorkspace::close(timer.get());
     }
     
@@ -337,7 +350,7 @@ namespace db0
         std::optional<AccessType> access_type, std::optional<std::size_t> page_size, 
         std::optional<std::size_t> slab_size, std::optional<std::size_t> sparse_index_node_size, 
         std::optional<bool> autocommit, std::optional<LockFlags> lock_flags, std::optional<std::size_t> meta_io_step_size,
-        std::optional<std::size_t> page_io_step_size)
+        std::optional<std::size_t> page_io_step_size, StorageFlags storage_flags)
     {
         bool file_created = false;
         auto uuid = getUUID(prefix_name);
@@ -352,13 +365,20 @@ namespace db0
                 }
                 bool read_only = (*access_type == AccessType::READ_ONLY);
                 auto [prefix, allocator] = openMemspace(prefix_name, file_created, *access_type, page_size, slab_size, 
-                    sparse_index_node_size, lock_flags, meta_io_step_size, page_io_step_size
+                    sparse_index_node_size, lock_flags, meta_io_step_size, page_io_step_size, storage_flags
                 );
                 if (file_created) {
                     // initialize new fixture
                     Fixture::formatFixture(Memspace(prefix, allocator), *allocator);
                 }
                 auto fixture = db0::make_swine<Fixture>(*this, prefix, allocator, m_next_locked_section_id);
+                if (read_only) {
+                    // NOTE: pages are shared across processes by the prefix UUID
+                    auto shared_cache = tryGetSharedPageCache(prefix->getPageSize());
+                    if (shared_cache) {
+                        prefix->attachSharedCache(shared_cache, fixture->getUUID());
+                    }
+                }
                 if (m_fixture_initializer) {
                     // initialize fixture with a model-specific initializer
                     m_fixture_initializer(fixture, file_created, read_only, false);
@@ -419,10 +439,11 @@ namespace db0
         std::optional<std::size_t> page_size, std::optional<std::size_t> slab_size, 
         std::optional<std::size_t> sparse_index_node_size,
         std::optional<bool> autocommit, std::optional<LockFlags> lock_flags,
-        std::optional<std::size_t> meta_io_step_size, std::optional<std::size_t> page_io_step_size)
+        std::optional<std::size_t> meta_io_step_size, std::optional<std::size_t> page_io_step_size,
+        StorageFlags storage_flags)
     {
         auto fixture = tryGetFixtureEx(px_name, access_type, page_size, slab_size, sparse_index_node_size,
-            autocommit, lock_flags, meta_io_step_size, page_io_step_size
+            autocommit, lock_flags, meta_io_step_size, page_io_step_size, storage_flags
         );
         if (!fixture) {
             THROWF(db0::InputException) << "Prefix: " << px_name << " not found";
@@ -562,10 +583,11 @@ namespace db0
     
     void Workspace::open(const PrefixName &prefix_name, AccessType access_type, std::optional<bool> autocommit,
         std::optional<std::size_t> slab_size, std::optional<LockFlags> lock_flags, 
-        std::optional<std::size_t> meta_io_step_size, std::optional<std::size_t> page_io_step_size)
+        std::optional<std::size_t> meta_io_step_size, std::optional<std::size_t> page_io_step_size,
+        StorageFlags storage_flags)
     {
         auto fixture = getFixtureEx(prefix_name, access_type, {}, slab_size, {}, autocommit, 
-            lock_flags, meta_io_step_size, page_io_step_size
+            lock_flags, meta_io_step_size, page_io_step_size, storage_flags
         );
         // update default fixture
         if (!m_default_fixture || (*m_default_fixture != *fixture)) {
@@ -806,6 +828,22 @@ namespace db0
         return m_fixtures.size();
     }
     
+    std::shared_ptr<SharedPageCache> Workspace::tryGetSharedPageCache(std::size_t page_size)
+    {
+        auto capacity = (m_config ? m_config->get<unsigned long long>("shared_cache_size") : std::nullopt);
+        if (!capacity || !*capacity) {
+            return nullptr;
+        }
+        auto it = m_shared_page_caches.find(page_size);
+        if (it == m_shared_page_caches.end()) {
+            auto shared_cache = std::make_shared<SharedPageCache>(
+                SharedPageCache::getDefaultName(page_size), *capacity, page_size
+            );
+            it = m_shared_page_caches.emplace(page_size, shared_cache).first;
+        }
+        return it->second;
+    }
+    
     std::optional<std::size_t> Workspace::getLangCacheSize() const
     {
         if (m_config) {
@@ -118,7 +118,7 @@ namespace db0
             bool &new_file_created, AccessType = AccessType::READ_WRITE, std::optional<std::size_t> page_size = {}, 
             std::optional<std::size_t> slab_size = {}, std::optional<std::size_t> sparse_index_node_size = {},
             std::optional<LockFlags> lock_flags = {}, std::optional<std::size_t> meta_io_step_size = {},
-            std::optional<std::size_t> page_io_step_size = {}
+            std::optional<std::size_t> page_io_step_size = {}, StorageFlags storage_flags = {}
         );
         
         // Clear all internal in-memory caches
@@ -177,14 +177,14 @@ namespace db0
             std::optional<std::size_t> sparse_index_node_size = {},
             std::optional<bool> autocommit = {}, std::optional<LockFlags> lock_flags = {},
             std::optional<std::size_t> meta_io_step_size = {}, 
-            std::optional<std::size_t> page_io_step_size = {});
+            std::optional<std::size_t> page_io_step_size = {}, StorageFlags storage_flags = {});
         
         swine_ptr<Fixture> getFixtureEx(const PrefixName &, std::optional<AccessType> = AccessType::READ_WRITE,
             std::optional<std::size_t> page_size = {}, std::optional<std::size_t> slab_size = {}, 
             std::optional<std::size_t> sparse_index_node_size = {},
             std::optional<bool> autocommit = {}, std::optional<LockFlags> lock_flags = {},
             std::optional<std::size_t> meta_io_step_size = {}, 
-            std::optional<std::size_t> page_io_step_size = {});
+            std::optional<std::size_t> page_io_step_size = {}, StorageFlags storage_flags = {});
         
         /**
          * Get existing fixture by UUID
@@ -224,10 +224,12 @@ namespace db0
          * @param autocommit flag indicating if the prefix should be auto-committed
          * @param meta_io_step_size the size of the step in the underlying MetaIOStream (16MB by default)
          * @param page_io_step_size parameter only respected for newly created prefixes
+         * @param storage_flags per-prefix storage options (e.g. positional I/O)
         */
         void open(const PrefixName &, AccessType access_type, std::optional<bool> autocommit = {},
             std::optional<std::size_t> slab_size = {}, std::optional<LockFlags> default_lock_flags = {}, 
-            std::optional<std::size_t> meta_io_step_size = {}, std::optional<std::size_t> page_io_step_size = {}
+            std::optional<std::size_t> meta_io_step_size = {}, std::optional<std::size_t> page_io_step_size = {},
+            StorageFlags storage_flags = {}
         );
         
         bool drop(const PrefixName &, bool if_exists = true);
@@ -333,6 +335,8 @@ namespace db0
         std::unordered_map<unsigned int, std::vector<std::pair<std::string, std::uint64_t> > > m_locked_section_log;
         // this is to prevent recursive cleanups (which might result in a deadlock)
         mutable std::atomic<bool> m_cleanup_pending = false;
+        // cross-process page caches by page size (only if shared_cache_size configured)
+        std::unordered_map<std::size_t, std::shared_ptr<SharedPageCache> > m_shared_page_caches;
         
         void forEachMemspace(std::function<bool(Memspace &)> callback) override;
         
@@ -342,7 +346,9 @@ namespace db0
         void onFlushDirty(std::size_t limit) override;
 
         std::optional<std::size_t> getLangCacheSize() const;
-        std::shared_ptr<WorkspaceView> getWorkspaceHeadView() const;        
+        std::shared_ptr<WorkspaceView> getWorkspaceHeadView() const;
+        // @return nullptr if the shared page cache is not configured
+        std::shared_ptr<SharedPageCache> tryGetSharedPageCache(std::size_t page_size);        
     };
     
 }
\ No newline at end of file
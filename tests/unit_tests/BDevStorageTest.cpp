@@ -12,6 +12,8 @@
 #include <dbzero/core/dram/DRAM_Allocator.hpp>
 #include <dbzero/core/memory/AccessOptions.hpp>
 #include <thread>
+#include <set>
+#include <filesystem>
 
 using namespace std;
 using namespace db0;
@@ -566,4 +568,361 @@ namespace tests
         cut.close();
     }
 
+    TEST_F( BDevStorageTest , testPositionalIOConcurrentReads )
+    {
+        srand(9142424u);
+        BDevStorage::create(file_name);
+        std::unordered_map<std::uint64_t, std::vector<char>> pages;
+        std::size_t page_size = 0;
+        {
+            BDevStorage cut(file_name, AccessType::READ_WRITE, {}, {}, { StorageOptions::POSITIONAL_IO });
+            page_size = cut.getPageSize();
+            for (int i = 0; i < 200; ++i) {
+                auto page_num = rand() % 10000;
+                if (pages.find(page_num) != pages.end()) {
+                    continue;
+                }
+                auto &page = pages.insert({page_num, randomPage(page_size)}).first->second;
+                cut.write(page_num * page_size, 1, page.size(), page.data());
+            }
+            cut.close();
+        }
+        
+        BDevStorage cut(file_name, AccessType::READ_ONLY, {}, {}, { StorageOptions::POSITIONAL_IO });
+        std::atomic<unsigned int> error_count = 0;
+        std::vector<std::thread> readers;
+        for (int i = 0; i < 4; ++i) {
+            readers.emplace_back([&]() {
+                std::vector<char> read_buffer(page_size);
+                for (int n = 0; n < 5; ++n) {
+                    for (auto &page: pages) {
+                        cut.read(page.first * page_size, 1, read_buffer.size(), read_buffer.data(), { AccessOptions::read });
+                        if (!equal(page.second, read_buffer)) {
+                            ++error_count;
+                        }
+                    }
+                }
+            });
+        }
+        for (auto &reader: readers) {
+            reader.join();
+        }
+        ASSERT_EQ(error_count, 0u);
+        cut.close();
+    }
+    
+    TEST_F( BDevStorageTest , testBatchedReadOfDiffEncodedPageRange )
+    {
+        srand(9142424u);
+        std::size_t page_size = 4096;
+        unsigned int page_count = 16;
+        for (auto flags: { StorageFlags(), StorageFlags { StorageOptions::POSITIONAL_IO } }) {
+            drop(file_name);
+            BDevStorage::create(file_name, page_size);
+            BDevStorage cut(file_name, AccessType::READ_WRITE, {}, {}, flags);
+            // expected contents of the entire range by state number
+            std::vector<std::vector<std::byte> > states;
+            states.emplace_back(page_size * page_count, std::byte{0});
+            for (unsigned int i = 0; i < states.back().size(); ++i) {
+                states.back()[i] = (std::byte)(rand() % 256);
+            }
+            cut.write(0, 1, states.back().size(), states.back().data());
+            cut.flush();
+            for (StateNumType state_num = 2; state_num < 30; ++state_num) {
+                auto next = states.back();
+                // modify a few random pages (a single byte each)
+                std::set<unsigned int> page_nums;
+                while (page_nums.size() < 4) {
+                    page_nums.insert(rand() % page_count);
+                }
+                for (auto page_num: page_nums) {
+                    auto dp_0 = states.back().data() + page_num * page_size;
+                    auto dp_1 = next.data() + page_num * page_size;
+                    dp_1[rand() % page_size] = (std::byte)(rand() % 256);
+                    std::vector<std::uint16_t> diffs;
+                    if (!db0::getDiffs(dp_0, dp_1, page_size, diffs) 
+                        || !cut.tryWriteDiffs(page_num * page_size, state_num, page_size, dp_1, diffs))
+                    {
+                        cut.write(page_num * page_size, state_num, page_size, dp_1);
+                    }
+                }
+                cut.flush();
+                states.push_back(next);
+            }
+            
+            // read the entire range at each state with a single call
+            for (StateNumType state_num = 1; state_num < 30; ++state_num) {
+                std::vector<std::byte> buffer(page_size * page_count);
+                cut.read(0, state_num, buffer.size(), buffer.data(), { AccessOptions::read });
+                ASSERT_TRUE(buffer == states[state_num - 1]);
+            }
+            cut.close();
+        }
+    }
+    
+    TEST_F( BDevStorageTest , testPipelinedCommitStatesAreVisibleWhenDurable )
+    {
+        srand(9142424u);
+        BDevStorage::create(file_name);
+        std::vector<std::vector<char> > pages;
+        BDevStorage cut(file_name, AccessType::READ_WRITE, {}, {}, { StorageOptions::PIPELINED_COMMIT });
+        auto page_size = cut.getPageSize();
+        for (StateNumType state_num = 1; state_num <= 20; ++state_num) {
+            pages.push_back(randomPage(page_size));
+            cut.write(state_num * page_size, state_num, page_size, pages.back().data());
+            // the writer may proceed with the next transaction before this one is durable
+            ASSERT_TRUE(cut.flush());
+            if (state_num % 5 == 0) {
+                cut.waitDurable(state_num);
+                // a reader must observe the durable state
+                BDevStorage reader(file_name, AccessType::READ_ONLY);
+                ASSERT_EQ(reader.getMaxStateNum(), state_num);
+                std::vector<char> buffer(page_size);
+                reader.read(state_num * page_size, state_num, page_size, buffer.data(), { AccessOptions::read });
+                ASSERT_TRUE(equal(pages.back(), buffer));
+                reader.close();
+            }
+        }
+        cut.close();
+        
+        BDevStorage reader(file_name, AccessType::READ_ONLY);
+        ASSERT_EQ(reader.getMaxStateNum(), 20u);
+        std::vector<char> buffer(page_size);
+        for (StateNumType state_num = 1; state_num <= 20; ++state_num) {
+            reader.read(state_num * page_size, 20, page_size, buffer.data(), { AccessOptions::read });
+            ASSERT_TRUE(equal(pages[state_num - 1], buffer));
+        }
+        reader.close();
+    }
+    
+    TEST_F( BDevStorageTest , testPipelinedCommitRejectsWaitForFutureState )
+    {
+        BDevStorage::create(file_name);
+        BDevStorage cut(file_name, AccessType::READ_WRITE, {}, {}, { StorageOptions::PIPELINED_COMMIT });
+        auto page_size = cut.getPageSize();
+        auto page = randomPage(page_size);
+        cut.write(page_size, 1, page_size, page.data());
+        ASSERT_TRUE(cut.flush());
+        cut.waitDurable(1);
+        ASSERT_THROW(cut.waitDurable(2), db0::InputException);
+        cut.close();
+    }
+    
+    TEST_F( BDevStorageTest , testCommitPipelineErrorIsReportedToAllWaiters )
+    {
+        CommitPipeline cut;
+        cut.submit(1, []() {
+            THROWF(db0::IOException) << "fsync failed" << THROWF_END;
+        });
+        ASSERT_THROW(cut.waitDurable(1), db0::IOException);
+        // the state is not durable, the error must not be cleared by the first waiter
+        ASSERT_THROW(cut.waitDurable(), db0::IOException);
+        ASSERT_THROW(cut.stop(), db0::IOException);
+        ASSERT_EQ(cut.getDurableStateNum(), 0u);
+    }
+    
+    TEST_F( BDevStorageTest , testCompressedPagesWriteReadAndOverwrite )
+    {
+        std::vector<PageCodecType> codecs;
+        for (auto codec: { PageCodecType::LZ4, PageCodecType::ZSTD }) {
+            if (isSupported(codec)) {
+                codecs.push_back(codec);
+            }
+        }
+        if (codecs.empty()) {
+            GTEST_SKIP() << "No page compression codecs available in this build";
+        }
+        
+        srand(9142424u);
+        std::size_t page_size = 4096;
+        unsigned int page_count = 32;
+        // compressible page contents (random bytes in a mostly zeroed page)
+        auto nextPage = [&]() {
+            std::vector<std::byte> page(page_size, std::byte{0});
+            for (unsigned int i = 0; i < 64; ++i) {
+                page[rand() % page_size] = (std::byte)(rand() % 256);
+            }
+            return page;
+        };
+        for (auto codec: codecs) {
+            drop(file_name);
+            BDevStorage::create(file_name, page_size, {}, {}, codec);
+            std::vector<std::vector<std::byte> > states;
+            {
+                BDevStorage cut(file_name, AccessType::READ_WRITE);
+                ASSERT_EQ(cut.getPageCodecType(), codec);
+                std::vector<std::byte> data;
+                for (unsigned int i = 0; i < page_count; ++i) {
+                    auto page = nextPage();
+                    data.insert(data.end(), page.begin(), page.end());
+                }
+                cut.write(0, 1, data.size(), data.data());
+                // read back (and overwrite) before the transaction is flushed
+                std::vector<std::byte> buffer(data.size());
+                cut.read(0, 1, buffer.size(), buffer.data(), { AccessOptions::read });
+                ASSERT_TRUE(buffer == data);
+                auto page = nextPage();
+                std::copy(page.begin(), page.end(), data.begin() + 3 * page_size);
+                cut.write(3 * page_size, 1, page_size, page.data());
+                cut.read(0, 1, buffer.size(), buffer.data(), { AccessOptions::read });
+                ASSERT_TRUE(buffer == data);
+                cut.flush();
+                states.push_back(data);
+                
+                for (StateNumType state_num = 2; state_num < 10; ++state_num) {
+                    auto next = states.back();
+                    for (unsigned int i = 0; i < 4; ++i) {
+                        // NOTE: distinct pages are modified within a single transaction
+                        auto page_num = (rand() % (page_count / 4)) * 4 + i;
+                        auto dp_0 = states.back().data() + page_num * page_size;
+                        auto dp_1 = next.data() + page_num * page_size;
+                        dp_1[rand() % page_size] = (std::byte)(rand() % 256);
+                        std::vector<std::uint16_t> diffs;
+                        // mix full-DP and diff-DP updates
+                        if (i % 2 || !db0::getDiffs(dp_0, dp_1, page_size, diffs) 
+                            || !cut.tryWriteDiffs(page_num * page_size, state_num, page_size, dp_1, diffs))
+                        {
+                            cut.write(page_num * page_size, state_num, page_size, dp_1);
+                        }
+                    }
+                    cut.flush();
+                    states.push_back(next);
+                }
+                std::uint64_t compressed_bytes = 0;
+                cut.getStats([&](const std::string &name, std::uint64_t value) {
+                    if (name == "page_io_compressed_bytes") {
+                        compressed_bytes = value;
+                    }
+                });
+                ASSERT_GT(compressed_bytes, 0u);
+                cut.close();
+            }
+            
+            BDevStorage reader(file_name, AccessType::READ_ONLY);
+            for (StateNumType state_num = 1; state_num < 10; ++state_num) {
+                std::vector<std::byte> buffer(page_size * page_count);
+                reader.read(0, state_num, buffer.size(), buffer.data(), { AccessOptions::read });
+                ASSERT_TRUE(buffer == states[state_num - 1]);
+            }
+            reader.close();
+        }
+    }
+    
+    
+    std::uint64_t getDRAMCheckpointState(const BDevStorage &storage)
+    {
+        std::uint64_t result = 0;
+        storage.getStats([&](const std::string &name, std::uint64_t value) {
+            if (name == "dram_io_checkpoint_state") {
+                result = value;
+            }
+        });
+        return result;
+    }
+    
+    TEST_F( BDevStorageTest , testDRAMCheckpointIsUsedOnOpen )
+    {
+        srand(9142424u);
+        BDevStorage::create(file_name);
+        std::unordered_map<std::uint64_t, std::vector<char> > pages;
+        StateNumType state_num = 1;
+        auto writeStates = [&](BDevStorage &storage, unsigned int count) {
+            auto page_size = storage.getPageSize();
+            for (unsigned int i = 0; i < count; ++i, ++state_num) {
+                for (int j = 0; j < 8; ++j) {
+                    auto page_num = rand() % 2000;
+                    auto &page = pages[page_num] = randomPage(page_size);
+                    storage.write(page_num * page_size, state_num, page_size, page.data());
+                }
+                storage.flush();
+            }
+        };
+        auto validate = [&](BDevStorage &storage) {
+            std::vector<char> buffer(storage.getPageSize());
+            for (auto &page: pages) {
+                storage.read(page.first * buffer.size(), state_num - 1, buffer.size(), buffer.data(),
+                    { AccessOptions::read });
+                ASSERT_TRUE(equal(page.second, buffer));
+            }
+        };
+        
+        {
+            BDevStorage cut(file_name);
+            ASSERT_EQ(getDRAMCheckpointState(cut), 0u);
+            writeStates(cut, BDevStorage::DRAM_CHECKPOINT_INTERVAL + 20);
+            // the reader opens from the periodic checkpoint while the writer is still active
+            BDevStorage reader(file_name, AccessType::READ_ONLY);
+            ASSERT_EQ(getDRAMCheckpointState(reader), BDevStorage::DRAM_CHECKPOINT_INTERVAL);
+            ASSERT_EQ(reader.getMaxStateNum(), state_num - 1);
+            validate(reader);
+            reader.close();
+            cut.close();
+        }
+        {
+            // the checkpoint written on close
+            BDevStorage cut(file_name);
+            ASSERT_EQ(getDRAMCheckpointState(cut), state_num - 1);
+            validate(cut);
+            writeStates(cut, 10);
+            cut.close();
+        }
+        BDevStorage reader(file_name, AccessType::READ_ONLY);
+        ASSERT_EQ(getDRAMCheckpointState(reader), state_num - 1);
+        validate(reader);
+        reader.close();
+    }
+    
+    TEST_F( BDevStorageTest , testDRAMCheckpointNotUsedByWriterAfterAbort )
+    {
+        srand(9142424u);
+        BDevStorage::create(file_name);
+        std::unordered_map<std::uint64_t, std::vector<char> > pages;
+        StateNumType state_num = 1;
+        {
+            BDevStorage cut(file_name);
+            auto page_size = cut.getPageSize();
+            for (; state_num <= 20; ++state_num) {
+                auto page_num = rand() % 100;
+                auto &page = pages[page_num] = randomPage(page_size);
+                cut.write(page_num * page_size, state_num, page_size, page.data());
+                cut.flush();
+            }
+            cut.close();
+        }
+        // a copy of the file taken while the writer is active (i.e. as if the writer was terminated)
+        const char *copy_name = "my-test-prefix_1-copy.db0";
+        drop(copy_name);
+        {
+            BDevStorage cut(file_name);
+            ASSERT_EQ(getDRAMCheckpointState(cut), 20u);
+            auto page_size = cut.getPageSize();
+            for (; state_num <= 30; ++state_num) {
+                auto page_num = rand() % 100;
+                auto &page = pages[page_num] = randomPage(page_size);
+                cut.write(page_num * page_size, state_num, page_size, page.data());
+                cut.flush();
+            }
+            std::filesystem::copy_file(file_name, copy_name);
+            cut.close();
+        }
+        
+        // the checkpoint is still usable by readers
+        {
+            BDevStorage reader(copy_name, AccessType::READ_ONLY);
+            ASSERT_EQ(getDRAMCheckpointState(reader), 20u);
+            ASSERT_EQ(reader.getMaxStateNum(), 30u);
+            reader.close();
+        }
+        
+        BDevStorage cut(copy_name);
+        ASSERT_EQ(getDRAMCheckpointState(cut), 0u);
+        std::vector<char> buffer(cut.getPageSize());
+        for (auto &page: pages) {
+            cut.read(page.first * buffer.size(), 30, buffer.size(), buffer.data(), { AccessOptions::read });
+            ASSERT_TRUE(equal(page.second, buffer));
+        }
+        cut.close();
+        drop(copy_name);
+    }
+    
 }
@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#include <gtest/gtest.h>
+#include <dbzero/core/memory/PrefixCache.hpp>
+#include <dbzero/core/memory/AccessOptions.hpp>
+#include <dbzero/core/memory/DP_Lock.hpp>
+#include <dbzero/core/memory/CacheRecycler.hpp>
+#include <dbzero/core/storage/Storage0.hpp>
+
+using namespace std;
+using namespace db0;
+
+namespace tests
+
+{
+
+    class CacheRecyclerTest: public testing::Test
+    {
+    public:
+        static constexpr std::size_t CACHED_PAGES = 64;
+        static constexpr std::size_t HOT_PAGES = 8;
+
+        // Touch the hot set, then scan through pages not fitting in cache
+        // @return number of the hot pages retained in cache
+        std::size_t runScan(CachePolicy policy)
+        {
+            db0::Storage0 dev_null;
+            std::atomic<std::size_t> null_meter = 0;
+            db0::CacheRecycler cache_recycler(1 << 20u, null_meter);
+            cache_recycler.setPolicy(policy);
+            PrefixCache cache(dev_null, &cache_recycler, 0);
+            auto lock_size = cache.createPage(1000, 1, 0, { AccessOptions::read })->usedMem();
+            cache_recycler.clear();
+            cache_recycler.resize(CACHED_PAGES * lock_size);
+
+            std::vector<std::weak_ptr<DP_Lock> > hot_locks;
+            for (std::uint64_t page_num = 0; page_num < HOT_PAGES; ++page_num) {
+                hot_locks.push_back(cache.createPage(page_num, 1, 0, { AccessOptions::read }));
+            }
+            for (int i = 0; i < 2; ++i) {
+                for (auto &weak_lock: hot_locks) {
+                    cache_recycler.update(weak_lock.lock());
+                }
+            }
+            // scan through 4x the cache capacity
+            for (std::uint64_t page_num = 100; page_num < 100 + 4 * CACHED_PAGES; ++page_num) {
+                cache.createPage(page_num, 1, 0, { AccessOptions::read });
+            }
+
+            std::size_t result = 0;
+            for (auto &weak_lock: hot_locks) {
+                if (!weak_lock.expired()) {
+                    ++result;
+                }
+            }
+            EXPECT_LE(cache_recycler.size(), CACHED_PAGES * lock_size);
+            cache.release();
+            return result;
+        }
+    };
+
+    TEST_F( CacheRecyclerTest , testScanEvictsWorkingSetWithLRU )
+    {
+        ASSERT_EQ(runScan(CachePolicy::LRU), 0u);
+    }
+
+    TEST_F( CacheRecyclerTest , testWorkingSetSurvivesScanWithS3FIFO )
+    {
+        ASSERT_EQ(runScan(CachePolicy::S3_FIFO), HOT_PAGES);
+    }
+
+    TEST_F( CacheRecyclerTest , testLRUHitDefersEviction )
+    {
+        db0::Storage0 dev_null;
+        std::atomic<std::size_t> null_meter = 0;
+        db0::CacheRecycler cache_recycler(1 << 20u, null_meter);
+        PrefixCache cache(dev_null, &cache_recycler, 0);
+        auto lock_size = cache.createPage(1000, 1, 0, { AccessOptions::read })->usedMem();
+        cache_recycler.clear();
+        cache_recycler.resize(CACHED_PAGES * lock_size);
+        cache_recycler.setFlushSize(lock_size);
+        
+        std::vector<std::weak_ptr<DP_Lock> > locks;
+        for (std::uint64_t page_num = 0; page_num < CACHED_PAGES; ++page_num) {
+            locks.push_back(cache.createPage(page_num, 1, 0, { AccessOptions::read }));
+        }
+        // the hit is recorded without the mutex
+        cache_recycler.update(locks[0].lock());
+        cache.createPage(CACHED_PAGES, 1, 0, { AccessOptions::read });
+        // the least recently used lock is evicted instead
+        ASSERT_FALSE(locks[0].expired());
+        ASSERT_TRUE(locks[1].expired());
+        cache.release();
+    }
+    
+    TEST_F( CacheRecyclerTest , testCachedLocksRetainedOnPolicyChange )
+    {
+        db0::Storage0 dev_null;
+        std::atomic<std::size_t> null_meter = 0;
+        db0::CacheRecycler cache_recycler(1 << 20u, null_meter);
+        cache_recycler.setPolicy(CachePolicy::S3_FIFO);
+        PrefixCache cache(dev_null, &cache_recycler, 0);
+        for (std::uint64_t page_num = 0; page_num < 16; ++page_num) {
+            cache.createPage(page_num, 1, 0, { AccessOptions::read });
+        }
+        auto size = cache_recycler.size();
+
+        cache_recycler.setPolicy(CachePolicy::LRU);
+        std::size_t count = 0;
+        cache_recycler.forEach([&](std::shared_ptr<ResourceLock>) {
+            ++count;
+        });
+        ASSERT_EQ(count, 16u);
+        ASSERT_EQ(cache_recycler.size(), size);
+
+        cache_recycler.clear();
+        ASSERT_EQ(cache_recycler.size(), 0u);
+        cache.release();
+    }
+
+    TEST_F( CacheRecyclerTest , testParseCachePolicy )
+    {
+        ASSERT_EQ(parseCachePolicy("lru"), CachePolicy::LRU);
+        ASSERT_EQ(parseCachePolicy("s3fifo"), CachePolicy::S3_FIFO);
+        ASSERT_ANY_THROW(parseCachePolicy("clock"));
+    }
+
+}
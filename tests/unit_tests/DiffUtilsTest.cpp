@@ -7,6 +7,10 @@
 #include <cstdint>
 #include <cstring>
 #include <dbzero/core/memory/diff_utils.hpp>
+#include <dbzero/core/memory/diff_kernels.hpp>
+#include <random>
+#include <chrono>
+#include <iostream>
 
 using namespace std;
 using namespace db0;
@@ -17,7 +21,25 @@ namespace tests
 
     class DiffUtilsTest : public testing::Test
     {
+    public:
+        void TearDown() override {
+            setDiffKernels(getBestSIMD_Level());
+        }
     };
+
+    // Generate a page with a few sparse updates (as typically produced by a transaction)
+    void makeSparseUpdate(std::mt19937 &gen, const std::vector<std::uint8_t> &base, std::vector<std::uint8_t> &result,
+        unsigned update_count, unsigned max_len)
+    {
+        result = base;
+        for (unsigned i = 0; i < update_count; ++i) {
+            auto len = 1 + gen() % max_len;
+            auto pos = gen() % (base.size() - len);
+            for (unsigned j = 0; j < len; ++j) {
+                result[pos + j] = gen();
+            }
+        }
+    }
     
     TEST_F( DiffUtilsTest, testCalculateDPDiff )
     {
@@ -208,4 +230,92 @@ namespace tests
         );        
     }
     
-}
\ No newline at end of file
+    TEST_F( DiffUtilsTest, testDiffKernelsProduceIdenticalEncoding )
+    {
+        std::mt19937 gen(142);
+        const std::size_t page_size = 4096;
+        std::vector<std::uint8_t> base(page_size), zero_base(page_size);
+        for (auto &b: base) {
+            b = gen();
+        }
+        DiffRange diff_ranges(std::vector<std::pair<std::uint16_t, std::uint16_t>> {
+            { 0, 3 }, { 100, 140 }, { 1023, 1024 }, { 4000, 4096 }
+        });
+        for (auto level: { SIMD_Level::SSE2, SIMD_Level::AVX2, SIMD_Level::AVX512, SIMD_Level::NEON }) {
+            if (!isSupported(level)) {
+                continue;
+            }
+            for (int i = 0; i < 200; ++i) {
+                std::vector<std::uint8_t> page, zero_page;
+                makeSparseUpdate(gen, base, page, 1 + i % 20, 1 + i % 67);
+                makeSparseUpdate(gen, zero_base, zero_page, 1 + i % 20, 1 + i % 67);
+                for (auto view: { DiffRangeView(), DiffRangeView(diff_ranges), DiffRangeView(diff_ranges, 64, 2048) }) {
+                    auto size = view ? (i % 2 ? page_size : 2048 - 64) : page_size;
+                    std::vector<std::uint16_t> expected, expected_zero, actual;
+                    ASSERT_TRUE(setDiffKernels(SIMD_Level::SCALAR));
+                    auto r1 = getDiffs(base.data(), page.data(), size, expected, 0, {}, view);
+                    auto z1 = getDiffs(zero_page.data(), size, expected_zero, 0, {}, view);
+                    ASSERT_TRUE(setDiffKernels(level));
+                    ASSERT_EQ(r1, getDiffs(base.data(), page.data(), size, actual, 0, {}, view));
+                    ASSERT_EQ(expected, actual);
+                    ASSERT_EQ(z1, getDiffs(zero_page.data(), size, actual, 0, {}, view));
+                    ASSERT_EQ(expected_zero, actual);
+                }
+            }
+        }
+    }
+
+    TEST_F( DiffUtilsTest, testApplyDiffsRestoresSparseUpdates )
+    {
+        std::mt19937 gen(7);
+        std::vector<std::uint8_t> base(4096);
+        for (auto &b: base) {
+            b = gen();
+        }
+        for (int i = 0; i < 100; ++i) {
+            std::vector<std::uint8_t> page;
+            makeSparseUpdate(gen, base, page, 1 + i % 10, 1 + i % 130);
+            std::vector<std::uint16_t> diffs;
+            ASSERT_TRUE(getDiffs(base.data(), page.data(), page.size(), diffs));
+            std::vector<std::uint8_t> result = base;
+            auto dp_result = reinterpret_cast<std::byte*>(result.data());
+            applyDiffs(diffs, page.data(), dp_result, dp_result + result.size());
+            ASSERT_EQ(page, result);
+        }
+    }
+
+    TEST_F( DiffUtilsTest, testDiffKernelsSpeed )
+    {
+        std::mt19937 gen(42);
+        const std::size_t page_size = 16384;
+        std::vector<std::uint8_t> base(page_size);
+        for (auto &b: base) {
+            b = gen();
+        }
+        // realistic sparse updates: a few short modified areas per page
+        std::vector<std::vector<std::uint8_t> > pages(64);
+        for (auto &page: pages) {
+            makeSparseUpdate(gen, base, page, 8, 24);
+        }
+        std::vector<std::uint16_t> result;
+        for (auto level: { SIMD_Level::SCALAR, SIMD_Level::SSE2, SIMD_Level::AVX2, SIMD_Level::AVX512, SIMD_Level::NEON }) {
+            if (!setDiffKernels(level)) {
+                continue;
+            }
+            std::size_t total = 0;
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < 100; ++i) {
+                for (auto &page: pages) {
+                    getDiffs(base.data(), page.data(), page_size, result);
+                    total += result.size();
+                }
+            }
+            auto end = std::chrono::high_resolution_clock::now();
+            auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+            std::cout << "getDiffs (level " << static_cast<int>(level) << "): " << elapsed.count() / 1000.0 << "ms, "
+                << (100.0 * pages.size() * page_size) / std::max<std::int64_t>(1, elapsed.count()) << " MB/s" << std::endl;
+            ASSERT_TRUE(total > 0);
+        }
+    }
+
+}
@@ -194,4 +194,33 @@ namespace tests
         cut.flush();
     }
     
-}
\ No newline at end of file
+    TEST_F( Diff_IOTest , testDiff_IOReadRawCompressedPageOverwrittenInSameTransaction )
+    {
+        CFile::create(file_name, {});
+        CFile file(file_name, AccessType::READ_WRITE);
+        auto tail_function = [&file]() -> std::uint64_t {
+            return file.size();
+        };
+        
+        // NOTE: the raw codec is available in every build
+        auto &codec = getPageCodec(PageCodecType::NONE);
+        Diff_IOProxy cut(0, file, page_size, page_size * 16, 0, 0, tail_function);
+        auto first_page_num = cut.appendCompressed(m_dp_1.data(), {5, 1}, codec).first;
+        auto other_page_num = cut.appendCompressed(m_dp_0.data(), {6, 1}, codec).first;
+        // the same page / state overwritten before the storage page is flushed
+        auto page_num = cut.appendCompressed(m_dp_2.data(), {5, 1}, codec).first;
+        ASSERT_NE(first_page_num, page_num);
+        cut.flush();
+        
+        std::vector<std::byte> work_buf;
+        std::vector<std::byte> dp(page_size);
+        cut.readCompressed(page_num, nullptr, dp.data(), {5, 1}, work_buf);
+        ASSERT_EQ(std::memcmp(m_dp_2.data(), dp.data(), page_size), 0);
+        cut.readCompressed(other_page_num, nullptr, dp.data(), {6, 1}, work_buf);
+        ASSERT_EQ(std::memcmp(m_dp_0.data(), dp.data(), page_size), 0);
+        // the outdated version remains readable from its own storage page
+        cut.readCompressed(first_page_num, nullptr, dp.data(), {5, 1}, work_buf);
+        ASSERT_EQ(std::memcmp(m_dp_1.data(), dp.data(), page_size), 0);
+    }
+    
+}
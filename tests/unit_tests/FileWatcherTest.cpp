@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+#include <dbzero/core/utils/FileWatcher.hpp>
+
+using namespace std;
+
+namespace tests
+
+{
+
+    class FileWatcherTest: public testing::Test
+    {
+    public:
+        static constexpr const char *file_name = "./file-watcher-test.dat";
+
+        virtual void SetUp() override {
+            std::ofstream(file_name) << "test";
+        }
+
+        virtual void TearDown() override {
+            std::remove(file_name);
+        }
+    };
+
+    TEST_F( FileWatcherTest , testWaitTimesOutIfNotModified )
+    {
+        db0::FileWatcher cut;
+        if (!cut) {
+            GTEST_SKIP() << "FileWatcher not supported";
+        }
+        ASSERT_TRUE(cut.add(file_name) >= 0);
+        std::vector<int> watch_ids;
+        ASSERT_FALSE(cut.wait(std::chrono::milliseconds(10), watch_ids));
+        ASSERT_TRUE(watch_ids.empty());
+    }
+
+    TEST_F( FileWatcherTest , testWaitReportsFileModification )
+    {
+        db0::FileWatcher cut;
+        if (!cut) {
+            GTEST_SKIP() << "FileWatcher not supported";
+        }
+        auto watch_id = cut.add(file_name);
+        ASSERT_TRUE(watch_id >= 0);
+        std::ofstream(file_name, std::ios::app) << "modified";
+        std::vector<int> watch_ids;
+        ASSERT_TRUE(cut.wait(std::chrono::seconds(5), watch_ids));
+        ASSERT_FALSE(watch_ids.empty());
+        for (auto id: watch_ids) {
+            ASSERT_EQ(id, watch_id);
+        }
+    }
+
+    TEST_F( FileWatcherTest , testWakeUpInterruptsWait )
+    {
+        db0::FileWatcher cut;
+        if (!cut) {
+            GTEST_SKIP() << "FileWatcher not supported";
+        }
+        ASSERT_TRUE(cut.add(file_name) >= 0);
+        std::thread waker([&]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            cut.wakeUp();
+        });
+        std::vector<int> watch_ids;
+        auto start = std::chrono::steady_clock::now();
+        ASSERT_TRUE(cut.wait(std::chrono::seconds(30), watch_ids));
+        waker.join();
+        ASSERT_TRUE(std::chrono::steady_clock::now() - start < std::chrono::seconds(10));
+        ASSERT_TRUE(watch_ids.empty());
+    }
+
+}
@@ -6,8 +6,14 @@
 #include <unordered_set>
 #include <initializer_list>
 #include <set>
+#include <list>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
 
 #include <dbzero/core/collections/b_index/mb_index.hpp>
+#include <dbzero/core/collections/full_text/FT_IndexIterator.hpp>
+#include <dbzero/core/collections/full_text/FT_ANDIterator.hpp>
 
 namespace tests
 
@@ -459,4 +465,105 @@ namespace tests
 		ASSERT_EQ(0, count);
 	}
 
+
+	TEST_F( MorphingBIndexTest , testIndexIteratorSkipWithAllMorphologies )
+	{
+		auto memspace = getMemspace();
+		using IteratorT = FT_IndexIterator<index_t, std::uint64_t>;
+		// sizes to produce all morphologies (itty, array, sorted vector, v_bindex)
+		for (unsigned int size: { 1u, 3u, 100u, 20000u }) {
+			std::vector<std::uint64_t> keys;
+			for (unsigned int i = 0; i < size; ++i) {
+				keys.push_back(i * 3 + 1);
+			}
+			index_t cut(memspace, bindex::type::empty);
+			cut.bulkInsertUnique(keys.begin(), keys.end());
+			if (size == 20000u) {
+				ASSERT_EQ(bindex::type::bindex, cut.getIndexType());
+			}
+			
+			for (int direction: { 1, -1 }) {
+				IteratorT it(cut, direction);
+				std::size_t total_size = 0;
+				ASSERT_TRUE(it.tryGetSize(total_size));
+				ASSERT_EQ(size, total_size);
+				for (std::size_t count: { 0u, 1u, 2u, 77u, 5000u, 100000u }) {
+					IteratorT it(cut, direction);
+					ASSERT_EQ(count <= size, it.skip(count));
+					if (count < size) {
+						auto expected = (direction > 0) ? keys[count] : keys[size - count - 1];
+						ASSERT_FALSE(it.isEnd());
+						ASSERT_EQ(expected, it.getKey());
+					} else {
+						ASSERT_TRUE(it.isEnd());
+					}
+				}
+			}
+		}
+	}
+
+	TEST_F( MorphingBIndexTest , testBlockANDJoinWithAllPostingKernels )
+	{
+		auto memspace = getMemspace();
+		srand(4142u);
+		// lists of different densities, large enough to morph into v_bindex
+		std::vector<index_t> indexes;
+		std::vector<std::uint64_t> expected;
+		for (unsigned int i = 0; i < 3; ++i) {
+			std::set<std::uint64_t> keys;
+			while (keys.size() < 30000u / (i + 1)) {
+				keys.insert(1 + rand() % 200000);
+			}
+			indexes.emplace_back(memspace, bindex::type::empty);
+			indexes.back().bulkInsertUnique(keys.begin(), keys.end());
+			ASSERT_EQ(bindex::type::bindex, indexes.back().getIndexType());
+			if (i == 0) {
+				expected.assign(keys.begin(), keys.end());
+			} else {
+				std::vector<std::uint64_t> result;
+				std::set_intersection(expected.begin(), expected.end(), keys.begin(), keys.end(), 
+					std::back_inserter(result));
+				expected = std::move(result);
+			}
+		}
+		ASSERT_FALSE(expected.empty());
+		
+		using IteratorT = FT_IndexIterator<index_t, std::uint64_t>;
+		auto initial_level = getPostingKernels().m_level;
+		for (auto level: { SIMD_Level::SCALAR, SIMD_Level::AVX2, SIMD_Level::NEON }) {
+			if (!setPostingKernels(level)) {
+				continue;
+			}
+			for (int direction: { 1, -1 }) {
+				std::list<std::unique_ptr<FT_Iterator<std::uint64_t> > > inner;
+				for (auto &index: indexes) {
+					inner.push_back(std::make_unique<IteratorT>(index, direction));
+					KeyRun run;
+					ASSERT_TRUE(inner.back()->getRun(run));
+					ASSERT_FALSE(run.empty());
+				}
+				auto start = std::chrono::high_resolution_clock::now();
+				FT_JoinANDIterator<std::uint64_t> cut(std::move(inner), direction);
+				std::vector<std::uint64_t> result;
+				while (!cut.isEnd()) {
+					result.push_back(cut.getKey());
+					if (direction > 0) {
+						++cut;
+					} else {
+						cut.next();
+					}
+				}
+				auto end = std::chrono::high_resolution_clock::now();
+				auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+				std::cout << "AND join (level " << static_cast<int>(level) << ", direction " << direction << "): "
+					<< elapsed.count() / 1000.0 << "ms" << std::endl;
+				if (direction < 0) {
+					std::reverse(result.begin(), result.end());
+				}
+				ASSERT_EQ(expected, result);
+			}
+		}
+		setPostingKernels(initial_level);
+	}
+
 } 
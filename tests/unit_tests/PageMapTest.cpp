@@ -8,6 +8,10 @@
 #include <dbzero/core/memory/AccessOptions.hpp>
 #include <dbzero/core/memory/DP_Lock.hpp>
 #include <dbzero/core/storage/Storage0.hpp>
+#include <map>
+#include <random>
+#include <chrono>
+#include <iostream>
 
 using namespace std;
 using namespace db0;
@@ -26,6 +30,15 @@ namespace tests
         }    
     };
 
+    // exposes the protected members (normally accessed by PrefixCache only)
+    class TestPageMap: public PageMap<DP_Lock>
+    {
+    public:
+        using PageMap<DP_Lock>::PageMap;
+        using PageMap<DP_Lock>::erase;
+        using PageMap<DP_Lock>::clearExpired;
+    };
+
     TEST_F( PageMapTest , testEmptyPageMap )
     {
         db0::Storage0 dev_null;
@@ -58,5 +71,133 @@ namespace tests
         ASSERT_EQ(cut.find(16, 1, state_num)->lock(), lock_2);
         ASSERT_EQ(cut.find(1, 2, state_num), nullptr);
     }
+
+    TEST_F( PageMapTest , testPageMapCanHoldManyVersionsOfSinglePage )
+    {
+        db0::Storage0 dev_null;
+        db0::DirtyCache null_cache(dev_null.getPageSize());
+        db0::StorageContext null_context { null_cache, dev_null };
+        auto page_size = dev_null.getPageSize();
+        TestPageMap cut(page_size);
+        std::vector<std::shared_ptr<DP_Lock> > locks;
+        // insert in non-sorted order, exceeding the inline capacity
+        for (StateNumType state_num: { 7, 3, 11, 5, 9, 1, 13 }) {
+            locks.push_back(std::make_shared<DP_Lock>(null_context, page_size, 1, FlagSet<AccessOptions> {}, 0, 0));
+            cut.insert(state_num, locks.back());
+        }
+        ASSERT_EQ(cut.size(), 7u);
+        StateNumType state_num;
+        ASSERT_EQ(cut.find(8, 1, state_num)->lock(), locks[0]);
+        ASSERT_EQ(state_num, 7u);
+        ASSERT_EQ(cut.find(100, 1, state_num)->lock(), locks[6]);
+        ASSERT_EQ(state_num, 13u);
+        ASSERT_EQ(cut.find(2, 1, state_num)->lock(), locks[5]);
+        ASSERT_TRUE(cut.exists(3, 1));
+        ASSERT_FALSE(cut.exists(4, 2));
+        cut.erase(7, 1);
+        cut.erase(13, 1);
+        ASSERT_EQ(cut.size(), 5u);
+        ASSERT_EQ(cut.find(8, 1, state_num)->lock(), locks[3]);
+        ASSERT_EQ(state_num, 5u);
+        ASSERT_EQ(cut.find(100, 1, state_num)->lock(), locks[2]);
+    }
     
+    TEST_F( PageMapTest , testPageMapClearExpiredRemovesOldestExpiredVersions )
+    {
+        db0::Storage0 dev_null;
+        db0::DirtyCache null_cache(dev_null.getPageSize());
+        db0::StorageContext null_context { null_cache, dev_null };
+        auto page_size = dev_null.getPageSize();
+        TestPageMap cut(page_size);
+        std::vector<std::shared_ptr<DP_Lock> > locks;
+        // pages spread across different stripes, 3 versions each
+        for (std::uint64_t page_num = 0; page_num < 500; ++page_num) {
+            for (StateNumType state_num = 1; state_num <= 3; ++state_num) {
+                auto lock = std::make_shared<DP_Lock>(null_context, page_num * page_size, page_size,
+                    FlagSet<AccessOptions> {}, 0, 0);
+                cut.insert(state_num, lock);
+                // keep the most recent version of the even pages only
+                if (state_num == 3 && page_num % 2 == 0) {
+                    locks.push_back(lock);
+                }
+            }
+        }
+        ASSERT_EQ(cut.size(), 1500u);
+        // versions newer than the head state must be retained
+        ASSERT_EQ(cut.clearExpired(2), 1000u);
+        ASSERT_EQ(cut.size(), 500u);
+        ASSERT_EQ(cut.clearExpired(3), 250u);
+        ASSERT_EQ(cut.size(), 250u);
+        StateNumType state_num;
+        for (std::uint64_t page_num = 0; page_num < 500; ++page_num) {
+            auto result = cut.find(3, page_num, state_num);
+            if (page_num % 2 == 0) {
+                ASSERT_NE(result, nullptr);
+                ASSERT_EQ(result->lock(), locks[page_num / 2]);
+            } else {
+                ASSERT_EQ(result, nullptr);
+            }
+        }
+        locks.clear();
+        ASSERT_EQ(cut.clearExpired(3), 250u);
+        ASSERT_TRUE(cut.empty());
+    }
+
+    void measureFindSpeed(std::size_t page_count)
+    {
+        db0::Storage0 dev_null;
+        db0::DirtyCache null_cache(dev_null.getPageSize());
+        db0::StorageContext null_context { null_cache, dev_null };
+        auto page_size = dev_null.getPageSize();
+        PageMap<DP_Lock> cut(page_size);
+        // reference: a single ordered map keyed by (page_num, state_num)
+        std::map<std::pair<std::uint64_t, StateNumType>, std::weak_ptr<DP_Lock> > ref;
+        std::shared_mutex ref_mutex;
+        // the same lock registered under all page numbers (no need to allocate the pages)
+        auto lock = std::make_shared<DP_Lock>(null_context, 0, page_size, FlagSet<AccessOptions> {}, 0, 0);
+        for (std::uint64_t page_num = 0; page_num < page_count; ++page_num) {
+            cut.insert(1, lock, page_num);
+            ref[{ page_num, 1 }] = lock;
+        }
+        
+        std::mt19937 gen(page_count);
+        std::vector<std::uint64_t> page_nums(1000000);
+        for (auto &page_num: page_nums) {
+            page_num = gen() % page_count;
+        }
+        
+        std::size_t found = 0;
+        StateNumType state_num;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (auto page_num: page_nums) {
+            found += cut.find(5, page_num, state_num) != nullptr;
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        auto page_map_ns = std::chrono::duration<double, std::nano>(end - start).count() / page_nums.size();
+        
+        start = std::chrono::high_resolution_clock::now();
+        for (auto page_num: page_nums) {
+            std::shared_lock<std::shared_mutex> _lock(ref_mutex);
+            auto it = ref.upper_bound({ page_num, 5 });
+            found += (it != ref.begin() && (--it)->first.first == page_num);
+        }
+        end = std::chrono::high_resolution_clock::now();
+        auto ref_ns = std::chrono::duration<double, std::nano>(end - start).count() / page_nums.size();
+        
+        ASSERT_EQ(found, 2 * page_nums.size());
+        std::cout << "PageMap::find with " << page_count << " pages: " << page_map_ns << " ns/op, std::map: "
+            << ref_ns << " ns/op" << std::endl;
+    }
+    
+    TEST_F( PageMapTest , testPageMapFindSpeed )
+    {
+        measureFindSpeed(100000);
+        measureFindSpeed(1000000);
+    }
+    
+    TEST_F( PageMapTest , DISABLED_testPageMapFindSpeedLarge )
+    {
+        measureFindSpeed(10000000);
+    }
+
 }
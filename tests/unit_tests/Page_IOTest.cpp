@@ -3,6 +3,8 @@
 
 #include <gtest/gtest.h>
 #include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
 #include <utils/TestWorkspace.hpp>
 #include <utils/utils.hpp>
 #include <dbzero/core/storage/Page_IO.hpp>
@@ -62,4 +64,37 @@ namespace tests
         ASSERT_EQ(cut.getNextPageNum().first, 11);
     }
 
+    TEST_F( Page_IOTest, testBufferedReadsInForkedProcess )
+    {
+        std::vector<char> data;
+        for (int i = 0; i < 4; ++i) {
+            data.insert(data.end(), page_size, static_cast<char>(i + 1));
+        }
+        CFile::create(file_name, data);
+        CFile file(file_name, AccessType::READ_ONLY, LockFlags(), FileIOMode::BUFFERED);
+        std::vector<char> buf(page_size);
+        file.read(0, page_size, buf.data());
+        int fds[2];
+        ASSERT_EQ(pipe(fds), 0);
+        auto pid = fork();
+        ASSERT_GE(pid, 0);
+        if (pid == 0) {
+            // wait until the parent has moved the (otherwise shared) file offset
+            char c;
+            if (::read(fds[0], &c, 1) != 1) {
+                _exit(2);
+            }
+            file.read(page_size, page_size, buf.data());
+            _exit(buf == std::vector<char>(page_size, 2) ? 0 : 1);
+        }
+        file.read(3 * page_size, page_size, buf.data());
+        ASSERT_EQ(::write(fds[1], "x", 1), 1);
+        int status = 0;
+        ASSERT_EQ(waitpid(pid, &status, 0), pid);
+        ASSERT_TRUE(WIFEXITED(status));
+        ASSERT_EQ(WEXITSTATUS(status), 0);
+        ::close(fds[0]);
+        ::close(fds[1]);
+    }
+
 }
\ No newline at end of file
@@ -8,6 +8,8 @@
 #include <dbzero/core/memory/AccessOptions.hpp>
 #include <dbzero/core/memory/CacheRecycler.hpp>
 #include <dbzero/core/storage/BDevStorage.hpp>
+#include <sys/wait.h>
+#include <unistd.h>
 
 using namespace std;
 using namespace db0;
@@ -721,4 +723,168 @@ namespace tests
         cut.close();
     } 
     
+    TEST_F( PrefixImplTest , testSequentialScanIsServedByReadAhead )
+    {
+        BDevStorage::create(file_name);
+        const std::uint64_t page_count = 300;
+        std::size_t page_size = 0;
+        {
+            PrefixImpl cut(file_name, m_dirty_meter, &m_cache_recycler, std::make_shared<BDevStorage>(file_name));
+            page_size = cut.getPageSize();
+            for (std::uint64_t i = 0; i < page_count; ++i) {
+                auto lock = cut.mapRange(i * page_size, page_size, { AccessOptions::write });
+                std::memset(lock.modify(), static_cast<int>(i % 251), page_size);
+            }
+            cut.commit();
+            cut.close();
+        }
+        m_cache_recycler.clear();
+        
+        PrefixImpl cut(file_name, m_dirty_meter, &m_cache_recycler,
+            std::make_shared<BDevStorage>(file_name, AccessType::READ_ONLY, LockFlags(), std::nullopt,
+                StorageFlags { StorageOptions::READ_AHEAD }));
+        for (std::uint64_t i = 0; i < page_count; ++i) {
+            auto lock = cut.mapRange(i * page_size, page_size, { AccessOptions::read });
+            auto data = static_cast<const unsigned char*>(lock.m_buffer);
+            ASSERT_EQ(data[0], i % 251);
+            ASSERT_EQ(data[page_size - 1], i % 251);
+        }
+        
+        std::map<std::string, std::uint64_t> stats;
+        cut.getStats([&](const std::string &name, std::uint64_t value) {
+            stats[name] = value;
+        });
+        // all but the initial pages should be served from the read-ahead
+        ASSERT_GT(stats["readahead_hits"], page_count / 2);
+        ASSERT_GT(stats["readahead_window"], ReadAhead::MIN_WINDOW);
+        cut.close();
+    }
+    
+    TEST_F( PrefixImplTest , testPrefetchHint )
+    {
+        BDevStorage::create(file_name);
+        const std::uint64_t page_count = 32;
+        std::size_t page_size = 0;
+        {
+            PrefixImpl cut(file_name, m_dirty_meter, &m_cache_recycler, std::make_shared<BDevStorage>(file_name));
+            page_size = cut.getPageSize();
+            for (std::uint64_t i = 0; i < page_count; ++i) {
+                auto lock = cut.mapRange(i * page_size, page_size, { AccessOptions::write });
+                std::memset(lock.modify(), static_cast<int>(i + 1), page_size);
+            }
+            cut.commit();
+            cut.close();
+        }
+        m_cache_recycler.clear();
+        
+        {
+            PrefixImpl cut(file_name, m_dirty_meter, &m_cache_recycler, std::make_shared<BDevStorage>(file_name,
+                AccessType::READ_WRITE, LockFlags(), std::nullopt, StorageFlags { StorageOptions::READ_AHEAD }));
+            // modify some pages in the head transaction (not to be served from the read-ahead)
+            for (std::uint64_t i = 0; i < page_count; i += 4) {
+                auto lock = cut.mapRange(i * page_size, page_size, { AccessOptions::write });
+                std::memset(lock.modify(), 0xff, page_size);
+            }
+            cut.flushDirty(std::numeric_limits<std::size_t>::max());
+            m_cache_recycler.clear();
+            
+            // prefetch all pages, also past the end of data
+            cut.prefetch(0, (page_count + 8) * page_size);
+            for (std::uint64_t i = 0; i < page_count; ++i) {
+                auto lock = cut.mapRange(i * page_size, page_size, { AccessOptions::read });
+                auto data = static_cast<const unsigned char*>(lock.m_buffer);
+                ASSERT_EQ(data[page_size / 2], (i % 4 == 0) ? 0xff : i + 1);
+            }
+            
+            std::map<std::string, std::uint64_t> stats;
+            cut.getStats([&](const std::string &name, std::uint64_t value) {
+                stats[name] = value;
+            });
+            ASSERT_EQ(stats["readahead_hits"], page_count - page_count / 4);
+            cut.close();
+        }
+    }
+    
+    TEST_F( PrefixImplTest , testReadAheadInForkedProcess )
+    {
+        BDevStorage::create(file_name);
+        const std::uint64_t page_count = 64;
+        std::size_t page_size = 0;
+        {
+            PrefixImpl cut(file_name, m_dirty_meter, &m_cache_recycler, std::make_shared<BDevStorage>(file_name));
+            page_size = cut.getPageSize();
+            for (std::uint64_t i = 0; i < page_count; ++i) {
+                auto lock = cut.mapRange(i * page_size, page_size, { AccessOptions::write });
+                std::memset(lock.modify(), static_cast<int>(i + 1), page_size);
+            }
+            cut.commit();
+            cut.close();
+        }
+        m_cache_recycler.clear();
+        
+        PrefixImpl cut(file_name, m_dirty_meter, &m_cache_recycler, std::make_shared<BDevStorage>(file_name,
+            AccessType::READ_ONLY, LockFlags(), std::nullopt, StorageFlags { StorageOptions::READ_AHEAD }));
+        auto scan = [&]() {
+            for (std::uint64_t i = 0; i < page_count; ++i) {
+                auto lock = cut.mapRange(i * page_size, page_size, { AccessOptions::read });
+                if (static_cast<const unsigned char*>(lock.m_buffer)[page_size / 2] != i + 1) {
+                    return false;
+                }
+            }
+            return true;
+        };
+        // start the worker thread (with requests possibly still queued) before forking
+        cut.prefetch(0, page_count * page_size);
+        auto pid = fork();
+        ASSERT_GE(pid, 0);
+        if (pid == 0) {
+            // the child must be able to use (and re-start) the read-ahead
+            m_cache_recycler.clear();
+            _exit(scan() ? 0 : 1);
+        }
+        int status = 0;
+        ASSERT_EQ(waitpid(pid, &status, 0), pid);
+        ASSERT_TRUE(WIFEXITED(status));
+        ASSERT_EQ(WEXITSTATUS(status), 0);
+        ASSERT_TRUE(scan());
+        cut.close();
+    }
+    
+    TEST_F( PrefixImplTest , testCommitWithManyDiffPages )
+    {
+        BDevStorage::create(file_name);
+        // enough pages for the diffs to be computed in parallel
+        const std::uint64_t page_count = 500;
+        std::size_t page_size = 0;
+        {
+            PrefixImpl cut(file_name, m_dirty_meter, &m_cache_recycler, std::make_shared<BDevStorage>(file_name));
+            page_size = cut.getPageSize();
+            for (std::uint64_t i = 0; i < page_count; ++i) {
+                auto lock = cut.mapRange(i * page_size, page_size, { AccessOptions::write });
+                std::memset(lock.modify(), static_cast<int>(i % 251), page_size);
+            }
+            cut.commit();
+            // small modifications to be flushed as diffs
+            for (std::uint64_t i = 0; i < page_count; ++i) {
+                auto lock = cut.mapRange(i * page_size + (i % 64) * 8, 8, { AccessOptions::write });
+                std::memset(lock.modify(), 0xff, 8);
+            }
+            cut.commit();
+            cut.close();
+        }
+        m_cache_recycler.clear();
+        
+        PrefixImpl cut(file_name, m_dirty_meter, &m_cache_recycler,
+            std::make_shared<BDevStorage>(file_name, AccessType::READ_ONLY));
+        for (std::uint64_t i = 0; i < page_count; ++i) {
+            auto lock = cut.mapRange(i * page_size, page_size, { AccessOptions::read });
+            auto data = static_cast<const unsigned char*>(lock.m_buffer);
+            for (std::size_t offset = 0; offset < page_size; ++offset) {
+                bool modified = offset >= (i % 64) * 8 && offset < (i % 64) * 8 + 8;
+                ASSERT_EQ(data[offset], modified ? 0xff : i % 251);
+            }
+        }
+        cut.close();
+    }
+    
 }
@@ -283,6 +283,56 @@ namespace tests
         ASSERT_EQ(values, (std::vector<std::uint64_t> { 4, 3, 8 }));
     }
 
+    TEST_F( RangeTreeTest , testSortIteratorWithLimit )
+    {
+        using RangeTreeT = RangeTree<int, std::uint64_t>;
+        using ItemT = typename RangeTreeT::ItemT;
+
+        auto memspace = getMemspace();
+        // create with the limit of 4 items per range, make 3 ranges
+        IndexBase index(memspace, db0::IndexType::Unknown, db0::IndexDataType::Auto);
+        auto rt = std::make_shared<RangeTreeT>(memspace, 4);
+        std::vector<ItemT> values_1 {
+            { 99, 3 },  { 199, 5 }, { 13, 2 }, { 199, 7 }, { 142, 9}, { 152, 8}, { 27, 4 },
+            { 123, 6}, { 148, 11 }, { 391, 10 }, { 9234, 12 }
+        };
+        rt->bulkInsert(values_1.begin(), values_1.end());
+
+        FixedObjectList shared_object_list(100);
+        VObjectCache cache(memspace, shared_object_list);
+        FT_BaseIndex<std::uint64_t, std::uint64_t> ft_index(memspace, cache);
+        {
+            auto batch_data = ft_index.beginBatchUpdate();
+            // tag 1 - sparse query, tag 2 - all values
+            batch_data->addTags({4, nullptr}, std::vector<std::uint64_t> { 1, 2 });
+            batch_data->addTags({8, nullptr}, std::vector<std::uint64_t> { 1, 2 });
+            batch_data->addTags({10, nullptr}, std::vector<std::uint64_t> { 1, 2 });
+            for (std::uint64_t value: { 2, 3, 5, 6, 7, 9, 11, 12 }) {
+                batch_data->addTags({value, nullptr}, std::vector<std::uint64_t> { 2 });
+            }
+            batch_data->flush();
+        }
+
+        auto sort = [&](std::uint64_t tag, bool asc, std::size_t limit) {
+            RT_SortIterator<int, std::uint64_t> cut(index, rt, ft_index.makeIterator(tag), asc);
+            cut.setLimit(limit);
+            std::vector<std::uint64_t> values;
+            while (!cut.isEnd()) {
+                std::uint64_t value;
+                cut.next(&value);
+                values.push_back(value);
+            }
+            return values;
+        };
+
+        ASSERT_EQ(sort(2, true, 3), (std::vector<std::uint64_t> { 2, 4, 3 }));
+        ASSERT_EQ(sort(2, true, 8), (std::vector<std::uint64_t> { 2, 4, 3, 6, 9, 11, 8, 5 }));
+        ASSERT_EQ(sort(2, false, 4), (std::vector<std::uint64_t> { 12, 10, 7, 5 }));
+        ASSERT_EQ(sort(2, true, 100).size(), 11u);
+        ASSERT_EQ(sort(1, true, 2), (std::vector<std::uint64_t> { 4, 8 }));
+        ASSERT_EQ(sort(1, false, 5), (std::vector<std::uint64_t> { 10, 8, 4 }));
+    }
+
     TEST_F( RangeTreeTest , testRangeTreeLowerBound )
     {
         using RangeTreeT = RangeTree<int, std::uint64_t>;
@@ -0,0 +1,221 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <thread>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <dbzero/core/memory/SharedPageCache.hpp>
+
+using namespace std;
+using namespace db0;
+
+namespace tests
+
+{
+
+    class SharedPageCacheTest: public testing::Test
+    {
+    public:
+        static constexpr std::size_t PAGE_SIZE = 4096;
+
+        virtual void SetUp() override
+        {
+            m_name = "/db0-test-page-cache-" + std::to_string(::getpid());
+            SharedPageCache::unlink(m_name);
+        }
+
+        virtual void TearDown() override {
+            SharedPageCache::unlink(m_name);
+        }
+
+        static std::vector<char> makePage(char value) {
+            return std::vector<char>(PAGE_SIZE, value);
+        }
+
+    protected:
+        std::string m_name;
+    };
+
+    TEST_F( SharedPageCacheTest , testPutGetByPrefixPageAndMutation )
+    {
+        SharedPageCache cache(m_name, 1 << 20, PAGE_SIZE);
+        std::vector<char> buffer(PAGE_SIZE);
+        ASSERT_FALSE(cache.tryGet(1, 10, 5, buffer.data()));
+        cache.put(1, 10, 5, makePage('a').data());
+        ASSERT_TRUE(cache.tryGet(1, 10, 5, buffer.data()));
+        ASSERT_EQ(buffer, makePage('a'));
+        // other prefix, page or mutation
+        ASSERT_FALSE(cache.tryGet(2, 10, 5, buffer.data()));
+        ASSERT_FALSE(cache.tryGet(1, 11, 5, buffer.data()));
+        ASSERT_FALSE(cache.tryGet(1, 10, 6, buffer.data()));
+    }
+
+    TEST_F( SharedPageCacheTest , testNewMutationReplacesOlderVersion )
+    {
+        SharedPageCache cache(m_name, 1 << 20, PAGE_SIZE);
+        std::vector<char> buffer(PAGE_SIZE);
+        cache.put(1, 10, 5, makePage('a').data());
+        cache.put(1, 10, 7, makePage('b').data());
+        ASSERT_FALSE(cache.tryGet(1, 10, 5, buffer.data()));
+        ASSERT_TRUE(cache.tryGet(1, 10, 7, buffer.data()));
+        ASSERT_EQ(buffer, makePage('b'));
+    }
+
+    TEST_F( SharedPageCacheTest , testPagesVisibleToOtherAttachedInstance )
+    {
+        // the 2nd instance emulates another process attaching the same segment
+        SharedPageCache cache_1(m_name, 1 << 20, PAGE_SIZE);
+        SharedPageCache cache_2(m_name, 1 << 30, PAGE_SIZE);
+        // capacity is determined by the creator
+        ASSERT_EQ(cache_1.getSlotCount(), cache_2.getSlotCount());
+        for (std::uint64_t page_num = 0; page_num < 16; ++page_num) {
+            cache_1.put(1, page_num, 1, makePage('a' + page_num).data());
+        }
+        std::vector<char> buffer(PAGE_SIZE);
+        for (std::uint64_t page_num = 0; page_num < 16; ++page_num) {
+            ASSERT_TRUE(cache_2.tryGet(1, page_num, 1, buffer.data()));
+            ASSERT_EQ(buffer, makePage('a' + page_num));
+        }
+    }
+
+    TEST_F( SharedPageCacheTest , testAttachWithDifferentPageSizeFails )
+    {
+        SharedPageCache cache(m_name, 1 << 20, PAGE_SIZE);
+        ASSERT_ANY_THROW(SharedPageCache(m_name, 1 << 20, PAGE_SIZE * 2));
+    }
+
+    TEST_F( SharedPageCacheTest , testConcurrentReadersNeverSeeTornPages )
+    {
+        // small cache to force frequent overwrites of the same slots
+        SharedPageCache cache(m_name, 8 * (PAGE_SIZE + 64), PAGE_SIZE);
+        std::atomic<bool> stop = false;
+        std::thread writer([&]() {
+            for (std::uint64_t i = 0; i < 20000; ++i) {
+                cache.put(1, i % 32, 1, makePage('a' + (i % 32)).data());
+            }
+            stop = true;
+        });
+        std::vector<char> buffer(PAGE_SIZE);
+        std::size_t hits = 0;
+        while (!stop) {
+            for (std::uint64_t page_num = 0; page_num < 32; ++page_num) {
+                if (cache.tryGet(1, page_num, 1, buffer.data())) {
+                    ASSERT_EQ(buffer, makePage('a' + page_num));
+                    ++hits;
+                }
+            }
+        }
+        writer.join();
+        ASSERT_TRUE(hits > 0);
+    }
+
+    TEST_F( SharedPageCacheTest , testSegmentRemovedWhenLastInstanceDetaches )
+    {
+        {
+            SharedPageCache cache_1(m_name, 1 << 20, PAGE_SIZE);
+            {
+                SharedPageCache cache_2(m_name, 1 << 20, PAGE_SIZE);
+            }
+            ASSERT_TRUE(SharedPageCache::exists(m_name));
+        }
+        ASSERT_FALSE(SharedPageCache::exists(m_name));
+    }
+
+    TEST_F( SharedPageCacheTest , testSlotOfCrashedWriterIsRecovered )
+    {
+        SharedPageCache cache(m_name, 1 << 20, PAGE_SIZE);
+        auto pid = ::fork();
+        ASSERT_TRUE(pid >= 0);
+        if (!pid) {
+            // the child crashes while copying the page into the slot (unreadable source buffer)
+            SharedPageCache child_cache(m_name, 1 << 20, PAGE_SIZE);
+            auto buffer = ::mmap(nullptr, PAGE_SIZE, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            child_cache.put(1, 10, 5, buffer);
+            ::_exit(0);
+        }
+        int status = 0;
+        ::waitpid(pid, &status, 0);
+        ASSERT_TRUE(WIFSIGNALED(status));
+        std::vector<char> buffer(PAGE_SIZE);
+        ASSERT_FALSE(cache.tryGet(1, 10, 5, buffer.data()));
+        cache.put(1, 10, 5, makePage('a').data());
+        ASSERT_TRUE(cache.tryGet(1, 10, 5, buffer.data()));
+        ASSERT_EQ(buffer, makePage('a'));
+    }
+
+    TEST_F( SharedPageCacheTest , testPinnedPageIsNotOverwritten )
+    {
+        // a single set of slots
+        auto cache = std::make_shared<SharedPageCache>(m_name, 8 * (PAGE_SIZE + 64), PAGE_SIZE);
+        ASSERT_EQ(cache->getSlotCount(), SharedPageCache::WAYS);
+        ASSERT_EQ(cache->tryPin(1, 10, 5), nullptr);
+        cache->put(1, 10, 5, makePage('a').data());
+        auto pinned = cache->tryPin(1, 10, 5);
+        ASSERT_NE(pinned, nullptr);
+        ASSERT_EQ(cache->getPinnedCount(), 1u);
+        // the new version and other pages must not replace the pinned slot
+        cache->put(1, 10, 6, makePage('b').data());
+        for (std::uint64_t page_num = 0; page_num < 16; ++page_num) {
+            cache->put(1, page_num, 1, makePage('c').data());
+        }
+        ASSERT_EQ(std::vector<char>((const char*)pinned.get(), (const char*)pinned.get() + PAGE_SIZE), makePage('a'));
+        // pinning the same page again shares the slot
+        auto pinned_2 = cache->tryPin(1, 10, 5);
+        ASSERT_EQ(pinned_2.get(), pinned.get());
+        ASSERT_EQ(cache->getPinnedCount(), 1u);
+        pinned = nullptr;
+        pinned_2 = nullptr;
+        ASSERT_EQ(cache->getPinnedCount(), 0u);
+        // once released, all slots can be replaced
+        for (std::uint64_t page_num = 0; page_num < 16; ++page_num) {
+            cache->put(1, page_num, 1, makePage('c').data());
+        }
+        std::vector<char> buffer(PAGE_SIZE);
+        ASSERT_FALSE(cache->tryGet(1, 10, 5, buffer.data()));
+    }
+
+    TEST_F( SharedPageCacheTest , testPinsOfExitedProcessAreIgnored )
+    {
+        auto cache = std::make_shared<SharedPageCache>(m_name, 8 * (PAGE_SIZE + 64), PAGE_SIZE);
+        cache->put(1, 10, 5, makePage('a').data());
+        auto pid = ::fork();
+        ASSERT_TRUE(pid >= 0);
+        if (!pid) {
+            // the child pins the page and exits without releasing it
+            auto child_cache = std::make_shared<SharedPageCache>(m_name, 8 * (PAGE_SIZE + 64), PAGE_SIZE);
+            auto pinned = child_cache->tryPin(1, 10, 5);
+            ::_exit(pinned ? 0 : 1);
+        }
+        int status = 0;
+        ::waitpid(pid, &status, 0);
+        ASSERT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+        for (std::uint64_t page_num = 0; page_num < 16; ++page_num) {
+            cache->put(1, page_num, 1, makePage('c').data());
+        }
+        std::vector<char> buffer(PAGE_SIZE);
+        ASSERT_FALSE(cache->tryGet(1, 10, 5, buffer.data()));
+    }
+
+    TEST_F( SharedPageCacheTest , testSegmentRemovedOnCloseWithPinnedPages )
+    {
+        auto cache = std::make_shared<SharedPageCache>(m_name, 1 << 20, PAGE_SIZE);
+        cache->put(1, 10, 5, makePage('a').data());
+        auto pinned = cache->tryPin(1, 10, 5);
+        ASSERT_NE(pinned, nullptr);
+        cache->close();
+        ASSERT_FALSE(SharedPageCache::exists(m_name));
+        // the page remains mapped until released
+        ASSERT_EQ(std::vector<char>((const char*)pinned.get(), (const char*)pinned.get() + PAGE_SIZE), makePage('a'));
+        ASSERT_EQ(cache->tryPin(1, 10, 5), nullptr);
+    }
+
+    TEST_F( SharedPageCacheTest , testCapacityExceedingSharedMemoryFails )
+    {
+        ASSERT_ANY_THROW(SharedPageCache(m_name, std::size_t(1) << 50, PAGE_SIZE));
+        ASSERT_FALSE(SharedPageCache::exists(m_name));
+    }
+
+}
@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (c) 2025 DBZero Software sp. z o.o.
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <atomic>
+#include <set>
+#include <string>
+#include <dbzero/core/utils/Tracer.hpp>
+
+using namespace std;
+
+namespace tests
+
+{
+
+    class TracerTest: public testing::Test
+    {
+    public:
+        virtual void SetUp() override {
+            db0::Tracer::clear();
+        }
+
+        virtual void TearDown() override
+        {
+            db0::Tracer::enable(false);
+            db0::Tracer::clear();
+        }
+
+        static std::size_t count(const char *name)
+        {
+            std::size_t result = 0;
+            for (auto &item: db0::Tracer::collect()) {
+                if (std::string(item.second.m_name) == name) {
+                    ++result;
+                }
+            }
+            return result;
+        }
+    };
+
+    TEST_F( TracerTest , testNoEventsRecordedWhenDisabled )
+    {
+        {
+            DB0_TRACE("test-disabled");
+        }
+        ASSERT_EQ(count("test-disabled"), 0u);
+    }
+
+    TEST_F( TracerTest , testScopeRecordedWhenEnabled )
+    {
+        db0::Tracer::enable(true);
+        {
+            DB0_TRACE("test-scope", 123);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        auto events = db0::Tracer::collect();
+        ASSERT_EQ(events.size(), 1u);
+        ASSERT_EQ(std::string(events[0].second.m_name), "test-scope");
+        ASSERT_EQ(events[0].second.m_arg, 123u);
+        ASSERT_TRUE(events[0].second.m_duration_ns >= 1000000u);
+    }
+
+    TEST_F( TracerTest , testRingBufferRetainsMostRecentEvents )
+    {
+        db0::Tracer::enable(true);
+        for (std::uint64_t i = 0; i < db0::TraceBuffer::CAPACITY * 2 + 17; ++i) {
+            DB0_TRACE("test-ring", i);
+        }
+        auto events = db0::Tracer::collect();
+        // NOTE: the oldest slot is not reported since it might be concurrently overwritten
+        ASSERT_EQ(events.size(), db0::TraceBuffer::CAPACITY - 1);
+        ASSERT_EQ(events.back().second.m_arg, db0::TraceBuffer::CAPACITY * 2 + 16);
+    }
+
+    TEST_F( TracerTest , testEventsCollectedFromMultipleThreads )
+    {
+        db0::Tracer::enable(true);
+        std::vector<std::thread> threads;
+        std::atomic<int> done_count = 0;
+        for (int i = 0; i < 4; ++i) {
+            threads.emplace_back([&done_count]() {
+                for (int j = 0; j < 100; ++j) {
+                    DB0_TRACE("test-thread");
+                }
+                // keep all threads alive, buffers of exited threads might be reused
+                ++done_count;
+                while (done_count < 4) {
+                    std::this_thread::yield();
+                }
+            });
+        }
+        for (auto &thread: threads) {
+            thread.join();
+        }
+        auto events = db0::Tracer::collect();
+        ASSERT_EQ(events.size(), 400u);
+        std::set<std::uint32_t> thread_ids;
+        for (auto &item: events) {
+            thread_ids.insert(item.first);
+        }
+        ASSERT_EQ(thread_ids.size(), 4u);
+        // events of exited threads are retained until cleared
+        db0::Tracer::clear();
+        ASSERT_EQ(count("test-thread"), 0u);
+    }
+
+    TEST_F( TracerTest , testBuffersOfExitedThreadsAreReused )
+    {
+        db0::Tracer::enable(true);
+        auto record = []() {
+            DB0_TRACE("test-reuse");
+        };
+        std::thread(record).join();
+        auto buffer_count = db0::Tracer::getBufferCount();
+        for (int i = 0; i < 10; ++i) {
+            std::thread(record).join();
+        }
+        ASSERT_EQ(db0::Tracer::getBufferCount(), buffer_count);
+        // events of the exited thread are discarded once its buffer is reused
+        ASSERT_EQ(count("test-reuse"), 1u);
+    }
+
+    TEST_F( TracerTest , testExportChromeTrace )
+    {
+        db0::Tracer::enable(true);
+        {
+            DB0_TRACE("test-export");
+        }
+        auto json = db0::Tracer::exportChromeTrace();
+        ASSERT_EQ(json.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[{\"name\":\"test-export\""), 0u);
+        ASSERT_NE(json.find("\"ph\":\"X\""), std::string::npos);
+    }
+
+}